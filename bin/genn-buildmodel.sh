@@ -5,6 +5,7 @@ genn_help () {
     echo "genn-buildmodel.sh script usage:"
     echo "genn-buildmodel.sh [cdho] model"
     echo "-c            only generate simulation code for the CPU"
+    echo "-t            only generate multi-threaded simulation code for the CPU"
     echo "-l            generate simulation code for OpenCL"
     echo "-d            enables the debugging mode"
     echo "-m            generate MPI simulation code"
@@ -32,9 +33,10 @@ GENERATOR_MAKEFILE="MakefileCUDA"
 CXX_STANDARD="c++11"
 FORCE_REBUILD=0
 while [[ -n "${!OPTIND}" ]]; do
-    while getopts "cldvfs:o:i:h" option; do
+    while getopts "ctldvfs:o:i:h" option; do
     case $option in
         c) GENERATOR_MAKEFILE="MakefileSingleThreadedCPU";;
+        t) GENERATOR_MAKEFILE="MakefileMultiThreadedCPU";;
         l) GENERATOR_MAKEFILE="MakefileOpenCL";;
         d) DEBUG=1;;
         v) COVERAGE=1;;
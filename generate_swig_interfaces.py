@@ -450,7 +450,10 @@ def generateCustomModelDeclImpls(swigPath):
 
 def generateBackend(swigPath, folder, namespace):
     # **YUCK** is this backend derived from BackendSIMT? 
-    simt_backend = (namespace != "SingleThreadedCPU")
+    simt_backend = (namespace not in ("SingleThreadedCPU", "MultiThreadedCPU"))
+
+    # Is this backend derived from the single-threaded CPU backend?
+    cpu_derived_backend = (namespace == "MultiThreadedCPU")
 
     # Create SWIG module
     with SwigModuleGenerator(namespace + "Backend", os.path.join(swigPath, namespace + "Backend.i")) as mg:
@@ -486,6 +489,12 @@ def generateBackend(swigPath, folder, namespace):
             mg.addSwigIgnore("BackendSIMT")
             mg.addSwigInclude('"code_generator/backendSIMT.h"')
 
+        # If this backend is derived from the single-threaded CPU backend, parse its header to get base Preferences definition
+        # **NOTE** its Preferences are renamed so they don't clash with this backend's
+        if cpu_derived_backend:
+            mg.addSwigRename("CodeGenerator::SingleThreadedCPU::Preferences", "SingleThreadedCPUPreferences")
+            mg.addSwigInclude('"../single_threaded_cpu/backend.h"')
+
         # Parse backend, ignore Backend itself to get PreferencesBase definition
         mg.addSwigIgnore("Backend")
         mg.addSwigInclude('"backend.h"')
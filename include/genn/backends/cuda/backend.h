@@ -168,16 +168,17 @@ public:
     // CodeGenerator::BackendBase virtuals
     //--------------------------------------------------------------------------
     virtual void genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, 
-                                 HostHandler preambleHandler, HostHandler pushEGPHandler) const override;
+                                 HostHandler preambleHandler, HostHandler pushEGPHandler, ModuleHandler moduleHandler) const override;
 
     virtual void genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, 
-                                  HostHandler preambleHandler, HostHandler pushEGPHandler) const override;
+                                  HostHandler preambleHandler, HostHandler pushEGPHandler, ModuleHandler moduleHandler) const override;
 
     virtual void genCustomUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, 
                                  HostHandler preambleHandler, HostHandler pushEGPHandler) const override;
 
     virtual void genInit(CodeStream &os, const ModelSpecMerged &modelMerged, 
-                         HostHandler preambleHandler, HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler) const override;
+                         HostHandler preambleHandler, HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler,
+                         ModuleHandler moduleHandler) const override;
 
     virtual void genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
     virtual void genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
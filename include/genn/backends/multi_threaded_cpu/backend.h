@@ -0,0 +1,106 @@
+#pragma once
+
+// GeNN includes
+#include "backendExport.h"
+
+// Single-threaded CPU backend includes
+#include "../single_threaded_cpu/backend.h"
+
+//--------------------------------------------------------------------------
+// CodeGenerator::MultiThreadedCPU::Preferences
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+namespace MultiThreadedCPU
+{
+struct Preferences : public SingleThreadedCPU::Preferences
+{
+    //! How many threads should the generated code use?
+    /*! If this is zero, the GENN_NUM_THREADS environment variable is read when the model is allocated and,
+        if that is not set either, one thread is used per hardware thread */
+    unsigned int numThreads = 0;
+
+    //! Should presynaptic updates always add input to postsynaptic neurons atomically?
+    /*! By default, DENSE and non-optimised BITMASK connectivity is split between threads by postsynaptic neuron
+        and threads processing other types of connectivity accumulate input into private buffers which are then reduced */
+    bool atomicPresynapticUpdate = false;
+
+    //! Should each thread be pinned to its own CPU?
+    /*! Pages of memory are placed on the NUMA node of the thread that first writes them and most parallel loops give each thread 
+        the same range of neurons or synapses every time. Therefore, if threads are pinned, state initialised by a thread stays on 
+        its node and is mostly updated by the same thread. Pinning is currently only supported on Linux */
+    bool pinThreads = false;
+
+    void updateHash(boost::uuids::detail::sha1 &hash) const
+    {
+        // Superclass
+        SingleThreadedCPU::Preferences::updateHash(hash);
+
+        // Update hash with our preferences
+        Utils::updateHash(numThreads, hash);
+        Utils::updateHash(atomicPresynapticUpdate, hash);
+        Utils::updateHash(pinThreads, hash);
+    }
+};
+
+//--------------------------------------------------------------------------
+// CodeGenerator::MultiThreadedCPU::Backend
+//--------------------------------------------------------------------------
+//! Backend which generates code for CPUs, distributing independent loop iterations across a persistent pool of threads
+class BACKEND_EXPORT Backend : public SingleThreadedCPU::Backend
+{
+public:
+    Backend(const std::string &scalarType, const Preferences &preferences)
+    :   SingleThreadedCPU::Backend(scalarType, preferences)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // CodeGenerator::BackendBase virtuals
+    //--------------------------------------------------------------------------
+    virtual void genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+    virtual void genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerged, const MemAlloc &memAlloc) const override;
+    virtual void genAllocateMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged, const MemAlloc &memAlloc) const override;
+    virtual void genFreeMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+    virtual void genStepTimeFinalisePreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+
+    virtual void genMakefilePreamble(std::ostream &os) const override;
+
+    //! Get list of files to copy into generated code
+    virtual std::vector<filesystem::path> getFilesToCopy(const ModelSpecMerged &modelMerged) const override;
+
+    //! Get hash digest of this backends identification and the preferences it has been configured with
+    virtual boost::uuids::detail::sha1::digest_type getHashDigest() const override;
+
+protected:
+    //--------------------------------------------------------------------------
+    // CodeGenerator::SingleThreadedCPU::Backend virtuals
+    //--------------------------------------------------------------------------
+    virtual void genParallelFor(CodeStream &os, const std::string &count, const std::string &indexVarName,
+                                bool parallel, HostHandler handler, bool vectorise = false) const override;
+
+    virtual void genParallelForChunks(CodeStream &os, const std::string &count, const std::string &beginVarName,
+                                      const std::string &endVarName, const std::string &threadVarName, HostHandler handler,
+                                      const std::string &weight = "", const std::string &loadName = "") const override;
+
+    virtual std::string getNumThreads() const override{ return "threadPool.getNumThreads()"; }
+
+    virtual SingleThreadedCPU::PresynapticUpdateStrategy getPresynapticUpdateStrategy(const SynapseGroupInternal &sg) const override;
+
+    virtual std::string getAtomicAdd(const std::string &target, const std::string &value) const override
+    {
+        return "gennAtomicAdd(&" + target + ", " + value + ")";
+    }
+
+    virtual std::string getAtomicIncrement(const std::string &target) const override
+    {
+        return "gennAtomicIncrement(&" + target + ")";
+    }
+
+    virtual std::string getAtomicOr(const std::string &target, const std::string &value) const override
+    {
+        return "gennAtomicOr(&" + target + ", " + value + ")";
+    }
+};
+}   // namespace MultiThreadedCPU
+}   // namespace CodeGenerator
@@ -3,6 +3,7 @@
 // Standard C++ includes
 #include <functional>
 #include <map>
+#include <sstream>
 #include <string>
 
 // GeNN includes
@@ -27,6 +28,81 @@ namespace SingleThreadedCPU
 {
 struct Preferences : public PreferencesBase
 {
+    //! Should neuron simulation code, sparse connectivity initialisation and variable initialisation use counter-based Philox RNGs rather than the global host RNG?
+    /*! Neuron simulation RNGs are keyed by population, neuron and timestep, connectivity initialisation RNGs by population and row
+        (or column) and variable initialisation RNGs by population, variable and neuron (or synapse row). This allows neuron groups, 
+        rows of connectivity and variables which use random numbers to be processed in parallel with results that don't depend 
+        on the number of threads */
+    bool counterBasedRNG = false;
+
+    //! Should neuron update code be generated in a form which compilers can vectorise?
+    /*! Rather than appending to the spike queue within the neuron update loop, spikes are written to a
+        mask and compacted into the spike queue (and recording buffers) in a separate pass. Neuron groups
+        which use the global host RNG (rather than counter-based RNGs) are not vectorised */
+    bool vectoriseNeuronUpdate = false;
+
+    //! Should the time taken to update each merged group, and each group within it, be recorded every timestep?
+    /*! Events are recorded into a trace which can be written to a JSON file using writeTrace()
+        and opened in chrome://tracing or Perfetto */
+    bool enableTrace = false;
+
+    //! Arrays of at least this many bytes are mapped directly and marked as candidates for transparent huge pages
+    /*! This reduces TLB misses when accessing large arrays such as synaptic weights. If this is zero,
+        arrays are never mapped. All arrays are 64-byte aligned whatever this is set to */
+    size_t hugePageThreshold = 0;
+
+    //! Should the presynaptic index of each synapse be stored alongside the column-major remapping used for postsynaptic learning?
+    /*! This replaces an integer divide per synapse in the postsynaptic update of SPARSE
+        synapse groups with a sequential load at the cost of an extra unsigned int per synapse */
+    bool postsynapticPreInd = false;
+
+    //! Should the neuron update, synapse update and initialisation code for each merged group be generated in its own module?
+    /*! Each merged group is updated by a function in a seperate source file, called from the main module. This
+        allows large models to be compiled in parallel and means only the modules of changed groups are recompiled */
+    bool splitModules = false;
+
+    //! Should generated code be built with link-time optimisation?
+    bool linkTimeOptimisation = false;
+
+    //! Should generated code be built for the instruction set of the CPU it is built on?
+    /*! Code built like this may not run on other CPUs so, if this is enabled, models
+        should not be built into a model cache shared with different machines */
+    bool nativeArchitecture = false;
+
+    //! How many timesteps should be simulated to collect a profile for profile-guided optimisation?
+    /*! If this is non-zero, the generated Makefile first builds instrumented code and simulates it for this many
+        timesteps from its initial state. Code is then rebuilt with link-time optimisation, using the collected profile.
+        If the simulation fails, code is rebuilt without the profile. The profile is stored alongside the generated
+        code and only recollected if the generated code changes. This requires GCC */
+    unsigned int profileGuidedOptimisationTimesteps = 0;
+
+    void updateHash(boost::uuids::detail::sha1 &hash) const
+    {
+        // Superclass
+        PreferencesBase::updateHash(hash);
+
+        // Update hash with our preferences
+        Utils::updateHash(counterBasedRNG, hash);
+        Utils::updateHash(vectoriseNeuronUpdate, hash);
+        Utils::updateHash(enableTrace, hash);
+        Utils::updateHash(hugePageThreshold, hash);
+        Utils::updateHash(postsynapticPreInd, hash);
+        Utils::updateHash(splitModules, hash);
+        Utils::updateHash(profileGuidedOptimisationTimesteps, hash);
+
+        // **NOTE** link-time optimisation and native architecture only affect makefiles
+    }
+};
+
+//--------------------------------------------------------------------------
+// CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy
+//--------------------------------------------------------------------------
+//! Ways in which presynaptic updates can be distributed across threads
+enum class PresynapticUpdateStrategy
+{
+    ATOMIC,             //!< Spikes are distributed across threads which add input to postsynaptic neurons atomically
+    THREAD_ACCUMULATOR, //!< Spikes are distributed across threads which each accumulate input in a private buffer, reduced into postsynaptic input afterwards
+    POST_OWNERSHIP,     //!< Postsynaptic neurons are distributed across threads which each process all spikes for the postsynaptic neurons they own
 };
 
 //--------------------------------------------------------------------------
@@ -35,25 +111,23 @@ struct Preferences : public PreferencesBase
 class BACKEND_EXPORT Backend : public BackendBase
 {
 public:
-    Backend(const std::string &scalarType, const Preferences &preferences)
-    :   BackendBase(scalarType, preferences)
-    {
-    }
+    Backend(const std::string &scalarType, const Preferences &preferences);
 
     //--------------------------------------------------------------------------
     // CodeGenerator::BackendBase virtuals
     //--------------------------------------------------------------------------
     virtual void genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, 
-                                 HostHandler preambleHandler, HostHandler pushEGPHandler) const override;
+                                 HostHandler preambleHandler, HostHandler pushEGPHandler, ModuleHandler moduleHandler) const override;
 
     virtual void genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, 
-                                  HostHandler preambleHandler, HostHandler pushEGPHandler) const override;
+                                  HostHandler preambleHandler, HostHandler pushEGPHandler, ModuleHandler moduleHandler) const override;
 
     virtual void genCustomUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, 
                                  HostHandler preambleHandler, HostHandler pushEGPHandler) const override;
 
     virtual void genInit(CodeStream &os, const ModelSpecMerged &modelMerged, 
-                         HostHandler preambleHandler, HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler) const override;
+                         HostHandler preambleHandler, HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler,
+                         ModuleHandler moduleHandler) const override;
 
     virtual size_t getSynapticMatrixRowStride(const SynapseGroupInternal &sg) const override;
 
@@ -91,9 +165,9 @@ public:
 
     virtual void genPopVariableInit(CodeStream &os,const Substitutions &kernelSubs, Handler handler) const override;
     virtual void genVariableInit(CodeStream &os, const std::string &count, const std::string &indexVarName,
-                                 const Substitutions &kernelSubs, Handler handler) const override;
+                                 const Substitutions &kernelSubs, bool rngRequired, Handler handler) const override;
     virtual void genSparseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const override;
-    virtual void genDenseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const override;
+    virtual void genDenseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, bool rngRequired, Handler handler) const override;
     virtual void genKernelSynapseVariableInit(CodeStream &os, const SynapseInitGroupMerged &sg, const Substitutions &kernelSubs, Handler handler) const final;
     virtual void genKernelCustomUpdateVariableInit(CodeStream &os, const CustomWUUpdateInitGroupMerged &cu, const Substitutions &kernelSubs, Handler handler) const final;
 
@@ -132,6 +206,9 @@ public:
 
     virtual std::string getDeviceVarPrefix() const override{ return ""; }
 
+    //! Get list of files to copy into generated code
+    virtual std::vector<filesystem::path> getFilesToCopy(const ModelSpecMerged &modelMerged) const override;
+
     //! Should 'scalar' variables be implemented on device or can host variables be used directly?
     virtual bool isDeviceScalarRequired() const override { return false; }
 
@@ -143,6 +220,8 @@ public:
     virtual bool isPopulationRNGInitialisedOnDevice() const override { return false; }
 
     virtual bool isPostsynapticRemapRequired() const override{ return true; }
+    virtual bool isPostsynapticRemapPreIndRequired() const override{ return getPreferences<Preferences>().postsynapticPreInd; }
+    virtual bool isLazySynapseDynamicsSupported() const override{ return true; }
 
     //! Backends which support batch-parallelism might require an additional host reduction phase after reduction kernels
     virtual bool isHostReductionRequired() const override { return false; }
@@ -160,13 +239,95 @@ public:
     //! Get hash digest of this backends identification and the preferences it has been configured with
     virtual boost::uuids::detail::sha1::digest_type getHashDigest() const override;
 
+protected:
+    //--------------------------------------------------------------------------
+    // Protected virtuals
+    //--------------------------------------------------------------------------
+    //! Generate a loop over count elements with index variable indexVarName.
+    /*! If parallel is true, iterations are independent (apart from updates made using the atomic
+        operations below) so backends derived from this one may distribute them across threads.
+        If vectorise is true, iterations are also free of any loop-carried dependencies so the compiler can be told to vectorise them */
+    virtual void genParallelFor(CodeStream &os, const std::string &count, const std::string &indexVarName,
+                                bool parallel, HostHandler handler, bool vectorise = false) const;
+
+    //! Generate code to split count iterations into contiguous chunks, each of which may be processed on a different thread
+    /*! Within handler, beginVarName and endVarName hold the range of iterations in the chunk and
+        threadVarName the index of the thread processing it, which is less than the value of getNumThreads().
+        If weight is not empty, it is an expression giving the relative cost of iteration $(id), used to balance work
+        between threads. If loadName is not empty, the balance of work between threads is accumulated in loadName + "Load" */
+    virtual void genParallelForChunks(CodeStream &os, const std::string &count, const std::string &beginVarName,
+                                      const std::string &endVarName, const std::string &threadVarName, HostHandler handler,
+                                      const std::string &weight = "", const std::string &loadName = "") const;
+
+    //! Get expression for the number of threads generated code will use
+    virtual std::string getNumThreads() const{ return "1"; }
+
+    //! Get strategy to use for distributing the presynaptic update of this synapse group across threads
+    virtual PresynapticUpdateStrategy getPresynapticUpdateStrategy(const SynapseGroupInternal &sg) const;
+
+    //! Get code to add value to target, which may be updated concurrently within a parallel loop
+    virtual std::string getAtomicAdd(const std::string &target, const std::string &value) const
+    {
+        return target + " += " + value;
+    }
+
+    //! Get code to increment target and return its previous value, which may be updated concurrently within a parallel loop
+    virtual std::string getAtomicIncrement(const std::string &target) const
+    {
+        return target + "++";
+    }
+
+    //! Get code to bitwise OR value into target, which may be updated concurrently within a parallel loop
+    virtual std::string getAtomicOr(const std::string &target, const std::string &value) const
+    {
+        return target + " |= " + value;
+    }
+
+    //--------------------------------------------------------------------------
+    // Protected methods
+    //--------------------------------------------------------------------------
+    //! Does this synapse group use one of the built-in convolutional Toeplitz connectivity snippets?
+    /*! If so, rather than looping over diagonals, spikes are propagated individually using specialised code */
+    bool isToeplitzConvSpecialised(const SynapseGroupInternal &sg) const;
+
 private:
     //--------------------------------------------------------------------------
     // Private methods
     //--------------------------------------------------------------------------
     void genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg, const Substitutions &popSubs, bool trueSpike) const;
 
-    void genEmitSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, const Substitutions &subs, bool trueSpike, bool recordingEnabled) const;
+    //! Helper to generate code to process the presynaptic spike or spike-like event with index i
+    /*! popSubs should provide the addToInSyn (or addToInSynDelay) and addToPre functions. DENSE and BITMASK
+        connectivity is only processed for postsynaptic neurons in the range [postBegin, postEnd) */
+    void genPresynapticSpikeUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg, const Substitutions &popSubs, 
+                                   bool trueSpike, const std::string &postBegin, const std::string &postEnd) const;
+
+    //! Helper to generate code to process presynaptic spikes or spike-like events in the range [spikeBegin, spikeEnd)
+    /*! If the synapse group has a postsynaptic tile size, all spikes are processed against one tile of
+        postsynaptic neurons from the range [postBegin, postEnd) before moving onto the next */
+    void genPresynapticSpikeLoop(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg, const Substitutions &popSubs,
+                                 bool trueSpike, const std::string &spikeBegin, const std::string &spikeEnd,
+                                 const std::string &postBegin, const std::string &postEnd) const;
+
+    //! Helper to generate code to propagate the presynaptic spike ipre through built-in convolutional Toeplitz connectivity
+    /*! Kernel loops are unrolled if the kernel size is homogeneous across the merged group and the inner loop is over output channels */
+    void genToeplitzConvSpikeUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                                    const Substitutions &synSubs, bool trueSpike) const;
+
+    //! Helper to generate code to update the synapse dynamics of every synapse in group
+    /*! If timingName is not empty, the busy time of each thread is accumulated under this name */
+    void genSynapseDynamicsGroup(CodeStream &os, const ModelSpecMerged &modelMerged, const SynapseDynamicsGroupMerged &s,
+                                 const Substitutions &funcSubs, const std::string &timingName) const;
+
+    void genEmitSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, const Substitutions &subs, unsigned int batchSize, 
+                      bool trueSpike, bool recordingEnabled) const;
+
+    //! Helper to generate code to compact mask of neurons which spiked, written by vectorised neuron update, into spike queue
+    void genCompactSpikes(CodeStream &os, const NeuronUpdateGroupMerged &ng, unsigned int batchSize,
+                          bool trueSpike, bool recordingEnabled) const;
+
+    //! Helper to generate custom weight update code for a single synapse, reducing across batches if required
+    void genCustomUpdateWUSynapse(CodeStream &os, const ModelSpecMerged &modelMerged, const CustomUpdateWUGroupMerged &cg, Substitutions &synSubs) const;
 
     template<typename T>
     void genMergedStructArrayPush(CodeStream &os, const std::vector<T> &groups) const
@@ -177,7 +338,14 @@ private:
             assert(g.getMemorySpace().empty());
 
             // Implement merged group
-            os << "static Merged" << T::name << "Group" << g.getIndex() << " merged" << T::name << "Group" << g.getIndex() << "[" << g.getGroups().size() << "];" << std::endl;
+            // **NOTE** if modules are split, merged group arrays are also accessed from the modules of individual merged groups
+            if(!getPreferences<Preferences>().splitModules) {
+                os << "static ";
+            }
+            os << "Merged" << T::name << "Group" << g.getIndex() << " merged" << T::name << "Group" << g.getIndex() << "[" << g.getGroups().size() << "];" << std::endl;
+
+            // Implement array of group names to label trace events
+            genMergedGroupNames(os, g);
 
             // Write function to update
             os << "void pushMerged" << T::name << "Group" << g.getIndex() << "ToDevice(unsigned int idx, ";
@@ -195,6 +363,74 @@ private:
         }
     }
 
+    //! Helper to generate array of group names used to label trace events, if tracing is enabled
+    template<typename T>
+    void genMergedGroupNames(CodeStream &os, const T &g) const
+    {
+        if(getPreferences<Preferences>().enableTrace) {
+            os << "static const char *const merged" << T::name << "Group" << g.getIndex() << "Names[] = {";
+            for(const auto &m : g.getGroups()) {
+                os << "\"" << m.get().getName() << "\", ";
+            }
+            os << "};" << std::endl;
+        }
+    }
+
+    //! Helper to generate code for a merged group, either inline or, if modules are split, in a function within its own module
+    /*! \param params  parameter list of function containing merged group code
+        \param args    arguments to pass to this function from the main module */
+    template<typename T>
+    void genMergedGroupCode(CodeStream &os, const T &g, const std::string &functionPrefix, const std::string &params,
+                            const std::string &args, ModuleHandler moduleHandler, HostHandler handler) const
+    {
+        if(getPreferences<Preferences>().splitModules) {
+            const std::string groupName = "merged" + T::name + "Group" + std::to_string(g.getIndex());
+            const std::string functionName = functionPrefix + "Merged" + T::name + "Group" + std::to_string(g.getIndex());
+
+            // Generate module containing function to update merged group
+            moduleHandler(groupName,
+                          [&g, &groupName, &functionName, &params, handler, this](CodeStream &os)
+                          {
+                              // Generate struct definition, declare array of merged groups defined in main module and names
+                              g.generateStruct(os, *this, T::name);
+                              os << "extern Merged" << T::name << "Group" << g.getIndex() << " " << groupName << "[" << g.getGroups().size() << "];" << std::endl;
+                              genMergedGroupNames(os, g);
+                              os << std::endl;
+
+                              os << "void " << functionName << "(" << params << ")";
+                              {
+                                  CodeStream::Scope b(os);
+                                  handler(os);
+                              }
+                          });
+
+            // Declare and call function
+            os << "void " << functionName << "(" << params << ");" << std::endl;
+            os << functionName << "(" << args << ");" << std::endl;
+        }
+        else {
+            handler(os);
+        }
+    }
+
+    //! Helper to generate code for each merged group in groups using handler, in parallel if multiple code generation threads are used
+    /*! Each merged group's code is generated into a seperate stream and these are written to os in order so output matches serial generation */
+    template<typename T, typename G>
+    void genMergedGroups(CodeStream &os, const std::vector<T> &groups, G handler) const
+    {
+        std::vector<std::ostringstream> groupStreams(groups.size());
+        Utils::parallelFor(groups.size(), getPreferences().numCodeGenThreads,
+                           [&groups, &groupStreams, handler](size_t i)
+                           {
+                               CodeStream groupStream(groupStreams[i]);
+                               handler(groupStream, groups[i]);
+                           });
+
+        for(const auto &s : groupStreams) {
+            os << s.str();
+        }
+    }
+
     //! Helper to generate code to copy reduced custom update group variables back to memory
     /*! Because reduction operations are unnecessary in unbatched single-threaded CPU models so there's no need to actually reduce */
     void genWriteBackReductions(CodeStream &os, const CustomUpdateGroupMerged &cg, const std::string &idx) const;
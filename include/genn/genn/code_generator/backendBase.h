@@ -89,9 +89,19 @@ struct PreferencesBase
     //! Logging level to use for code generation
     plog::Severity logLevel = plog::info;
 
+    //! If set, built models are stored in and reused from this directory (e.g. ~/.cache/genn)
+    /*! Models are keyed by a hash of the model and its build configuration so any
+        build of an identical model, from any directory, can reuse the same library */
+    std::string modelCachePath = "";
+
+    //! Number of threads to use for generating code (0 uses one per hardware thread)
+    /*! Generated code is identical however many threads are used */
+    unsigned int numCodeGenThreads = 0;
+
     void updateHash(boost::uuids::detail::sha1 &hash) const
     {
-        // **NOTE** optimizeCode, debugCode and various compiler flags only affect makefiles/msbuild 
+        // **NOTE** optimizeCode, debugCode, various compiler flags and the model cache path only affect makefiles/msbuild 
+        // and the number of code generation threads doesn't affect generated code
 
         //! Update hash with preferences
         Utils::updateHash(enableBitmaskOptimisations, hash);
@@ -181,6 +191,9 @@ public:
     //--------------------------------------------------------------------------
     typedef std::function<void(CodeStream &)> HostHandler;
 
+    //! Callback used to generate an additional module, given its name and a handler to write its contents
+    typedef std::function<void(const std::string &, HostHandler)> ModuleHandler;
+
     typedef std::function<void(CodeStream &, Substitutions&)> Handler;
     
     template<typename T>
@@ -199,17 +212,19 @@ public:
     /*! \param os                       CodeStream to write function to
         \param modelMerged              merged model to generate code for
         \param preambleHandler          callback to write functions for pushing extra-global parameters
-        \param pushEGPHandler           callback to write required extra-global parameter pushing code to start of neuronUpdate function*/
+        \param pushEGPHandler           callback to write required extra-global parameter pushing code to start of neuronUpdate function
+        \param moduleHandler            callback to generate additional modules e.g. containing code for individual merged groups*/
     virtual void genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, 
-                                 HostHandler preambleHandler, HostHandler pushEGPHandler) const = 0;
+                                 HostHandler preambleHandler, HostHandler pushEGPHandler, ModuleHandler moduleHandler) const = 0;
 
     //! Generate platform-specific function to update the state of all synapses
     /*! \param os                           CodeStream to write function to
         \param modelMerged                  merged model to generate code for
         \param preambleHandler              callback to write functions for pushing extra-global parameters
-        \param pushEGPHandler               callback to write required extra-global parameter pushing code to start of synapseUpdate function*/
+        \param pushEGPHandler               callback to write required extra-global parameter pushing code to start of synapseUpdate function
+        \param moduleHandler                callback to generate additional modules e.g. containing code for individual merged groups*/
     virtual void genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, 
-                                  HostHandler preambleHandler, HostHandler pushEGPHandler) const = 0;
+                                  HostHandler preambleHandler, HostHandler pushEGPHandler, ModuleHandler moduleHandler) const = 0;
 
     //! Generate platform-specific functions to perform custom updates
     /*! \param os                           CodeStream to write function to
@@ -224,9 +239,11 @@ public:
         \param modelMerged                  merged model to generate code for
         \param preambleHandler              callback to write functions for pushing extra-global parameters
         \param initPushEGPHandler           callback to write required extra-global parameter pushing code to start of initialize function
-        \param initSparsePushEGPHandler     callback to write required extra-global parameter pushing code to start of initializeSparse function*/
+        \param initSparsePushEGPHandler     callback to write required extra-global parameter pushing code to start of initializeSparse function
+        \param moduleHandler                callback to generate additional modules e.g. containing code for individual merged groups*/
     virtual void genInit(CodeStream &os, const ModelSpecMerged &modelMerged, 
-                         HostHandler preambleHandler, HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler) const = 0;
+                         HostHandler preambleHandler, HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler,
+                         ModuleHandler moduleHandler) const = 0;
 
     //! Gets the stride used to access synaptic matrix rows, taking into account sparse data structure, padding etc
     virtual size_t getSynapticMatrixRowStride(const SynapseGroupInternal &sg) const = 0;
@@ -277,11 +294,13 @@ public:
     //! When generating merged structures what type to use for simulation RNGs
     virtual std::string getMergedGroupSimRNGType() const = 0;
 
+    //! Variable initialisation methods generate code to initialise one variable with the code generated by handler
+    /*! Where provided, rngRequired indicates whether this code uses $(rng) and hence whether it can be run in parallel */
     virtual void genPopVariableInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const = 0;
     virtual void genVariableInit(CodeStream &os, const std::string &count, const std::string &indexVarName,
-                                 const Substitutions &kernelSubs, Handler handler) const = 0;
+                                 const Substitutions &kernelSubs, bool rngRequired, Handler handler) const = 0;
     virtual void genSparseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const = 0;
-    virtual void genDenseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const = 0;
+    virtual void genDenseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, bool rngRequired, Handler handler) const = 0;
     virtual void genKernelSynapseVariableInit(CodeStream &os, const SynapseInitGroupMerged &sg, const Substitutions &kernelSubs, Handler handler) const = 0;
     virtual void genKernelCustomUpdateVariableInit(CodeStream &os, const CustomWUUpdateInitGroupMerged &cu, const Substitutions &kernelSubs, Handler handler) const = 0;
 
@@ -386,6 +405,12 @@ public:
     //! Different backends may implement synaptic plasticity differently. Does this one require a postsynaptic remapping data structure?
     virtual bool isPostsynapticRemapRequired() const = 0;
 
+    //! Does this backend also require the presynaptic index of each synapse to be stored in the postsynaptic remapping data structure?
+    virtual bool isPostsynapticRemapPreIndRequired() const = 0;
+
+    //! Can this backend defer lazy synapse dynamics until synapses are touched or does it need to run them every timestep?
+    virtual bool isLazySynapseDynamicsSupported() const = 0;
+
     //! Backends which support batch-parallelism might require an additional host reduction phase after reduction kernels
     virtual bool isHostReductionRequired() const = 0;
 
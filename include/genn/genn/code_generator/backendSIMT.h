@@ -123,13 +123,13 @@ public:
 
     virtual void genPopVariableInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const final;
     virtual void genVariableInit(CodeStream &os, const std::string &count, const std::string &indexVarName,
-                                 const Substitutions &kernelSubs, Handler handler) const final;
+                                 const Substitutions &kernelSubs, bool rngRequired, Handler handler) const final;
     virtual void genSparseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const final
     {
         genSynapseVariableRowInit(os, kernelSubs, handler);
     }
 
-    virtual void genDenseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const final
+    virtual void genDenseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, bool, Handler handler) const final
     {
         genSynapseVariableRowInit(os, kernelSubs, handler);
     }
@@ -145,6 +145,8 @@ public:
     virtual bool isPopulationRNGRequired() const final { return true; }
 
     virtual bool isPostsynapticRemapRequired() const final { return true; }
+    virtual bool isPostsynapticRemapPreIndRequired() const final { return false; }
+    virtual bool isLazySynapseDynamicsSupported() const final { return false; }
 
     //------------------------------------------------------------------------
     // Public API
@@ -0,0 +1,39 @@
+#pragma once
+
+// Standard C++ includes
+#include <sstream>
+#include <string>
+
+// GeNN includes
+#include "gennExport.h"
+
+//----------------------------------------------------------------------------
+// CodeGenerator::ChangedFileStream
+//----------------------------------------------------------------------------
+//! Output stream which buffers generated code in memory and, when closed or destroyed,
+//! only writes it to disk if it differs from the existing file contents. This leaves the
+//! modification times of unchanged files intact so they are not needlessly rebuilt
+namespace CodeGenerator
+{
+class GENN_EXPORT ChangedFileStream : public std::ostringstream
+{
+public:
+    ChangedFileStream(const std::string &filename);
+    ChangedFileStream(const ChangedFileStream&) = delete;
+    ~ChangedFileStream();
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Write buffered contents to file if they have changed
+    /*! \return true if file was written */
+    bool close();
+
+private:
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    const std::string m_Filename;
+    bool m_Closed;
+};
+}   // namespace CodeGenerator
@@ -27,15 +27,15 @@ GENN_EXPORT std::pair<std::vector<std::string>, MemAlloc> generateAll(const Mode
                                                                       const filesystem::path &sharePath, const filesystem::path &outputPath,
                                                                       bool forceRebuild = false);
 
-GENN_EXPORT void generateNeuronUpdate(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
-                                      const BackendBase &backend, const std::string &suffix = "");
+GENN_EXPORT std::vector<std::string> generateNeuronUpdate(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
+                                                          const BackendBase &backend, const std::string &suffix = "");
 
 GENN_EXPORT void generateCustomUpdate(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
                                       const BackendBase &backend, const std::string &suffix = "");
 
-GENN_EXPORT void generateSynapseUpdate(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
-                                       const BackendBase &backend, const std::string &suffix = "");
+GENN_EXPORT std::vector<std::string> generateSynapseUpdate(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
+                                                           const BackendBase &backend, const std::string &suffix = "");
 
-GENN_EXPORT void generateInit(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
-                              const BackendBase &backend, const std::string &suffix = "");
+GENN_EXPORT std::vector<std::string> generateInit(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
+                                                  const BackendBase &backend, const std::string &suffix = "");
 }
@@ -270,18 +270,37 @@ protected:
     template<typename T, typename P, typename H>
     void addHeterogeneousParams(const Snippet::Base::StringVec &paramNames, const std::string &suffix,
                                 P getParamValues, H isHeterogeneous)
+    {
+        addHeterogeneousParams<T>(paramNames, suffix, getParamValues, isHeterogeneous,
+                                  [](const G &, size_t) { return false; },
+                                  [](const G &) { return std::string(); });
+    }
+
+    template<typename T, typename P, typename H, typename D, typename N>
+    void addHeterogeneousParams(const Snippet::Base::StringVec &paramNames, const std::string &suffix,
+                                P getParamValues, H isHeterogeneous, D isDynamic, N getDynamicSuffix)
     {
         // Loop through params
         for(size_t p = 0; p < paramNames.size(); p++) {
             // If parameters is heterogeneous
             if((static_cast<const T*>(this)->*isHeterogeneous)(p)) {
-                // Add field
-                addScalarField(paramNames[p] + suffix,
-                               [p, getParamValues](const G &g, size_t)
-                               {
-                                   const auto &values = getParamValues(g);
-                                   return Utils::writePreciseString(values.at(p));
-                               });
+                // If parameter is dynamic, add field which gets pushed from runtime variable
+                // **NOTE** parameters being dynamic is included in group hashes so archetype is representative
+                if(isDynamic(getArchetype(), p)) {
+                    const std::string paramName = paramNames[p];
+                    addField("scalar", paramName + suffix,
+                             [paramName, getDynamicSuffix](const G &g, size_t) { return paramName + getDynamicSuffix(g); },
+                             FieldType::ScalarEGP);
+                }
+                // Otherwise, add field
+                else {
+                    addScalarField(paramNames[p] + suffix,
+                                   [p, getParamValues](const G &g, size_t)
+                                   {
+                                       const auto &values = getParamValues(g);
+                                       return Utils::writePreciseString(values.at(p));
+                                   });
+                }
             }
         }
     }
@@ -583,6 +602,9 @@ public:
     //! Should the var init derived parameter be implemented heterogeneously?
     bool isVarInitDerivedParamHeterogeneous(size_t varIndex, size_t paramIndex) const;
 
+    //! Should the constant value of a variable folded into code be implemented heterogeneously?
+    bool isConstantVarHeterogeneous(size_t varIndex) const;
+
     //! Should the current source parameter be implemented heterogeneously?
     bool isCurrentSourceParamHeterogeneous(size_t childIndex, size_t paramIndex) const;
 
@@ -595,6 +617,9 @@ public:
     //! Should the current source var init derived parameter be implemented heterogeneously?
     bool isCurrentSourceVarInitDerivedParamHeterogeneous(size_t childIndex, size_t varIndex, size_t paramIndex) const;
 
+    //! Should the constant value of a current source variable folded into code be implemented heterogeneously?
+    bool isCurrentSourceConstantVarHeterogeneous(size_t childIndex, size_t varIndex) const;
+
     //! Should the postsynaptic model parameter be implemented heterogeneously?
     bool isPSMParamHeterogeneous(size_t childIndex, size_t paramIndex) const;
 
@@ -604,6 +629,9 @@ public:
     //! Should the GLOBALG postsynaptic model variable be implemented heterogeneously?
     bool isPSMGlobalVarHeterogeneous(size_t childIndex, size_t paramIndex) const;
 
+    //! Should the constant value of a postsynaptic model variable folded into code be implemented heterogeneously?
+    bool isPSMConstantVarHeterogeneous(size_t childIndex, size_t varIndex) const;
+
     //! Should the postsynaptic model var init parameter be implemented heterogeneously?
     bool isPSMVarInitParamHeterogeneous(size_t childIndex, size_t varIndex, size_t paramIndex) const;
 
@@ -723,22 +751,35 @@ protected:
         return false;
     }
 
-    template<typename T = NeuronGroupMergedBase, typename C, typename H, typename V>
+    template<typename T = NeuronGroupMergedBase, typename C, typename H, typename V, typename D>
     void addHeterogeneousChildParams(const Snippet::Base::StringVec &paramNames,
                                      const std::vector<std::vector<C>> &sortedGroupChildren,
                                      size_t childIndex, const std::string &prefix,
-                                     H isChildParamHeterogeneousFn, V getValueFn)
+                                     H isChildParamHeterogeneousFn, V getValueFn, D isChildParamDynamicFn)
     {
         // Loop through parameters
         for(size_t p = 0; p < paramNames.size(); p++) {
             // If parameter is heterogeneous
             if((static_cast<const T*>(this)->*isChildParamHeterogeneousFn)(childIndex, p)) {
-                addScalarField(paramNames[p] + prefix + std::to_string(childIndex),
-                               [&sortedGroupChildren, childIndex, p, getValueFn](const NeuronGroupInternal &, size_t groupIndex)
-                               {
-                                   const auto *child = sortedGroupChildren.at(groupIndex).at(childIndex);
-                                   return Utils::writePreciseString((child->*getValueFn)().at(p));
-                               });
+                // If parameter is dynamic, add field which gets pushed from runtime variable
+                // **NOTE** parameters being dynamic is included in child hashes so archetype is representative
+                if((sortedGroupChildren.front().at(childIndex)->*isChildParamDynamicFn)(p)) {
+                    const std::string paramName = paramNames[p];
+                    addField("scalar", paramName + prefix + std::to_string(childIndex),
+                             [&sortedGroupChildren, childIndex, paramName](const NeuronGroupInternal &, size_t groupIndex)
+                             {
+                                 return paramName + sortedGroupChildren.at(groupIndex).at(childIndex)->getName();
+                             },
+                             FieldType::ScalarEGP);
+                }
+                else {
+                    addScalarField(paramNames[p] + prefix + std::to_string(childIndex),
+                                   [&sortedGroupChildren, childIndex, p, getValueFn](const NeuronGroupInternal &, size_t groupIndex)
+                                   {
+                                       const auto *child = sortedGroupChildren.at(groupIndex).at(childIndex);
+                                       return Utils::writePreciseString((child->*getValueFn)().at(p));
+                                   });
+                }
             }
         }
     }
@@ -1018,6 +1059,9 @@ public:
     //! Should the GLOBALG weight update model variable be implemented heterogeneously?
     bool isWUGlobalVarHeterogeneous(size_t varIndex) const;
 
+    //! Should the constant value of a weight update model variable folded into code be implemented heterogeneously?
+    bool isWUConstantVarHeterogeneous(size_t varIndex) const;
+
     //! Should the weight update model variable initialization parameter be implemented heterogeneously?
     bool isWUVarInitParamHeterogeneous(size_t varIndex, size_t paramIndex) const;
     
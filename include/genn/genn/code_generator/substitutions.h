@@ -158,8 +158,14 @@ private:
     //--------------------------------------------------------------------------
     // Private API
     //--------------------------------------------------------------------------
-    void applyFuncs(std::string &code) const;
-    void applyVars(std::string &code) const;
+    //! Find function substitution for source (taking arguments or not) in this or parent substitutions
+    const std::pair<unsigned int, std::string> *findFuncSubstitution(const std::string &source, bool hasArguments) const;
+
+    //! Find variable substitution for source in this or parent substitutions, optionally returning the substitutions it was found in
+    const std::string *findVarSubstitution(const std::string &source, const Substitutions **scope = nullptr) const;
+
+    //! Append code to output, resolving variable and function references in a single pass
+    void applyToOutput(const std::string &code, std::string &output, unsigned int depth) const;
 
     //--------------------------------------------------------------------------
     // Members
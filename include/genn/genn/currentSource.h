@@ -34,6 +34,18 @@ public:
         and only applies to extra global parameters which are pointers. */
     void setExtraGlobalParamLocation(const std::string &paramName, VarLocation loc);
 
+    //! Should current source model state variable always be implemented as an array?
+    /*! If variable elimination is enabled with ModelSpec::setEliminateVars, variables which
+        are not referenced by any code or are read-only and initialised to a constant are not
+        allocated. Retain variables which need to be pushed or pulled from the host. */
+    void setVarRetained(const std::string &varName, bool retained);
+
+    //! Set whether current source model parameter is dynamic
+    /*! Dynamic parameters are not baked into the generated code so can be
+        changed at runtime, using the generated set<param><current source>
+        function, without regenerating or recompiling the model. */
+    void setParamDynamic(const std::string &paramName, bool dynamic = true);
+
     //------------------------------------------------------------------------
     // Public const methods
     //------------------------------------------------------------------------
@@ -59,6 +71,17 @@ public:
     /*! This is only used by extra global parameters which are pointers*/
     VarLocation getExtraGlobalParamLocation(size_t index) const{ return m_ExtraGlobalParamLocation.at(index); }
 
+    //! Is current source model parameter dynamic?
+    bool isParamDynamic(size_t index) const{ return m_DynamicParams.at(index); }
+
+    //! Is current source model state variable implemented as an array?
+    /*! NOTE: this can only be called after model is finalized */
+    bool isVarArrayRequired(const std::string &varName) const;
+
+    //! Is current source model state variable implemented as an array?
+    /*! NOTE: this can only be called after model is finalized */
+    bool isVarArrayRequired(size_t index) const{ return m_VarArrayRequired.at(index); }
+
 protected:
     CurrentSource(const std::string &name, const CurrentSourceModels::Base *currentSourceModel,
                   const std::vector<double> &params, const std::vector<Models::VarInit> &varInitialisers,
@@ -70,6 +93,10 @@ protected:
     //------------------------------------------------------------------------
     void initDerivedParams(double dt);
 
+    //! Eliminate arrays for variables which aren't referenced and fold read-only variables initialised to constants
+    /*! \param customUpdateVarRefs names of this current source's variables referenced by custom updates */
+    void eliminateVars(const std::set<std::string> &customUpdateVarRefs);
+
     //------------------------------------------------------------------------
     // Protected const methods
     //------------------------------------------------------------------------
@@ -77,6 +104,12 @@ protected:
 
     const std::vector<double> &getDerivedParams() const{ return m_DerivedParams; }
 
+    //! Get parameter values with any dynamic parameters zeroed for hashing
+    std::vector<double> getHashableParams() const{ return Utils::zeroDynamicParams(m_Params, m_DynamicParams); }
+
+    //! Has read-only variable been folded into code as its constant initial value?
+    bool isVarConstantFolded(size_t index) const{ return m_VarConstantFolded.at(index); }
+
     //! Does this current source require an RNG to simulate
     bool isSimRNGRequired() const;
 
@@ -107,6 +140,18 @@ private:
 
     const NeuronGroupInternal *m_TrgNeuronGroup;
 
+    //! Vector specifying which parameters are dynamic
+    std::vector<bool> m_DynamicParams;
+
+    //! Vector specifying which variables should never be eliminated
+    std::vector<bool> m_VarRetained;
+
+    //! Vector specifying which variables are implemented as arrays
+    std::vector<bool> m_VarArrayRequired;
+
+    //! Vector specifying which variables have been folded into code as constants
+    std::vector<bool> m_VarConstantFolded;
+
     //! Location of individual state variables
     std::vector<VarLocation> m_VarLocation;
 
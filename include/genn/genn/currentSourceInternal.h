@@ -20,7 +20,10 @@ public:
 
     using CurrentSource::getTrgNeuronGroup;
     using CurrentSource::initDerivedParams;
+    using CurrentSource::eliminateVars;
     using CurrentSource::getDerivedParams;
+    using CurrentSource::getHashableParams;
+    using CurrentSource::isVarConstantFolded;
     using CurrentSource::isSimRNGRequired;
     using CurrentSource::isInitRNGRequired;
     using CurrentSource::isZeroCopyEnabled;
@@ -26,6 +26,12 @@ public:
     /*! This is ignored for simulations on hardware with a single memory space */
     void setVarLocation(const std::string &varName, VarLocation loc);
 
+    //! Set whether custom update model parameter is dynamic
+    /*! Dynamic parameters are not baked into the generated code so can be
+        changed at runtime, using the generated set<param><custom update>
+        function, without regenerating or recompiling the model. */
+    void setParamDynamic(const std::string &paramName, bool dynamic = true);
+
     //------------------------------------------------------------------------
     // Public const methods
     //------------------------------------------------------------------------
@@ -47,13 +53,16 @@ public:
     //! Is var init code required for any variables in this custom update group's custom update model?
     bool isVarInitRequired() const;
 
+    //! Is custom update model parameter dynamic?
+    bool isParamDynamic(size_t index) const{ return m_DynamicParams.at(index); }
+
 protected:
     CustomUpdateBase(const std::string &name, const std::string &updateGroupName,
                      const CustomUpdateModels::Base *customUpdateModel, const std::vector<double> &params,
                      const std::vector<Models::VarInit> &varInitialisers,
                      VarLocation defaultVarLocation, VarLocation defaultExtraGlobalParamLocation)
     :   m_Name(name), m_UpdateGroupName(updateGroupName), m_CustomUpdateModel(customUpdateModel), m_Params(params), 
-        m_VarInitialisers(varInitialisers), m_VarLocation(varInitialisers.size(), defaultVarLocation),
+        m_VarInitialisers(varInitialisers), m_DynamicParams(params.size(), false), m_VarLocation(varInitialisers.size(), defaultVarLocation),
         m_ExtraGlobalParamLocation(customUpdateModel->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation),
         m_Batched(false)
     {
@@ -73,6 +82,9 @@ protected:
     //------------------------------------------------------------------------
     const std::vector<double> &getDerivedParams() const{ return m_DerivedParams; }
 
+    //! Get parameter values with any dynamic parameters zeroed for hashing
+    std::vector<double> getHashableParams() const{ return Utils::zeroDynamicParams(m_Params, m_DynamicParams); }
+
     //! Does this current source group require an RNG for it's init code
     bool isInitRNGRequired() const;
 
@@ -186,6 +198,9 @@ private:
     std::vector<double> m_DerivedParams;
     std::vector<Models::VarInit> m_VarInitialisers;
 
+    //! Vector specifying which parameters are dynamic
+    std::vector<bool> m_DynamicParams;
+
     //! Location of individual state variables
     std::vector<VarLocation> m_VarLocation;
 
@@ -20,6 +20,7 @@ public:
 
     using CustomUpdateBase::initDerivedParams;
     using CustomUpdateBase::getDerivedParams;
+    using CustomUpdateBase::getHashableParams;
     using CustomUpdateBase::isInitRNGRequired;
     using CustomUpdateBase::isZeroCopyEnabled;
     using CustomUpdateBase::isBatched;
@@ -50,6 +51,7 @@ public:
 
     using CustomUpdateBase::initDerivedParams;
     using CustomUpdateBase::getDerivedParams;
+    using CustomUpdateBase::getHashableParams;
     using CustomUpdateBase::isInitRNGRequired;
     using CustomUpdateBase::isZeroCopyEnabled;
     using CustomUpdateBase::isBatched;
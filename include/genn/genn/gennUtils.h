@@ -2,14 +2,17 @@
 
 // Standard C++ includes
 #include <array>
+#include <functional>
 #include <iomanip>
 #include <limits>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <vector>
 
 // Standard C includes
+#include <cmath>
 #include <cstring>
 
 // Boost includes
@@ -85,6 +88,62 @@ void validateVecNames(const std::vector<T> &vec, const std::string &description)
     }
 }
 
+//--------------------------------------------------------------------------
+//! \brief Get copy of parameter values with those marked as dynamic zeroed
+/*! Dynamic parameter values are not baked into generated code so should not be included in hashes */
+//--------------------------------------------------------------------------
+GENN_EXPORT std::vector<double> zeroDynamicParams(const std::vector<double> &params, const std::vector<bool> &dynamicParams);
+
+//--------------------------------------------------------------------------
+//! \brief Call function with each index in [0, count) using up to numThreads threads (0 uses one per hardware thread)
+/*! The calling thread also processes indices so nested calls cannot deadlock and, if
+    any call throws, the first exception is rethrown once all threads have finished */
+//--------------------------------------------------------------------------
+GENN_EXPORT void parallelFor(size_t count, unsigned int numThreads, std::function<void(size_t)> function);
+
+//--------------------------------------------------------------------------
+//! \brief Check that none of the derived parameters in vector are calculated from dynamic parameters
+/*! Derived parameters are only evaluated when the model is finalized so would not follow dynamic parameters
+    changed at runtime. As they are defined by arbitrary functions, dependencies can only be detected by
+    re-evaluating each derived parameter with each dynamic parameter set to a selection of other values.
+    This is a best-effort heuristic: a derived parameter which only depends on a dynamic parameter
+    outside of these values (e.g. through a threshold far from the build value) will not be detected. */
+//--------------------------------------------------------------------------
+template<typename D>
+void validateDynamicParams(const std::vector<D> &derivedParams, const std::vector<std::string> &paramNames,
+                           const std::vector<double> &params, const std::vector<bool> &dynamicParams, 
+                           double dt, const std::string &description)
+{
+    for(size_t p = 0; p < params.size(); p++) {
+        if(dynamicParams[p]) {
+            // Values to perturb dynamic parameter to, chosen to cross zero, flip sign, 
+            // scale in both directions and straddle integer boundaries
+            const double value = params[p];
+            const double perturbations[] = {0.0, 1.0, -1.0, -value, value * 0.5, value * 2.0, 
+                                            value * 10.0, value + 0.5, value - 0.5, value + 1.0, value - 1.0};
+            for(double perturbation : perturbations) {
+                if(perturbation == value) {
+                    continue;
+                }
+
+                // Perturb dynamic parameter
+                auto perturbedParams = params;
+                perturbedParams[p] = perturbation;
+
+                // Give error if any derived parameters change
+                for(const auto &d : derivedParams) {
+                    const double derivedValue = d.func(params, dt);
+                    const double perturbedDerivedValue = d.func(perturbedParams, dt);
+                    if(derivedValue != perturbedDerivedValue && !(std::isnan(derivedValue) && std::isnan(perturbedDerivedValue))) {
+                        throw std::runtime_error("Derived parameter '" + d.name + "' of " + description 
+                                                 + " depends on dynamic parameter '" + paramNames[p] + "'");
+                    }
+                }
+            }
+        }
+    }
+}
+
 //--------------------------------------------------------------------------
 //! \brief This function writes a floating point value to a stream -setting the precision so no digits are lost
 //--------------------------------------------------------------------------
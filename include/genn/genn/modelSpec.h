@@ -246,6 +246,13 @@ public:
     /*! This can significantly reduce the cost of updating neuron populations but means that per-synaptic group per and postsynaptic variables cannot be retrieved */
     void setFusePrePostWeightUpdateModels(bool fuse){ m_ShouldFusePrePostWeightUpdateModels = fuse; }
 
+    //! Should unreferenced state variables be eliminated and read-only state variables initialised to constants be folded into code?
+    /*! This applies to neuron, current source, individual postsynaptic model and individual per-synapse weight update model
+        variables. It can significantly reduce the memory and bandwidth used by a model but means that these variables cannot be
+        pushed or pulled unless they are retained with NeuronGroup::setVarRetained, CurrentSource::setVarRetained,
+        SynapseGroup::setPSVarRetained or SynapseGroup::setWUVarRetained */
+    void setEliminateVars(bool eliminate){ m_ShouldEliminateVars = eliminate; }
+
     void setBatchSize(unsigned int batchSize) { m_BatchSize = batchSize;  }
 
     //! Gets the name of the neuronal network model
@@ -884,6 +891,9 @@ private:
     /*! This can significantly reduce the cost of updating neuron populations but means that per-synaptic group per and postsynaptic variables cannot be retrieved */
     bool m_ShouldFusePrePostWeightUpdateModels;
 
+    //! Should unreferenced neuron variables be eliminated and read-only neuron variables initialised to constants be folded into code?
+    bool m_ShouldEliminateVars;
+
     //! Batch size of this model - efficiently duplicates model
     unsigned int m_BatchSize;
 };
@@ -274,4 +274,15 @@ GENN_EXPORT void updateHash(const Base::Var &v, boost::uuids::detail::sha1 &hash
 GENN_EXPORT void updateHash(const Base::VarRef &v, boost::uuids::detail::sha1 &hash);
 GENN_EXPORT void updateHash(const VarReference &v, boost::uuids::detail::sha1 &hash);
 GENN_EXPORT void updateHash(const WUVarReference &v, boost::uuids::detail::sha1 &hash);
+
+//----------------------------------------------------------------------------
+// Variable elimination
+//----------------------------------------------------------------------------
+//! Determine which variables can be eliminated because they aren't referenced by any of the code strings
+//! and which can be folded into code because they are read-only and initialised to a constant
+/*! Variables flagged in retained are always implemented as arrays */
+GENN_EXPORT void eliminateVars(const Base::VarVec &vars, const std::vector<VarInit> &varInitialisers,
+                               const std::vector<std::string> &codeStrings, const std::vector<bool> &retained,
+                               const std::string &description, std::vector<bool> &varArrayRequired,
+                               std::vector<bool> &varConstantFolded);
 } // Models
@@ -123,6 +123,18 @@ public:
     //! Enables and disable spike event recording for this population
     void setSpikeEventRecordingEnabled(bool enabled) { m_SpikeEventRecordingEnabled = enabled; }
 
+    //! Should neuron model state variable always be implemented as an array?
+    /*! If variable elimination is enabled with ModelSpec::setEliminateVars, variables which
+        are not referenced by any code or are read-only and initialised to a constant are not
+        allocated. Retain variables which need to be pushed or pulled from the host. */
+    void setVarRetained(const std::string &varName, bool retained);
+
+    //! Set whether neuron model parameter is dynamic
+    /*! Dynamic parameters are not baked into the generated code so can be
+        changed at runtime, using the generated set<param><population> function,
+        without regenerating or recompiling the model. */
+    void setParamDynamic(const std::string &paramName, bool dynamic = true);
+
     //------------------------------------------------------------------------
     // Public const methods
     //------------------------------------------------------------------------
@@ -180,6 +192,17 @@ public:
     /*! This is only used by extra global parameters which are pointers*/
     VarLocation getExtraGlobalParamLocation(size_t index) const{ return m_ExtraGlobalParamLocation.at(index); }
 
+    //! Is neuron model state variable implemented as an array?
+    /*! NOTE: this can only be called after model is finalized */
+    bool isVarArrayRequired(const std::string &varName) const;
+
+    //! Is neuron model state variable implemented as an array?
+    /*! NOTE: this can only be called after model is finalized */
+    bool isVarArrayRequired(size_t index) const{ return m_VarArrayRequired.at(index); }
+
+    //! Is neuron model parameter dynamic?
+    bool isParamDynamic(size_t index) const{ return m_DynamicParams.at(index); }
+
     //! Is spike recording enabled for this population?
     bool isSpikeRecordingEnabled() const { return m_SpikeRecordingEnabled; }
 
@@ -225,6 +248,10 @@ protected:
     //! add input current source
     void injectCurrent(CurrentSourceInternal *source);
 
+    //! Eliminate arrays for variables which aren't referenced and fold read-only variables initialised to constants
+    /*! \param customUpdateVarRefs names of this group's variables referenced by custom updates */
+    void eliminateVars(const std::set<std::string> &customUpdateVarRefs);
+
     //------------------------------------------------------------------------
     // Protected const methods
     //------------------------------------------------------------------------
@@ -261,6 +288,15 @@ protected:
     bool isVarQueueRequired(const std::string &var) const;
     bool isVarQueueRequired(size_t index) const{ return m_VarQueueRequired[index]; }
 
+    //! Has read-only variable been folded into code as its constant initial value?
+    bool isVarConstantFolded(size_t index) const{ return m_VarConstantFolded[index]; }
+
+    //! Get parameter values with any dynamic parameters zeroed for hashing
+    std::vector<double> getHashableParams() const{ return Utils::zeroDynamicParams(m_Params, m_DynamicParams); }
+
+    //! Get flags specifying which parameters are dynamic
+    const std::vector<bool> &getDynamicParams() const{ return m_DynamicParams; }
+
     //! Updates hash with neuron group
     /*! NOTE: this can only be called after model is finalized */
     boost::uuids::detail::sha1::digest_type getHashDigest() const;
@@ -303,9 +339,21 @@ private:
     unsigned int m_NumDelaySlots;
     std::vector<CurrentSourceInternal*> m_CurrentSources;
 
+    //! Vector specifying which parameters are dynamic
+    std::vector<bool> m_DynamicParams;
+
     //! Vector specifying which variables require queues
     std::vector<bool> m_VarQueueRequired;
 
+    //! Vector specifying which variables should never be eliminated
+    std::vector<bool> m_VarRetained;
+
+    //! Vector specifying which variables are implemented as arrays
+    std::vector<bool> m_VarArrayRequired;
+
+    //! Vector specifying which variables have been folded into code as constants
+    std::vector<bool> m_VarConstantFolded;
+
     //! Location of spikes from neuron group
     VarLocation m_SpikeLocation;
 
@@ -26,6 +26,7 @@ public:
     using NeuronGroup::initDerivedParams;
     using NeuronGroup::fusePrePostSynapses;
     using NeuronGroup::injectCurrent;
+    using NeuronGroup::eliminateVars;
     using NeuronGroup::getFusedPSMInSyn;
     using NeuronGroup::getFusedWUPostInSyn;
     using NeuronGroup::getFusedPreOutputOutSyn;
@@ -33,12 +34,15 @@ public:
     using NeuronGroup::getOutSyn;
     using NeuronGroup::getCurrentSources;
     using NeuronGroup::getDerivedParams;
+    using NeuronGroup::getHashableParams;
+    using NeuronGroup::getDynamicParams;
     using NeuronGroup::getSpikeEventCondition;
     using NeuronGroup::getFusedInSynWithPostCode;
     using NeuronGroup::getFusedOutSynWithPreCode;
     using NeuronGroup::getFusedInSynWithPostVars;
     using NeuronGroup::getFusedOutSynWithPreVars;
     using NeuronGroup::isVarQueueRequired;
+    using NeuronGroup::isVarConstantFolded;
     using NeuronGroup::getHashDigest;
     using NeuronGroup::getInitHashDigest;
     using NeuronGroup::getSpikeQueueUpdateHashDigest;
@@ -197,6 +197,17 @@ public:
     //------------------------------------------------------------------------
     // Public methods
     //------------------------------------------------------------------------
+    //! Find the index of a named parameter
+    size_t getParamIndex(const std::string &paramName) const
+    {
+        const auto paramNames = getParamNames();
+        auto p = std::find(paramNames.cbegin(), paramNames.cend(), paramName);
+        if(p == paramNames.cend()) {
+            throw std::runtime_error("Cannot find parameter '" + paramName + "'");
+        }
+        return std::distance(paramNames.cbegin(), p);
+    }
+
     //! Find the index of a named extra global parameter
     size_t getExtraGlobalParamIndex(const std::string &paramName) const
     {
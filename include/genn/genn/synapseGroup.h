@@ -2,6 +2,7 @@
 
 // Standard includes
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -65,6 +66,31 @@ public:
         and only applies to extra global parameters which are pointers. */
     void setPSExtraGlobalParamLocation(const std::string &paramName, VarLocation loc);
 
+    //! Should weight update model per-synapse state variable always be implemented as an array?
+    /*! If variable elimination is enabled with ModelSpec::setEliminateVars, individual per-synapse
+        variables which are not referenced by any code or are read-only and initialised to a constant
+        are not allocated. Retain variables which need to be pushed or pulled from the host. */
+    void setWUVarRetained(const std::string &varName, bool retained);
+
+    //! Should postsynaptic model state variable always be implemented as an array?
+    /*! If variable elimination is enabled with ModelSpec::setEliminateVars, individual postsynaptic
+        model variables which are not referenced by any code or are read-only and initialised to a
+        constant are not allocated. Retain variables which need to be pushed or pulled from the host. */
+    void setPSVarRetained(const std::string &varName, bool retained);
+
+    //! Set whether weight update model parameter is dynamic
+    /*! Dynamic parameters are not baked into the generated code so can be
+        changed at runtime, using the generated set<param><synapse group>
+        function, without regenerating or recompiling the model. */
+    void setWUParamDynamic(const std::string &paramName, bool dynamic = true);
+
+    //! Set whether postsynaptic model parameter is dynamic
+    /*! Dynamic parameters are not baked into the generated code so can be
+        changed at runtime, using the generated set<param><synapse group>
+        function, without regenerating or recompiling the model. Synapse groups
+        with dynamic postsynaptic model parameters are never fused. */
+    void setPSParamDynamic(const std::string &paramName, bool dynamic = true);
+
     //! Set name of neuron input variable postsynaptic model will target
     /*! This should either be 'Isyn' or the name of one of the postsynaptic neuron's additional input variables. */
     void setPSTargetVar(const std::string &varName);
@@ -108,6 +134,12 @@ public:
     // **TODO** this shouldn't be in SynapseGroup - it's backend-specific
     void setNumThreadsPerSpike(unsigned int numThreadsPerSpike);
 
+    //! Set how many postsynaptic neurons CPU implementation processes all of a timestep's spikes against at a time
+    /*! Use with synaptic matrix types with SynapseMatrixConnectivity::DENSE or SynapseMatrixConnectivity::BITMASK
+        to keep tiles of postsynaptic input in cache when many presynaptic neurons spike each timestep.
+        The default of zero processes each spike's entire row in turn */
+    void setPostTileSize(unsigned int postTileSize);
+
     //! Sets the number of delay steps used to delay postsynaptic spikes travelling back along dendrites to synapses
     void setBackPropDelaySteps(unsigned int timesteps);
 
@@ -121,6 +153,7 @@ public:
 
     SpanType getSpanType() const{ return m_SpanType; }
     unsigned int getNumThreadsPerSpike() const{ return m_NumThreadsPerSpike; }
+    unsigned int getPostTileSize() const{ return m_PostTileSize; }
     unsigned int getDelaySteps() const{ return m_DelaySteps; }
     unsigned int getBackPropDelaySteps() const{ return m_BackPropDelaySteps; }
     unsigned int getMaxConnections() const;
@@ -180,6 +213,12 @@ public:
     const std::vector<Models::VarInit> &getPSVarInitialisers() const{ return m_PSVarInitialisers; }
     const std::vector<double> getPSConstInitVals() const;
 
+    //! Is weight update model parameter dynamic?
+    bool isWUParamDynamic(size_t index) const{ return m_WUDynamicParams.at(index); }
+
+    //! Is postsynaptic model parameter dynamic?
+    bool isPSParamDynamic(size_t index) const{ return m_PSDynamicParams.at(index); }
+
     const InitSparseConnectivitySnippet::Init &getConnectivityInitialiser() const{ return m_SparseConnectivityInitialiser; }
     const InitToeplitzConnectivitySnippet::Init &getToeplitzConnectivityInitialiser() const { return m_ToeplitzConnectivityInitialiser; }
 
@@ -225,6 +264,22 @@ public:
     /*! This is only used by extra global parameters which are pointers*/
     VarLocation getPSExtraGlobalParamLocation(size_t index) const{ return m_PSExtraGlobalParamLocation.at(index); }
 
+    //! Is weight update model per-synapse state variable implemented as an array?
+    /*! NOTE: this can only be called after model is finalized */
+    bool isWUVarArrayRequired(const std::string &var) const;
+
+    //! Is weight update model per-synapse state variable implemented as an array?
+    /*! NOTE: this can only be called after model is finalized */
+    bool isWUVarArrayRequired(size_t index) const;
+
+    //! Is postsynaptic model state variable implemented as an array?
+    /*! NOTE: this can only be called after model is finalized */
+    bool isPSVarArrayRequired(const std::string &var) const;
+
+    //! Is postsynaptic model state variable implemented as an array?
+    /*! NOTE: this can only be called after model is finalized */
+    bool isPSVarArrayRequired(size_t index) const{ return m_PSVarArrayRequired.at(index); }
+
     //! Get name of neuron input variable postsynaptic model will target
     /*! This will either be 'Isyn' or the name of one of the postsynaptic neuron's additional input variables. */
     const std::string &getPSTargetVar() const{ return m_PSTargetVar; }
@@ -265,6 +320,9 @@ public:
     //! Does this synapse group require a RNG for any sort of initialization
     bool isHostInitRNGRequired() const;
 
+    //! Does this synapse group's weight update model have lazy synapse dynamics?
+    bool isLazySynapseDynamicsRequired() const;
+
     //! Is var init code required for any variables in this synapse group's weight update model?
     bool isWUVarInitRequired() const;
 
@@ -299,6 +357,12 @@ protected:
     
     void initDerivedParams(double dt);
 
+    //! Eliminate arrays for individual weight update and postsynaptic model variables which
+    //! aren't referenced and fold read-only variables initialised to constants
+    /*! \param wuCustomUpdateVarRefs names of this group's weight update model variables referenced by custom updates
+        \param psCustomUpdateVarRefs names of this group's postsynaptic model variables referenced by custom updates */
+    void eliminateVars(const std::set<std::string> &wuCustomUpdateVarRefs, const std::set<std::string> &psCustomUpdateVarRefs);
+
     //------------------------------------------------------------------------
     // Protected const methods
     //------------------------------------------------------------------------
@@ -308,8 +372,20 @@ protected:
     const std::vector<double> &getWUDerivedParams() const{ return m_WUDerivedParams; }
     const std::vector<double> &getPSDerivedParams() const{ return m_PSDerivedParams; }
 
+    //! Get weight update model parameter values with any dynamic parameters zeroed for hashing
+    std::vector<double> getHashableWUParams() const{ return Utils::zeroDynamicParams(m_WUParams, m_WUDynamicParams); }
+
+    //! Get postsynaptic model parameter values with any dynamic parameters zeroed for hashing
+    std::vector<double> getHashablePSParams() const{ return Utils::zeroDynamicParams(m_PSParams, m_PSDynamicParams); }
+
     const SynapseGroupInternal *getWeightSharingMaster() const { return m_WeightSharingMaster; }
 
+    //! Has read-only weight update model per-synapse variable been folded into code as its constant initial value?
+    bool isWUVarConstantFolded(size_t index) const;
+
+    //! Has read-only postsynaptic model variable been folded into code as its constant initial value?
+    bool isPSVarConstantFolded(size_t index) const{ return m_PSVarConstantFolded.at(index); }
+
     //!< Does the event threshold needs to be retested in the synapse kernel?
     /*! This is required when the pre-synaptic neuron population's outgoing synapse groups require different event threshold */
     bool isEventThresholdReTestRequired() const{ return m_EventThresholdReTestRequired; }
@@ -413,6 +489,9 @@ private:
     //! How many threads CUDA implementation uses to process each spike when span type is PRESYNAPTIC
     unsigned int m_NumThreadsPerSpike;
 
+    //! How many postsynaptic neurons CPU implementation processes all spikes against at a time (zero if propagation isn't blocked)
+    unsigned int m_PostTileSize;
+
     //! Global synaptic conductance delay for the group (in time steps)
     unsigned int m_DelaySteps;
 
@@ -489,6 +568,30 @@ private:
     //! Initialisers for post synapse model variables
     std::vector<Models::VarInit> m_PSVarInitialisers;
 
+    //! Vector specifying which weight update model parameters are dynamic
+    std::vector<bool> m_WUDynamicParams;
+
+    //! Vector specifying which postsynaptic model parameters are dynamic
+    std::vector<bool> m_PSDynamicParams;
+
+    //! Vector specifying which weight update model per-synapse variables should never be eliminated
+    std::vector<bool> m_WUVarRetained;
+
+    //! Vector specifying which weight update model per-synapse variables are implemented as arrays
+    std::vector<bool> m_WUVarArrayRequired;
+
+    //! Vector specifying which weight update model per-synapse variables have been folded into code as constants
+    std::vector<bool> m_WUVarConstantFolded;
+
+    //! Vector specifying which postsynaptic model variables should never be eliminated
+    std::vector<bool> m_PSVarRetained;
+
+    //! Vector specifying which postsynaptic model variables are implemented as arrays
+    std::vector<bool> m_PSVarArrayRequired;
+
+    //! Vector specifying which postsynaptic model variables have been folded into code as constants
+    std::vector<bool> m_PSVarConstantFolded;
+
     //! Location of individual per-synapse state variables
     std::vector<VarLocation> m_WUVarLocation;
 
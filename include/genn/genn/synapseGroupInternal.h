@@ -30,8 +30,12 @@ public:
     using SynapseGroup::getSrcNeuronGroup;
     using SynapseGroup::getTrgNeuronGroup;
     using SynapseGroup::getWeightSharingMaster;
+    using SynapseGroup::isWUVarConstantFolded;
+    using SynapseGroup::isPSVarConstantFolded;
     using SynapseGroup::getWUDerivedParams;
     using SynapseGroup::getPSDerivedParams;
+    using SynapseGroup::getHashableWUParams;
+    using SynapseGroup::getHashablePSParams;
     using SynapseGroup::setEventThresholdReTestRequired;
     using SynapseGroup::setWUVarReferencedByCustomUpdate;
     using SynapseGroup::setFusedPSVarSuffix;
@@ -39,6 +43,7 @@ public:
     using SynapseGroup::setFusedWUPreVarSuffix;
     using SynapseGroup::setFusedWUPostVarSuffix;
     using SynapseGroup::initDerivedParams;
+    using SynapseGroup::eliminateVars;
     using SynapseGroup::isEventThresholdReTestRequired;
     using SynapseGroup::areWUVarReferencedByCustomUpdate;
     using SynapseGroup::getFusedPSVarSuffix;
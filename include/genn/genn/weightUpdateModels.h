@@ -16,6 +16,7 @@
 #define SET_EVENT_CODE(EVENT_CODE) virtual std::string getEventCode() const override{ return EVENT_CODE; }
 #define SET_LEARN_POST_CODE(LEARN_POST_CODE) virtual std::string getLearnPostCode() const override{ return LEARN_POST_CODE; }
 #define SET_SYNAPSE_DYNAMICS_CODE(SYNAPSE_DYNAMICS_CODE) virtual std::string getSynapseDynamicsCode() const override{ return SYNAPSE_DYNAMICS_CODE; }
+#define SET_LAZY_SYNAPSE_DYNAMICS_CODE(LAZY_SYNAPSE_DYNAMICS_CODE) virtual std::string getLazySynapseDynamicsCode() const override{ return LAZY_SYNAPSE_DYNAMICS_CODE; }
 #define SET_EVENT_THRESHOLD_CONDITION_CODE(EVENT_THRESHOLD_CONDITION_CODE) virtual std::string getEventThresholdConditionCode() const override{ return EVENT_THRESHOLD_CONDITION_CODE; }
 
 #define SET_SIM_SUPPORT_CODE(SIM_SUPPORT_CODE) virtual std::string getSimSupportCode() const override{ return SIM_SUPPORT_CODE; }
@@ -63,6 +64,14 @@ public:
     //! Gets code for synapse dynamics which are independent of spike detection
     virtual std::string getSynapseDynamicsCode() const{ return ""; }
 
+    //! Gets closed-form code to advance synapse state by $(elapsed) ms
+    /*! Rather than being run every timestep, backends which support lazy synapse dynamics run this code
+        only when a presynaptic spike or event, a postsynaptic spike or a pull touches a synapse.
+        It should therefore only access synapse variables, parameters and extra global parameters.
+        Pushing synapse state marks all synapses as up to date and custom weight updates cannot reference their variables.
+        Other backends run it every timestep with $(elapsed) equal to DT. */
+    virtual std::string getLazySynapseDynamicsCode() const{ return ""; }
+
     //! Gets codes to test for events
     virtual std::string getEventThresholdConditionCode() const{ return ""; }
 
@@ -41,6 +41,7 @@ class Group(object):
         self._model = proxy(model)
         self.vars = {}
         self.extra_global_params = {}
+        self.dynamic_params = {}
 
     def set_var(self, var_name, values):
         """Set values for a Variable
@@ -70,6 +71,15 @@ class Group(object):
         """
         self.extra_global_params[param_name].set_values(param_values)
 
+    def set_dynamic_param_value(self, param_name, value):
+        """Set value of a dynamic parameter
+
+        Args:
+        param_name  --  string with the name of the parameter
+        value       --  new value of the parameter
+        """
+        self.dynamic_params[param_name][:] = value
+
     def pull_state_from_device(self):
         """Wrapper around GeNNModel.pull_state_from_device"""
         self._model.pull_state_from_device(self.name)
@@ -277,7 +287,8 @@ class Group(object):
         # Loop through variables
         for var_name, var_data in iteritems(var_dict):
             # If manual initialisation is required, copy over variables
-            if var_data.init_required:
+            # **NOTE** variables which have been eliminated have no view
+            if var_data.init_required and var_data.view is not None:
                 var_data.view[:] = var_data.values
 
     def _load_egp(self, egp_dict=None, egp_suffix=""):
@@ -310,6 +321,13 @@ class Group(object):
                 self._model._slm.push_extra_global_param(
                     self.name, egp_name + egp_suffix, len(egp_data.values))
 
+    def _load_dynamic_params(self, param_names, is_dynamic_fn):
+        # Assign views to any parameters marked as dynamic
+        for i, param_name in enumerate(param_names):
+            if is_dynamic_fn(i):
+                self.dynamic_params[param_name] = self._assign_ext_ptr_single(
+                    param_name, "scalar")
+
     def _load_var_init_egps(self, var_dict=None):
         # If no variable dictionary is specified, use standard one
         if var_dict is None:
@@ -423,6 +441,16 @@ class NeuronGroup(Group):
         self.pop = add_fct(self.name, num_neurons, self.neuron,
                            self.params, var_ini)
 
+    def set_param_dynamic(self, param_name, dynamic=True):
+        """Mark a parameter as dynamic so its value can be
+        changed after the model is built using set_dynamic_param_value
+
+        Args:
+        param_name  --  string with the name of the parameter
+        dynamic     --  bool whether parameter should be dynamic
+        """
+        self.pop.set_param_dynamic(param_name, dynamic)
+
     def pull_spikes_from_device(self):
         """Wrapper around GeNNModel.pull_spikes_from_device"""
         self._model.pull_spikes_from_device(self.name)
@@ -583,12 +611,17 @@ class NeuronGroup(Group):
             self.spike_que_ptr = self._model._slm.assign_external_pointer_single_ui(
                 "spkQuePtr" + self.name)
 
-        # Load neuron state variables
-        self._load_vars(self.neuron.get_vars())
+        # Load neuron state variables which haven't been eliminated
+        self._load_vars([v for v in self.neuron.get_vars()
+                         if self.pop.is_var_array_required(v.name)])
 
         # Load neuron extra global params
         self._load_egp()
 
+        # Load dynamic parameters
+        self._load_dynamic_params(self.neuron.get_param_names(),
+                                  self.pop.is_param_dynamic)
+
     def load_init_egps(self):
         # Load any egps used for variable initialisation
         self._load_var_init_egps()
@@ -1105,6 +1138,26 @@ class SynapseGroup(Group):
                                delay_steps,self.src.name, self.trg.name,
                                self.postsyn, self.ps_params, ps_var_ini)
 
+    def set_wu_param_dynamic(self, param_name, dynamic=True):
+        """Mark a weight update model parameter as dynamic so its value
+        can be changed after the model is built using set_dynamic_param_value
+
+        Args:
+        param_name  --  string with the name of the parameter
+        dynamic     --  bool whether parameter should be dynamic
+        """
+        self.pop.set_wuparam_dynamic(param_name, dynamic)
+
+    def set_ps_param_dynamic(self, param_name, dynamic=True):
+        """Mark a postsynaptic model parameter as dynamic so its value
+        can be changed after the model is built using set_dynamic_param_value
+
+        Args:
+        param_name  --  string with the name of the parameter
+        dynamic     --  bool whether parameter should be dynamic
+        """
+        self.pop.set_psparam_dynamic(param_name, dynamic)
+
     def set_psm_extra_global_param(self, param_name, param_values):
         """Set extra global parameter to postsynaptic model
 
@@ -1211,7 +1264,9 @@ class SynapseGroup(Group):
                 var_data = self.vars[v.name]
 
                 # If population has individual synapse variables
-                if self.has_individual_synapse_vars or self.has_kernel_synapse_vars:
+                # which haven't been eliminated
+                if ((self.has_individual_synapse_vars or self.has_kernel_synapse_vars)
+                        and self.pop.is_wuvar_array_required(v.name)):
                     # If variable is located on host
                     var_loc = self.pop.get_wuvar_location(v.name) 
                     if (var_loc & VarLocation_HOST) != 0:
@@ -1252,9 +1307,12 @@ class SynapseGroup(Group):
         # If this synapse group's postsynaptic model hasn't been fused
         if not self.pop.is_psmodel_fused():
             # Load postsynaptic update model variables
+            # which haven't been eliminated
             if self.has_individual_postsynaptic_vars:
-                self._load_vars(self.postsyn.get_vars(), self.trg.size,
-                                self.psm_vars, self.pop.get_psvar_location)
+                self._load_vars([v for v in self.postsyn.get_vars()
+                                 if self.pop.is_psvar_array_required(v.name)],
+                                self.trg.size, self.psm_vars,
+                                self.pop.get_psvar_location)
                 
             # If it's inSyn is accessible on the host
             if (self.pop.get_in_syn_location() & VarLocation_HOST) != 0:
@@ -1271,6 +1329,12 @@ class SynapseGroup(Group):
         self._load_egp()
         self._load_egp(self.psm_extra_global_params)
 
+        # Load dynamic parameters
+        self._load_dynamic_params(self.w_update.get_param_names(),
+                                  self.pop.is_wuparam_dynamic)
+        self._load_dynamic_params(self.postsyn.get_param_names(),
+                                  self.pop.is_psparam_dynamic)
+
     def load_init_egps(self):
         # If population isn't a weight-sharing slave
         if self.weight_sharing_master is None:
@@ -1297,9 +1361,10 @@ class SynapseGroup(Group):
                 # Get corresponding data from dictionary
                 var_data = self.vars[v.name]
 
-                # If variable is located on host
+                # If variable hasn't been eliminated and is located on host
                 var_loc = self.pop.get_wuvar_location(v.name) 
-                if (var_loc & VarLocation_HOST) != 0:
+                if ((var_loc & VarLocation_HOST) != 0
+                        and self.pop.is_wuvar_array_required(v.name)):
                     # Determine how many copies of this variable are present
                     num_copies = (1 if (v.access & VarAccessDuplication_SHARED) != 0
                                   else self._model.batch_size)
@@ -1400,13 +1465,28 @@ class CurrentSource(Group):
         self.pop = add_fct(self.name, self.current_source_model, pop.name,
                            self.params, var_ini)
 
+    def set_param_dynamic(self, param_name, dynamic=True):
+        """Mark a parameter as dynamic so its value can be
+        changed after the model is built using set_dynamic_param_value
+
+        Args:
+        param_name  --  string with the name of the parameter
+        dynamic     --  bool whether parameter should be dynamic
+        """
+        self.pop.set_param_dynamic(param_name, dynamic)
+
     def load(self):
-        # Load current source variables
-        self._load_vars(self.current_source_model.get_vars())
+        # Load current source variables which haven't been eliminated
+        self._load_vars([v for v in self.current_source_model.get_vars()
+                         if self.pop.is_var_array_required(v.name)])
 
         # Load current source extra global parameters
         self._load_egp()
 
+        # Load dynamic parameters
+        self._load_dynamic_params(self.current_source_model.get_param_names(),
+                                  self.pop.is_param_dynamic)
+
     def load_init_egps(self):
         # Load any egps used for variable initialisation
         self._load_var_init_egps()
@@ -1494,6 +1574,16 @@ class CustomUpdate(Group):
         self.pop = add_fct(self.name, group_name, self.custom_update_model, 
                            self.params, var_ini, var_refs)
 
+    def set_param_dynamic(self, param_name, dynamic=True):
+        """Mark a parameter as dynamic so its value can be
+        changed after the model is built using set_dynamic_param_value
+
+        Args:
+        param_name  --  string with the name of the parameter
+        dynamic     --  bool whether parameter should be dynamic
+        """
+        self.pop.set_param_dynamic(param_name, dynamic)
+
     def load(self):
         # If this is a custom weight update
         if self.custom_wu_update:
@@ -1537,6 +1627,10 @@ class CustomUpdate(Group):
         # Load custom update extra global parameters
         self._load_egp()
 
+        # Load dynamic parameters
+        self._load_dynamic_params(self.custom_update_model.get_param_names(),
+                                  self.pop.is_param_dynamic)
+
     def load_init_egps(self):
         # Load any egps used for variable initialisation
         self._load_var_init_egps()
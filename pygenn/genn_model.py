@@ -39,6 +39,7 @@ run a simulation using GeNNModel::
         Vs[i,:] = v_view
 """
 # python imports
+import json
 from collections import namedtuple, OrderedDict
 from distutils.spawn import find_executable
 from importlib import import_module
@@ -47,6 +48,7 @@ from platform import system
 from psutil import cpu_count
 from setuptools import msvc
 from subprocess import check_call  # to call make
+from tempfile import TemporaryDirectory
 from textwrap import dedent
 from warnings import warn
 
@@ -73,7 +75,7 @@ from .model_preprocessor import prepare_snippet
 
 # Loop through backends in preferential order
 backend_modules = OrderedDict()
-for b in ["CUDA", "SingleThreadedCPU", "OpenCL"]:
+for b in ["CUDA", "SingleThreadedCPU", "MultiThreadedCPU", "OpenCL"]:
     # Try and import
     try:
         m = import_module(".genn_wrapper." + b + "Backend", "pygenn")
@@ -194,7 +196,13 @@ class GeNNModel(object):
             "uint16_t":         GeNNType(np.uint16, self._slm.assign_external_pointer_array_us, self._slm.assign_external_pointer_single_us),
             "int16_t":          GeNNType(np.int16, self._slm.assign_external_pointer_array_s, self._slm.assign_external_pointer_single_s),
             "uint8_t":          GeNNType(np.uint8, self._slm.assign_external_pointer_array_uc, self._slm.assign_external_pointer_single_uc),
-            "int8_t":           GeNNType(np.int8, self._slm.assign_external_pointer_array_sc, self._slm.assign_external_pointer_single_sc)}
+            "int8_t":           GeNNType(np.int8, self._slm.assign_external_pointer_array_sc, self._slm.assign_external_pointer_single_sc),
+            "half":             GeNNType(np.float16, lambda n, s: self._slm.assign_external_pointer_array_us(n, s).view(np.float16), None),
+            "bfloat16":         GeNNType(np.uint16, self._slm.assign_external_pointer_array_us, None)}
+
+        # Add fixed-point int8_qN reduced-precision types - these are exposed as their raw int8 storage
+        for i in range(8):
+            self.genn_types["int8_q%u" % i] = GeNNType(np.int8, self._slm.assign_external_pointer_array_sc, None)
 
         # Add "scalar" type to genn_types - pointing at float or double as appropriate
         if precision == "float":
@@ -344,6 +352,14 @@ class GeNNModel(object):
     def synapse_dynamics_time(self):
         return self._slm.get_synapse_dynamics_time()
 
+    @property
+    def presynaptic_update_imbalance(self):
+        return self._slm.get_presynaptic_update_imbalance()
+
+    @property
+    def synapse_dynamics_imbalance(self):
+        return self._slm.get_synapse_dynamics_imbalance()
+
     @property
     def init_sparse_time(self):
         return self._slm.get_init_sparse_time()
@@ -354,6 +370,9 @@ class GeNNModel(object):
     def get_custom_update_transpose_time(self, name):
         return self._slm.get_custom_update_transpose_time(name)
 
+    def get_merged_group_init_time(self, merged_group_name, index):
+        return self._slm.get_merged_group_init_time(merged_group_name, index)
+
     def add_neuron_population(self, pop_name, num_neurons, neuron,
                               param_space, var_space):
         """Add a neuron population to the GeNN model
@@ -856,6 +875,39 @@ class GeNNModel(object):
         # Pull recording buffers from device
         self._slm.pull_recording_buffers_from_device()
 
+    def write_trace(self, filename):
+        """Write trace of time taken to update each merged group, and each
+        group within it, to a JSON file which can be opened in
+        chrome://tracing or Perfetto. Requires the model to have been
+        built with the ``enableTrace`` backend preference.
+
+        Args:
+        filename    --  path of JSON file to write
+        """
+        if not self._loaded:
+            raise Exception("GeNN model has to be loaded before writing trace")
+
+        self._slm.write_trace(filename)
+
+    def clear_trace(self):
+        """Discard all events recorded in trace"""
+        if not self._loaded:
+            raise Exception("GeNN model has to be loaded before clearing trace")
+
+        self._slm.clear_trace()
+
+    @property
+    def trace_events(self):
+        """List of trace events, each a dictionary in the Chrome trace
+        event format with ``name``, ``cat``, ``ts`` and ``dur`` (in
+        microseconds) and the ``timestep`` the event was recorded in"""
+        # Write trace to temporary file and read it back
+        with TemporaryDirectory() as temp_dir:
+            trace_filename = path.join(temp_dir, "trace.json")
+            self.write_trace(trace_filename)
+            with open(trace_filename, "r") as trace_file:
+                return json.load(trace_file)["traceEvents"]
+
     def end(self):
         """Free memory"""
         for group in [self.neuron_populations, self.synapse_populations,
@@ -1193,6 +1245,7 @@ def create_custom_weight_update_class(class_name, param_names=None,
                                       derived_params=None, sim_code=None,
                                       event_code=None, learn_post_code=None,
                                       synapse_dynamics_code=None,
+                                      lazy_synapse_dynamics_code=None,
                                       event_threshold_condition_code=None,
                                       pre_spike_code=None,
                                       post_spike_code=None,
@@ -1240,6 +1293,9 @@ def create_custom_weight_update_class(class_name, param_names=None,
     learn_post_code                         --  string with the code to include in
                                                 learn_synapse_post kernel/function
     synapse_dynamics_code                   --  string with the synapse dynamics code
+    lazy_synapse_dynamics_code              --  string with closed-form synapse
+                                                dynamics code which advances
+                                                synapse state by $(elapsed) ms
     event_threshold_condition_code          --  string with the event threshold
                                                 condition code
     pre_spike_code                          --  string with the code run once per
@@ -1289,6 +1345,10 @@ def create_custom_weight_update_class(class_name, param_names=None,
     if synapse_dynamics_code is not None:
         body["get_synapse_dynamics_code"] = lambda self: dedent(synapse_dynamics_code)
 
+    if lazy_synapse_dynamics_code is not None:
+        body["get_lazy_synapse_dynamics_code"] = \
+            lambda self: dedent(lazy_synapse_dynamics_code)
+
     if event_threshold_condition_code is not None:
         body["get_event_threshold_condition_code"] = \
             lambda self: dedent(event_threshold_condition_code)
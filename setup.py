@@ -89,8 +89,11 @@ genn_extension_kwargs["define_macros"] = [("LINKING_GENN_DLL", "1"), ("LINKING_B
 if linux:
     genn_extension_kwargs["runtime_library_dirs"] = ["$ORIGIN"]
 
-# By default build single-threaded CPU backend
-backends = [("single_threaded_cpu", "SingleThreadedCPU", {})]
+# By default build single and multi-threaded CPU backends
+# **NOTE** multi-threaded backend extends single-threaded backend so links against it
+backends = [("single_threaded_cpu", "SingleThreadedCPU", {}),
+            ("multi_threaded_cpu", "MultiThreadedCPU",
+             {"libraries": ["genn_single_threaded_cpu_backend" + genn_lib_suffix]})]
 
 # If CUDA was found, add backend configuration
 if cuda_installed:
@@ -0,0 +1,466 @@
+#pragma once
+
+// Standard C++ includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Platform includes
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace GeNN
+{
+//--------------------------------------------------------------------------
+// GeNN::LoadBalance
+//--------------------------------------------------------------------------
+//! Accumulates the per-thread busy time of parallel loops to measure how evenly their work was distributed
+class LoadBalance
+{
+public:
+    LoadBalance() : m_MaxTime(0.0), m_MeanTime(0.0)
+    {
+    }
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Add the busy time of the slowest thread and the mean busy time of all threads from one parallel loop
+    void add(double maxTime, double meanTime)
+    {
+        m_MaxTime += maxTime;
+        m_MeanTime += meanTime;
+    }
+
+    //! Get ratio of the time taken by the slowest threads to the mean time taken by all threads
+    /*! 1 means work was perfectly balanced and 0 that no parallel loops have been measured */
+    double getImbalance() const{ return (m_MeanTime > 0.0) ? (m_MaxTime / m_MeanTime) : 0.0; }
+
+    //! Reset accumulated times
+    void reset()
+    {
+        m_MaxTime = 0.0;
+        m_MeanTime = 0.0;
+    }
+
+private:
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    double m_MaxTime;
+    double m_MeanTime;
+};
+
+//--------------------------------------------------------------------------
+// GeNN::ThreadPool
+//--------------------------------------------------------------------------
+//! Pool of persistent worker threads used by code generated by the multi-threaded CPU backend
+/*! parallelFor distributes work in contiguous, statically-sized chunks with the calling thread processing the first.
+    parallelForWeighted splits work into chunks of similar cost which threads steal from each other once their own run out.
+    Calls made from within a parallel region are run serially on the calling thread. */
+class ThreadPool
+{
+public:
+    ThreadPool() : m_Generation(0), m_NumPending(0), m_NumChunks(0), m_Stop(false), m_Pinned(false)
+    {
+    }
+
+    ~ThreadPool()
+    {
+        stop();
+    }
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Start numThreads - 1 worker threads (the calling thread acts as the final thread)
+    /*! If numThreads is zero, the GENN_NUM_THREADS environment variable or the number of hardware threads is used.
+        If pin is true, each thread (including the calling thread until stop is called) is pinned to its own CPU */
+    void start(unsigned int numThreads, bool pin = false)
+    {
+        // Stop any existing workers
+        stop();
+
+        // If number of threads isn't specified, read from environment or use hardware concurrency
+        if(numThreads == 0) {
+            const char *numThreadsEnv = std::getenv("GENN_NUM_THREADS");
+            if(numThreadsEnv != nullptr) {
+                numThreads = (unsigned int)std::strtoul(numThreadsEnv, nullptr, 10);
+            }
+            else {
+                numThreads = std::thread::hardware_concurrency();
+            }
+        }
+
+        // Allocate per-thread work queues and busy times
+        m_Queues.reset(new Queue[std::max(1u, numThreads)]);
+        m_BusyTime.assign(std::max(1u, numThreads), 0.0);
+
+        // Launch workers, starting from the current generation so they don't run any task published before they started
+        m_Stop = false;
+        for(unsigned int t = 1; t < std::max(1u, numThreads); t++) {
+            m_Workers.emplace_back(&ThreadPool::workerThread, this, t, m_Generation);
+        }
+
+        // If requested, pin threads
+        if(pin) {
+            pinThreads();
+        }
+    }
+
+    //! Stop and join all worker threads
+    void stop()
+    {
+        // Signal workers to stop
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stop = true;
+        }
+        m_StartCondition.notify_all();
+
+        // Join and clear
+        for(auto &w : m_Workers) {
+            w.join();
+        }
+        m_Workers.clear();
+
+        // Discard last task so restarted workers can't see it
+        m_Task = nullptr;
+        m_NumChunks = 0;
+        m_NumPending = 0;
+
+        // If threads were pinned, restore calling thread's original affinity
+#ifdef __linux__
+        if(m_Pinned) {
+            pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &m_OriginalAffinity);
+            m_Pinned = false;
+        }
+#endif
+    }
+
+    //! Get total number of threads including the calling thread
+    unsigned int getNumThreads() const{ return (unsigned int)m_Workers.size() + 1; }
+
+    //! Call f(begin, end, thread) on contiguous chunks of the range [0, count) in parallel
+    /*! If load is not null, the busy time of each thread is added to it */
+    template<typename F>
+    void parallelFor(size_t count, F f, size_t minChunkSize = 16, LoadBalance *load = nullptr)
+    {
+        // Determine how many chunks to split work into
+        const size_t numChunks = std::min<size_t>(getNumThreads(), (count + minChunkSize - 1) / minChunkSize);
+
+        // If there's only one chunk or we're already within a parallel region, run serially
+        if(numChunks <= 1 || isInParallel()) {
+            runSerial(count, f, load);
+        }
+        // Otherwise, give each thread one chunk
+        else {
+            run(numChunks, 
+                [count, numChunks, &f](unsigned int chunk)
+                {
+                    f((count * chunk) / numChunks, (count * (chunk + 1)) / numChunks, chunk);
+                },
+                load);
+        }
+    }
+
+    //! Call f(begin, end, thread) on contiguous chunks of the range [0, count) in parallel, balancing work using weight(i)
+    /*! The range is split into chunks of approximately equal total weight, where the weight of each iteration
+        is 1 + weight(i), and these are divided evenly between the threads' queues. Threads which empty their
+        own queue take chunks from the front of other threads' queues until all are empty. Within f, thread
+        is always the index of the thread running the chunk rather than that of the queue it came from.
+        If load is not null, the busy time of each thread is added to it */
+    template<typename W, typename F>
+    void parallelForWeighted(size_t count, W weight, F f, LoadBalance *load = nullptr)
+    {
+        const unsigned int numThreads = getNumThreads();
+
+        // If there's only one thread, or we're already within a parallel region, run serially
+        if(numThreads == 1 || count <= 1 || isInParallel()) {
+            runSerial(count, f, load);
+            return;
+        }
+
+        // Calculate total weight and hence target weight of each chunk
+        size_t totalWeight = 0;
+        for(size_t i = 0; i < count; i++) {
+            totalWeight += 1 + weight(i);
+        }
+        const size_t chunkWeight = std::max<size_t>(1, totalWeight / (numThreads * chunksPerThread));
+
+        // Split range into chunks of (at least) target weight
+        // **NOTE** iterations heavier than the target get a chunk to themselves
+        m_ChunkEnds.clear();
+        size_t currentWeight = 0;
+        for(size_t i = 0; i < count; i++) {
+            currentWeight += 1 + weight(i);
+            if(currentWeight >= chunkWeight) {
+                m_ChunkEnds.push_back(i + 1);
+                currentWeight = 0;
+            }
+        }
+        if(m_ChunkEnds.empty() || m_ChunkEnds.back() != count) {
+            m_ChunkEnds.push_back(count);
+        }
+
+        // Divide chunks evenly between thread queues
+        const size_t numChunks = m_ChunkEnds.size();
+        for(unsigned int t = 0; t < numThreads; t++) {
+            m_Queues[t].next.store((numChunks * t) / numThreads, std::memory_order_relaxed);
+            m_Queues[t].end = (numChunks * (t + 1)) / numThreads;
+        }
+
+        run(numThreads,
+            [numThreads, &f, this](unsigned int thread)
+            {
+                // Process chunks from our own queue and then steal from the other threads' queues, starting with our neighbour's
+                for(unsigned int q = 0; q < numThreads; q++) {
+                    Queue &queue = m_Queues[(thread + q) % numThreads];
+                    for(size_t c = queue.next.fetch_add(1, std::memory_order_relaxed); c < queue.end; 
+                        c = queue.next.fetch_add(1, std::memory_order_relaxed))
+                    {
+                        f((c == 0) ? 0 : m_ChunkEnds[c - 1], m_ChunkEnds[c], thread);
+                    }
+                }
+            },
+            load);
+    }
+
+private:
+    //------------------------------------------------------------------------
+    // Queue
+    //------------------------------------------------------------------------
+    //! Queue of chunks, padded to avoid false sharing between threads
+    struct Queue
+    {
+        std::atomic<size_t> next;
+        size_t end;
+        char padding[64 - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+    };
+
+    //------------------------------------------------------------------------
+    // Private methods
+    //------------------------------------------------------------------------
+    static bool &isInParallel()
+    {
+        static thread_local bool inParallel = false;
+        return inParallel;
+    }
+
+    //! Pin each thread to one of the CPUs the calling thread is allowed to run on
+    /*! **NOTE** pinning is currently only supported on Linux */
+    void pinThreads()
+    {
+#ifdef __linux__
+        // Get CPUs calling thread can run on
+        if(pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &m_OriginalAffinity) != 0) {
+            return;
+        }
+        std::vector<int> cpus;
+        for(int c = 0; c < CPU_SETSIZE; c++) {
+            if(CPU_ISSET(c, &m_OriginalAffinity)) {
+                cpus.push_back(c);
+            }
+        }
+        if(cpus.empty()) {
+            return;
+        }
+
+        // Pin calling thread and then workers to successive CPUs, wrapping if there are more threads than CPUs
+        for(unsigned int t = 0; t < getNumThreads(); t++) {
+            cpu_set_t cpu;
+            CPU_ZERO(&cpu);
+            CPU_SET(cpus[t % cpus.size()], &cpu);
+            pthread_setaffinity_np((t == 0) ? pthread_self() : m_Workers[t - 1].native_handle(), sizeof(cpu_set_t), &cpu);
+        }
+        m_Pinned = true;
+#endif
+    }
+
+    static double getElapsed(std::chrono::high_resolution_clock::time_point start)
+    {
+        return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    }
+
+    template<typename F>
+    void runSerial(size_t count, F &f, LoadBalance *load)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        f(0, count, 0);
+
+        // If load is being measured, all work was done by this thread
+        if(load != nullptr && !isInParallel()) {
+            const double busyTime = getElapsed(start);
+            load->add(busyTime, busyTime / getNumThreads());
+        }
+    }
+
+    //! Run task(chunk) for chunks [0, numChunks) with the calling thread processing the first
+    void run(size_t numChunks, std::function<void(unsigned int)> task, LoadBalance *load)
+    {
+        // Publish task to workers and wake them
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if(load == nullptr) {
+                m_Task = task;
+            }
+            // If load is being measured, wrap task to record each thread's busy time
+            else {
+                std::fill(m_BusyTime.begin(), m_BusyTime.end(), 0.0);
+                m_Task = [&task, this](unsigned int chunk)
+                         {
+                             const auto start = std::chrono::high_resolution_clock::now();
+                             task(chunk);
+                             m_BusyTime[chunk] = getElapsed(start);
+                         };
+            }
+            m_NumChunks = numChunks;
+            m_NumPending = numChunks - 1;
+            m_Generation++;
+        }
+        m_StartCondition.notify_all();
+
+        // Process first chunk on this thread
+        bool &inParallel = isInParallel();
+        inParallel = true;
+        m_Task(0);
+        inParallel = false;
+
+        // Wait for workers to complete
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_DoneCondition.wait(lock, [this](){ return m_NumPending == 0; });
+
+        // If load is being measured, add slowest and mean busy time
+        if(load != nullptr) {
+            const double maxTime = *std::max_element(m_BusyTime.cbegin(), m_BusyTime.cend());
+            double totalTime = 0.0;
+            for(double t : m_BusyTime) {
+                totalTime += t;
+            }
+            load->add(maxTime, totalTime / m_BusyTime.size());
+        }
+    }
+
+    void workerThread(unsigned int thread, size_t generation)
+    {
+        // Workers are always within a parallel region
+        isInParallel() = true;
+
+        while(true) {
+            // Wait for new work or stop signal
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_StartCondition.wait(lock, [this, generation](){ return m_Stop || m_Generation != generation; });
+            if(m_Stop) {
+                return;
+            }
+            generation = m_Generation;
+
+            // If there's a chunk of work for this thread
+            if(thread < m_NumChunks) {
+                // Process it without lock
+                lock.unlock();
+                m_Task(thread);
+                lock.lock();
+
+                // If this is the last chunk to complete, notify calling thread
+                if(--m_NumPending == 0) {
+                    m_DoneCondition.notify_one();
+                }
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // Static constants
+    //------------------------------------------------------------------------
+    //! How many chunks to create per thread in parallelForWeighted
+    static const size_t chunksPerThread = 8;
+
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    std::vector<std::thread> m_Workers;
+    std::mutex m_Mutex;
+    std::condition_variable m_StartCondition;
+    std::condition_variable m_DoneCondition;
+    std::function<void(unsigned int)> m_Task;
+    size_t m_Generation;
+    size_t m_NumPending;
+    size_t m_NumChunks;
+    bool m_Stop;
+
+    std::unique_ptr<Queue[]> m_Queues;
+    std::vector<size_t> m_ChunkEnds;
+    std::vector<double> m_BusyTime;
+
+    bool m_Pinned;
+#ifdef __linux__
+    cpu_set_t m_OriginalAffinity;
+#endif
+};
+}   // namespace GeNN
+
+//--------------------------------------------------------------------------
+// Atomic operations used by generated code
+//--------------------------------------------------------------------------
+//! Atomically add value to the variable pointed to by address
+template<typename T, typename V>
+inline void gennAtomicAdd(T *address, V value)
+{
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Atomic add is only supported on 32 and 64-bit types");
+#ifdef _MSC_VER
+    typedef typename std::conditional<sizeof(T) == 4, long, long long>::type Word;
+    Word expectedWord;
+    Word desiredWord;
+    do {
+        const T expected = *(volatile T*)address;
+        const T desired = (T)(expected + value);
+        std::memcpy(&expectedWord, &expected, sizeof(T));
+        std::memcpy(&desiredWord, &desired, sizeof(T));
+    } while((sizeof(T) == 4) ? (_InterlockedCompareExchange((volatile long*)address, (long)desiredWord, (long)expectedWord) != (long)expectedWord)
+            : (_InterlockedCompareExchange64((volatile long long*)address, desiredWord, expectedWord) != expectedWord));
+#else
+    T expected;
+    T desired;
+    __atomic_load(address, &expected, __ATOMIC_RELAXED);
+    do {
+        desired = (T)(expected + value);
+    } while(!__atomic_compare_exchange(address, &expected, &desired, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+#endif
+}
+
+//! Atomically increment the variable pointed to by address and return its previous value
+inline unsigned int gennAtomicIncrement(unsigned int *address)
+{
+#ifdef _MSC_VER
+    return (unsigned int)_InterlockedIncrement((volatile long*)address) - 1;
+#else
+    return __atomic_fetch_add(address, 1u, __ATOMIC_RELAXED);
+#endif
+}
+
+//! Atomically bitwise OR value into the variable pointed to by address
+inline void gennAtomicOr(uint32_t *address, uint32_t value)
+{
+#ifdef _MSC_VER
+    _InterlockedOr((volatile long*)address, (long)value);
+#else
+    __atomic_fetch_or(address, value, __ATOMIC_RELAXED);
+#endif
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+// Standard C++ includes
+#include <mutex>
+#include <new>
+#include <unordered_map>
+
+// Standard C includes
+#include <cstddef>
+#include <cstdlib>
+
+// Platform includes
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#endif
+
+//--------------------------------------------------------------------------
+// GeNN::Allocator
+//--------------------------------------------------------------------------
+namespace GeNN
+{
+//! Allocates the arrays used by code generated by the CPU backends
+/*! All arrays are aligned to 64 bytes so they can be loaded with any SIMD instruction set and don't share cache lines.
+    On Linux, arrays larger than a threshold can instead be mapped directly and marked as candidates for transparent
+    huge pages to reduce TLB misses. In both cases, physical pages are not touched when arrays are allocated so, on
+    NUMA systems, they are placed on the node of the thread which first writes them (typically during initialisation) */
+class Allocator
+{
+public:
+    //! Alignment of all allocated arrays in bytes
+    static const size_t alignment = 64;
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Allocate an array of count elements, mapping it and enabling huge pages if it is at least hugePageThreshold bytes
+    /*! If hugePageThreshold is zero, arrays are never mapped */
+    template<typename T>
+    static T *allocate(size_t count, size_t hugePageThreshold = 0)
+    {
+        return static_cast<T*>(allocateBytes(count * sizeof(T), hugePageThreshold));
+    }
+
+    //! Free an array allocated with allocate
+    static void free(void *pointer)
+    {
+        if(pointer == nullptr) {
+            return;
+        }
+
+#ifndef _WIN32
+        // If pointer was mapped, unmap it
+        {
+            std::lock_guard<std::mutex> lock(getMutex());
+            auto &mapped = getMapped();
+            const auto m = mapped.find(pointer);
+            if(m != mapped.end()) {
+                munmap(pointer, m->second);
+                mapped.erase(m);
+                return;
+            }
+        }
+        std::free(pointer);
+#else
+        _aligned_free(pointer);
+#endif
+    }
+
+private:
+    //------------------------------------------------------------------------
+    // Private static methods
+    //------------------------------------------------------------------------
+    static void *allocateBytes(size_t bytes, size_t hugePageThreshold)
+    {
+        // Always allocate something so pointers are unique
+        bytes = (bytes == 0) ? alignment : bytes;
+
+#ifndef _WIN32
+        // If array is large enough, map it directly
+        // **NOTE** mapped memory is page-aligned so also meets our alignment
+        if(hugePageThreshold != 0 && bytes >= hugePageThreshold) {
+            void *pointer = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if(pointer == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+
+            // Advise kernel to back mapping with huge pages
+            // **NOTE** this is only a hint so failure e.g. due to transparent huge pages being disabled is ignored
+#ifdef MADV_HUGEPAGE
+            madvise(pointer, bytes, MADV_HUGEPAGE);
+#endif
+
+            // Record size of mapping so it can be unmapped
+            std::lock_guard<std::mutex> lock(getMutex());
+            getMapped().emplace(pointer, bytes);
+            return pointer;
+        }
+
+        void *pointer = nullptr;
+        if(posix_memalign(&pointer, alignment, bytes) != 0) {
+            throw std::bad_alloc();
+        }
+        return pointer;
+#else
+        (void)hugePageThreshold;
+        void *pointer = _aligned_malloc(bytes, alignment);
+        if(pointer == nullptr) {
+            throw std::bad_alloc();
+        }
+        return pointer;
+#endif
+    }
+
+    static std::mutex &getMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::unordered_map<void*, size_t> &getMapped()
+    {
+        static std::unordered_map<void*, size_t> mapped;
+        return mapped;
+    }
+};
+}   // namespace GeNN
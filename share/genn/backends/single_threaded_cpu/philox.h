@@ -0,0 +1,157 @@
+#pragma once
+
+// Standard C++ includes
+#include <limits>
+
+// Standard C includes
+#include <cmath>
+#include <cstdint>
+
+//--------------------------------------------------------------------------
+// GeNN::Philox
+//--------------------------------------------------------------------------
+namespace GeNN
+{
+//! Counter-based Philox4x32-10 random number generator used by code generated by the CPU backends
+/*! Unlike std::mt19937, creating a Philox RNG is cheap and the numbers it generates depend
+    only on the key and counter it is created with. Code can therefore create a fresh RNG
+    for each neuron or synaptic row and get the same random numbers whatever order, or
+    on whichever thread, they are processed. Implements the UniformRandomBitGenerator concept. */
+class Philox
+{
+public:
+    typedef uint32_t result_type;
+
+    //! Create RNG for member id of the stream identified by key, at timestep
+    Philox(uint64_t key, uint32_t id, uint64_t timestep = 0)
+    :   m_Counter{0, id, (uint32_t)timestep, (uint32_t)(timestep >> 32)},
+        m_Key{(uint32_t)key, (uint32_t)(key >> 32)}, m_Index(4)
+    {
+    }
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Get the next 32-bit random number
+    result_type operator()()
+    {
+        // If all outputs of last block have been used, generate another
+        if(m_Index == 4) {
+            generateBlock();
+        }
+        return m_Output[m_Index++];
+    }
+
+    static constexpr result_type min(){ return 0; }
+    static constexpr result_type max(){ return std::numeric_limits<result_type>::max(); }
+
+    //! Derive a key from the model seed and an identifier for a stream e.g. a population
+    /*! **NOTE** this should be hoisted out of loops as it is comparatively expensive */
+    static uint64_t getKey(uint64_t seed, uint64_t stream)
+    {
+        return splitMix64(seed ^ splitMix64(stream));
+    }
+
+private:
+    //------------------------------------------------------------------------
+    // Private static methods
+    //------------------------------------------------------------------------
+    static uint64_t splitMix64(uint64_t x)
+    {
+        x += 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+
+    //------------------------------------------------------------------------
+    // Private methods
+    //------------------------------------------------------------------------
+    void generateBlock()
+    {
+        uint32_t c[4] = {m_Counter[0], m_Counter[1], m_Counter[2], m_Counter[3]};
+        uint32_t k[2] = {m_Key[0], m_Key[1]};
+
+        // Apply 10 rounds, bumping key between each
+        for(int r = 0; r < 10; r++) {
+            if(r > 0) {
+                k[0] += 0x9E3779B9u;
+                k[1] += 0xBB67AE85u;
+            }
+
+            const uint64_t p0 = (uint64_t)0xD2511F53u * c[0];
+            const uint64_t p1 = (uint64_t)0xCD9E8D57u * c[2];
+            const uint32_t c1 = c[1];
+            const uint32_t c3 = c[3];
+            c[0] = (uint32_t)(p1 >> 32) ^ c1 ^ k[0];
+            c[1] = (uint32_t)p1;
+            c[2] = (uint32_t)(p0 >> 32) ^ c3 ^ k[1];
+            c[3] = (uint32_t)p0;
+        }
+
+        // Copy to output
+        m_Output[0] = c[0];
+        m_Output[1] = c[1];
+        m_Output[2] = c[2];
+        m_Output[3] = c[3];
+        m_Index = 0;
+
+        // Advance block counter
+        m_Counter[0]++;
+    }
+
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    uint32_t m_Counter[4];
+    uint32_t m_Key[2];
+    uint32_t m_Output[4];
+    unsigned int m_Index;
+};
+
+//--------------------------------------------------------------------------
+// Distributions used to implement gennrand_XXX functions with Philox RNGs
+//--------------------------------------------------------------------------
+//! Uniformly-distributed number in the open interval (0, 1)
+template<typename T>
+inline T philoxUniform(Philox &rng);
+
+template<>
+inline float philoxUniform<float>(Philox &rng)
+{
+    // **NOTE** only 23 bits are used so that adding 0.5 can't round up to 1
+    return ((float)(rng() >> 9) + 0.5f) * (1.0f / 8388608.0f);
+}
+
+template<>
+inline double philoxUniform<double>(Philox &rng)
+{
+    // **NOTE** only 52 bits are used so that adding 0.5 can't round up to 1
+    const uint64_t hi = rng() >> 6;
+    const uint64_t lo = rng() >> 6;
+    return ((double)((hi << 26) | lo) + 0.5) * (1.0 / 4503599627370496.0);
+}
+
+//! Normally-distributed number with zero mean and unit variance generated using the Box-Muller transform
+template<typename T>
+inline T philoxNormal(Philox &rng)
+{
+    const T u1 = philoxUniform<T>(rng);
+    const T u2 = philoxUniform<T>(rng);
+    return std::sqrt(T(-2) * std::log(u1)) * std::cos(T(6.283185307179586) * u2);
+}
+
+//! Exponentially-distributed number with unit rate
+template<typename T>
+inline T philoxExponential(Philox &rng)
+{
+    return -std::log(philoxUniform<T>(rng));
+}
+
+//! Log-normally-distributed number with specified mean and standard deviation of underlying normal distribution
+template<typename T>
+inline T philoxLogNormal(Philox &rng, T mean, T std)
+{
+    return std::exp(mean + (std * philoxNormal<T>(rng)));
+}
+}   // namespace GeNN
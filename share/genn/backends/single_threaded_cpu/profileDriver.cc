@@ -0,0 +1,11 @@
+//----------------------------------------------------------------------------
+// Driver used to collect profile for profile-guided optimisation
+//----------------------------------------------------------------------------
+// Implemented in generated runner, simulates model for number of timesteps set in preferences
+void collectProfile();
+
+int main()
+{
+    collectProfile();
+    return 0;
+}
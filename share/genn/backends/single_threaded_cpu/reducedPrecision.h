@@ -0,0 +1,224 @@
+#pragma once
+
+// Standard C++ includes
+#include <algorithm>
+
+// Standard C includes
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+//--------------------------------------------------------------------------
+// GeNN::Half
+//--------------------------------------------------------------------------
+namespace GeNN
+{
+//! IEEE 754 half-precision storage type used by code generated by the CPU backends
+/*! Values are converted to the compute type T (the model's scalar type) when read and
+    rounded to the nearest half-precision value when written, so all arithmetic is
+    performed in T and only the bytes in memory are reduced. */
+template<typename T>
+class Half
+{
+public:
+    Half() = default;
+    explicit Half(T value) : m_Bits(fromFloat((float)value)){}
+
+    //------------------------------------------------------------------------
+    // Operators
+    //------------------------------------------------------------------------
+    operator T() const{ return (T)toFloat(m_Bits); }
+
+    Half &operator = (T value){ m_Bits = fromFloat((float)value); return *this; }
+    Half &operator += (T value){ return (*this = (T)*this + value); }
+    Half &operator -= (T value){ return (*this = (T)*this - value); }
+    Half &operator *= (T value){ return (*this = (T)*this * value); }
+    Half &operator /= (T value){ return (*this = (T)*this / value); }
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    uint16_t getBits() const{ return m_Bits; }
+
+    //------------------------------------------------------------------------
+    // Static API
+    //------------------------------------------------------------------------
+    //! Convert float to half-precision, rounding to nearest even
+    static uint16_t fromFloat(float value)
+    {
+        uint32_t x;
+        std::memcpy(&x, &value, sizeof(float));
+        const uint16_t sign = (uint16_t)((x >> 16) & 0x8000);
+        x &= 0x7FFFFFFF;
+
+        // Infinity and NaN (which is kept quiet)
+        if(x >= 0x7F800000) {
+            return sign | 0x7C00 | ((x > 0x7F800000) ? 0x200 : 0);
+        }
+        // Values which round to more than the largest half are infinite
+        else if(x >= 0x477FF000) {
+            return sign | 0x7C00;
+        }
+        // Normal halfs - rebias exponent and round mantissa
+        // **NOTE** carry out of mantissa correctly increments exponent
+        else if(x >= 0x38800000) {
+            return sign | (uint16_t)((x + 0xFFF + ((x >> 13) & 1) - 0x38000000) >> 13);
+        }
+        // Values smaller than half the smallest subnormal half round to zero
+        else if(x < 0x33000000) {
+            return sign;
+        }
+        // Subnormal halfs - shift implicit leading one into mantissa and round
+        else {
+            const uint32_t shift = 126 - (x >> 23);
+            const uint32_t mantissa = (x & 0x7FFFFF) | 0x800000;
+            const uint32_t remainder = mantissa & ((1u << shift) - 1);
+            const uint32_t halfway = 1u << (shift - 1);
+            uint32_t h = mantissa >> shift;
+            if(remainder > halfway || (remainder == halfway && (h & 1))) {
+                h++;
+            }
+            return sign | (uint16_t)h;
+        }
+    }
+
+    //! Convert half-precision to float
+    static float toFloat(uint16_t bits)
+    {
+        const uint32_t sign = (uint32_t)(bits & 0x8000) << 16;
+        const uint32_t exponent = (bits >> 10) & 0x1F;
+        const uint32_t mantissa = bits & 0x3FF;
+
+        uint32_t x;
+        if(exponent == 0x1F) {
+            x = sign | 0x7F800000 | (mantissa << 13);
+        }
+        else if(exponent != 0) {
+            x = sign | ((exponent + 112) << 23) | (mantissa << 13);
+        }
+        // Subnormal halfs are normal floats so easiest to calculate directly
+        else {
+            const float value = (float)mantissa * 5.9604644775390625e-8f;
+            return sign ? -value : value;
+        }
+
+        float value;
+        std::memcpy(&value, &x, sizeof(float));
+        return value;
+    }
+
+private:
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    uint16_t m_Bits;
+};
+
+//--------------------------------------------------------------------------
+// GeNN::BFloat16
+//--------------------------------------------------------------------------
+//! bfloat16 storage type used by code generated by the CPU backends
+/*! bfloat16 has the same range as float but only 8 bits of mantissa so conversion just rounds
+    away the lower 16 bits of a float. Like Half, arithmetic is performed in compute type T. */
+template<typename T>
+class BFloat16
+{
+public:
+    BFloat16() = default;
+    explicit BFloat16(T value) : m_Bits(fromFloat((float)value)){}
+
+    //------------------------------------------------------------------------
+    // Operators
+    //------------------------------------------------------------------------
+    operator T() const{ return (T)toFloat(m_Bits); }
+
+    BFloat16 &operator = (T value){ m_Bits = fromFloat((float)value); return *this; }
+    BFloat16 &operator += (T value){ return (*this = (T)*this + value); }
+    BFloat16 &operator -= (T value){ return (*this = (T)*this - value); }
+    BFloat16 &operator *= (T value){ return (*this = (T)*this * value); }
+    BFloat16 &operator /= (T value){ return (*this = (T)*this / value); }
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    uint16_t getBits() const{ return m_Bits; }
+
+    //------------------------------------------------------------------------
+    // Static API
+    //------------------------------------------------------------------------
+    //! Convert float to bfloat16, rounding to nearest even
+    static uint16_t fromFloat(float value)
+    {
+        uint32_t x;
+        std::memcpy(&x, &value, sizeof(float));
+
+        // Keep NaNs quiet rather than letting rounding turn them into infinities
+        if((x & 0x7FFFFFFF) > 0x7F800000) {
+            return (uint16_t)((x >> 16) | 0x40);
+        }
+        else {
+            return (uint16_t)((x + 0x7FFF + ((x >> 16) & 1)) >> 16);
+        }
+    }
+
+    //! Convert bfloat16 to float
+    static float toFloat(uint16_t bits)
+    {
+        const uint32_t x = (uint32_t)bits << 16;
+        float value;
+        std::memcpy(&value, &x, sizeof(float));
+        return value;
+    }
+
+private:
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    uint16_t m_Bits;
+};
+
+//--------------------------------------------------------------------------
+// GeNN::ScaledInt8
+//--------------------------------------------------------------------------
+//! 8-bit fixed-point storage type with FracBits fractional bits used by code generated by the CPU backends
+/*! Values are stored as round(value * 2^FracBits), saturated to the range of int8_t, so
+    can represent [-128 / 2^FracBits, 127 / 2^FracBits] in steps of 1 / 2^FracBits. */
+template<typename T, int FracBits>
+class ScaledInt8
+{
+public:
+    ScaledInt8() = default;
+    explicit ScaledInt8(T value) : m_Value(fromValue(value)){}
+
+    //------------------------------------------------------------------------
+    // Operators
+    //------------------------------------------------------------------------
+    operator T() const{ return (T)m_Value / (T)(1 << FracBits); }
+
+    ScaledInt8 &operator = (T value){ m_Value = fromValue(value); return *this; }
+    ScaledInt8 &operator += (T value){ return (*this = (T)*this + value); }
+    ScaledInt8 &operator -= (T value){ return (*this = (T)*this - value); }
+    ScaledInt8 &operator *= (T value){ return (*this = (T)*this * value); }
+    ScaledInt8 &operator /= (T value){ return (*this = (T)*this / value); }
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    int8_t getValue() const{ return m_Value; }
+
+    //------------------------------------------------------------------------
+    // Static API
+    //------------------------------------------------------------------------
+    static int8_t fromValue(T value)
+    {
+        const T scaled = std::round(value * (T)(1 << FracBits));
+        return (int8_t)std::min((T)127, std::max((T)-128, scaled));
+    }
+
+private:
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    int8_t m_Value;
+};
+}   // namespace GeNN
@@ -0,0 +1,107 @@
+#pragma once
+
+// Standard C++ includes
+#include <chrono>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+//--------------------------------------------------------------------------
+// GeNN::Trace
+//--------------------------------------------------------------------------
+namespace GeNN
+{
+//! Records when code generated by the CPU backends updates each merged group and each group within it
+/*! Events are written in the Chrome trace event format so they can be opened in chrome://tracing or Perfetto.
+    Events recorded within another event's duration are displayed nested within it. */
+class Trace
+{
+public:
+    typedef std::chrono::high_resolution_clock Clock;
+
+    Trace() : m_Origin(Clock::now())
+    {
+    }
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Record an event which started at start and ends now
+    /*! **NOTE** name and category must be string literals or otherwise outlive the trace */
+    void add(const char *name, const char *category, Clock::time_point start, unsigned long long timestep)
+    {
+        const auto end = Clock::now();
+        m_Events.push_back({name, category, timestep,
+                            std::chrono::duration<double, std::micro>(start - m_Origin).count(),
+                            std::chrono::duration<double, std::micro>(end - start).count()});
+    }
+
+    //! Discard all recorded events
+    void clear()
+    {
+        m_Events.clear();
+    }
+
+    //! Write recorded events to file as a JSON trace
+    void write(const std::string &filename) const
+    {
+        std::ofstream os(filename);
+        write(os);
+    }
+
+    //! Write recorded events to stream as a JSON trace
+    void write(std::ostream &os) const
+    {
+        os << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [" << std::endl;
+        for(size_t i = 0; i < m_Events.size(); i++) {
+            const auto &e = m_Events[i];
+            os << "{\"name\": ";
+            writeString(os, e.name);
+            os << ", \"cat\": ";
+            writeString(os, e.category);
+            os << ", \"ph\": \"X\", \"pid\": 0, \"tid\": 0, \"ts\": " << e.start << ", \"dur\": " << e.duration;
+            os << ", \"args\": {\"timestep\": " << e.timestep << "}}";
+            if(i != (m_Events.size() - 1)) {
+                os << ",";
+            }
+            os << std::endl;
+        }
+        os << "]}" << std::endl;
+    }
+
+private:
+    //------------------------------------------------------------------------
+    // Event
+    //------------------------------------------------------------------------
+    struct Event
+    {
+        const char *name;
+        const char *category;
+        unsigned long long timestep;
+        double start;
+        double duration;
+    };
+
+    //------------------------------------------------------------------------
+    // Private static methods
+    //------------------------------------------------------------------------
+    static void writeString(std::ostream &os, const char *string)
+    {
+        os << "\"";
+        for(const char *c = string; *c != '\0'; c++) {
+            if(*c == '"' || *c == '\\') {
+                os << "\\";
+            }
+            os << *c;
+        }
+        os << "\"";
+    }
+
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    const Clock::time_point m_Origin;
+    std::vector<Event> m_Events;
+};
+}   // namespace GeNN
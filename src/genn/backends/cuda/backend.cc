@@ -401,7 +401,7 @@ void Backend::genGlobalRNGSkipAhead(CodeStream &os, Substitutions &subs, const s
 }
 //--------------------------------------------------------------------------
 void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
-                              HostHandler preambleHandler, HostHandler pushEGPHandler) const
+                              HostHandler preambleHandler, HostHandler pushEGPHandler, ModuleHandler) const
 {
     const ModelSpecInternal &model = modelMerged.getModel();
 
@@ -525,7 +525,7 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
 }
 //--------------------------------------------------------------------------
 void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
-                               HostHandler preambleHandler, HostHandler pushEGPHandler) const
+                               HostHandler preambleHandler, HostHandler pushEGPHandler, ModuleHandler) const
 {
     // Generate struct definitions
     modelMerged.genMergedSynapseDendriticDelayUpdateStructs(os, *this);
@@ -848,7 +848,8 @@ void Backend::genCustomUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
 }
 //--------------------------------------------------------------------------
 void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged, 
-                      HostHandler preambleHandler, HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler) const
+                      HostHandler preambleHandler, HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler,
+                      ModuleHandler) const
 {
     os << "#include <iostream>" << std::endl;
     os << "#include <random>" << std::endl;
@@ -0,0 +1,198 @@
+#include "backend.h"
+
+// GeNN includes
+#include "gennUtils.h"
+
+// GeNN code generator includes
+#include "code_generator/codeGenUtils.h"
+#include "code_generator/codeStream.h"
+#include "code_generator/modelSpecMerged.h"
+
+using namespace CodeGenerator;
+
+//--------------------------------------------------------------------------
+// CodeGenerator::MultiThreadedCPU::Backend
+//--------------------------------------------------------------------------
+namespace CodeGenerator
+{
+namespace MultiThreadedCPU
+{
+void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
+{
+    // Superclass
+    SingleThreadedCPU::Backend::genDefinitionsInternalPreamble(os, modelMerged);
+
+    // Include thread pool and declare global instance
+    os << "#include \"multi_threaded_cpu/threadPool.h\"" << std::endl;
+    os << std::endl;
+    os << "extern GeNN::ThreadPool threadPool;" << std::endl;
+
+    // If timing is enabled, declare accumulators to measure load balance of synapse updates
+    if(modelMerged.getModel().isTimingEnabled()) {
+        os << "extern GeNN::LoadBalance presynapticUpdateLoad;" << std::endl;
+        os << "extern GeNN::LoadBalance synapseDynamicsLoad;" << std::endl;
+    }
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+void Backend::genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerged, const MemAlloc &memAlloc) const
+{
+    // Superclass
+    SingleThreadedCPU::Backend::genRunnerPreamble(os, modelMerged, memAlloc);
+
+    // Implement global thread pool
+    os << "GeNN::ThreadPool threadPool;" << std::endl;
+
+    // If timing is enabled, implement load balance accumulators
+    if(modelMerged.getModel().isTimingEnabled()) {
+        os << "GeNN::LoadBalance presynapticUpdateLoad;" << std::endl;
+        os << "GeNN::LoadBalance synapseDynamicsLoad;" << std::endl;
+    }
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+void Backend::genAllocateMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged, const MemAlloc &memAlloc) const
+{
+    // Superclass
+    SingleThreadedCPU::Backend::genAllocateMemPreamble(os, modelMerged, memAlloc);
+
+    // Start worker threads
+    os << "threadPool.start(" << getPreferences<Preferences>().numThreads << ", " << (getPreferences<Preferences>().pinThreads ? "true" : "false") << ");" << std::endl;
+}
+//--------------------------------------------------------------------------
+void Backend::genFreeMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
+{
+    // Superclass
+    SingleThreadedCPU::Backend::genFreeMemPreamble(os, modelMerged);
+
+    // Stop worker threads
+    os << "threadPool.stop();" << std::endl;
+}
+//--------------------------------------------------------------------------
+void Backend::genStepTimeFinalisePreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
+{
+    // Superclass
+    SingleThreadedCPU::Backend::genStepTimeFinalisePreamble(os, modelMerged);
+
+    // If timing is enabled, calculate this timestep's load imbalance and reset accumulators
+    if(modelMerged.getModel().isTimingEnabled()) {
+        os << "presynapticUpdateImbalance = presynapticUpdateLoad.getImbalance();" << std::endl;
+        os << "presynapticUpdateLoad.reset();" << std::endl;
+        os << "synapseDynamicsImbalance = synapseDynamicsLoad.getImbalance();" << std::endl;
+        os << "synapseDynamicsLoad.reset();" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genMakefilePreamble(std::ostream &os) const
+{
+    // Superclass
+    SingleThreadedCPU::Backend::genMakefilePreamble(os);
+
+    // Thread pool uses std::thread
+    os << "CXXFLAGS += -pthread" << std::endl;
+    os << "LINKFLAGS += -pthread" << std::endl;
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+std::vector<filesystem::path> Backend::getFilesToCopy(const ModelSpecMerged &modelMerged) const
+{
+    // Superclass
+    auto files = SingleThreadedCPU::Backend::getFilesToCopy(modelMerged);
+
+    // Add thread pool
+    files.push_back(filesystem::path("multi_threaded_cpu") / "threadPool.h");
+    return files;
+}
+//--------------------------------------------------------------------------
+boost::uuids::detail::sha1::digest_type Backend::getHashDigest() const
+{
+    boost::uuids::detail::sha1 hash;
+
+    // Update hash was name of backend
+    Utils::updateHash("MultiThreadedCPU", hash);
+
+    // Update hash with preferences
+    getPreferences<Preferences>().updateHash(hash);
+
+    return hash.get_digest();
+}
+//--------------------------------------------------------------------------
+void Backend::genParallelFor(CodeStream &os, const std::string &count, const std::string &indexVarName,
+                             bool parallel, HostHandler handler, bool vectorise) const
+{
+    // If iterations can't be run in parallel, generate serial loop
+    if(!parallel) {
+        SingleThreadedCPU::Backend::genParallelFor(os, count, indexVarName, false, handler, vectorise);
+    }
+    // Otherwise, split iterations into contiguous chunks and process each one on a thread
+    // **NOTE** threads are persistent so the only overhead is waking them and waiting for them to finish
+    else {
+        os << "threadPool.parallelFor(" << count << ", [&](size_t begin, size_t end, unsigned int)";
+        {
+            CodeStream::Scope b(os);
+            if(vectorise) {
+                os << "GENN_IVDEP" << std::endl;
+            }
+            os << "for(unsigned int " << indexVarName << " = (unsigned int)begin; " << indexVarName << " < (unsigned int)end; " << indexVarName << "++)";
+            {
+                CodeStream::Scope b(os);
+                handler(os);
+            }
+        }
+        os << ");" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genParallelForChunks(CodeStream &os, const std::string &count, const std::string &beginVarName,
+                                   const std::string &endVarName, const std::string &threadVarName, HostHandler handler,
+                                   const std::string &weight, const std::string &loadName) const
+{
+    // If iterations are weighted, balance work between threads using work-stealing
+    if(!weight.empty()) {
+        std::string weightCode = weight;
+        substitute(weightCode, "$(id)", "id");
+        os << "threadPool.parallelForWeighted(" << count << ", [&](size_t id){ return (size_t)" << weightCode << "; }, ";
+    }
+    // Otherwise, split iterations into equally-sized chunks
+    else {
+        os << "threadPool.parallelFor(" << count << ", ";
+    }
+
+    os << "[&](size_t chunkBegin, size_t chunkEnd, unsigned int " << threadVarName << ")";
+    {
+        CodeStream::Scope b(os);
+        os << "const unsigned int " << beginVarName << " = (unsigned int)chunkBegin;" << std::endl;
+        os << "const unsigned int " << endVarName << " = (unsigned int)chunkEnd;" << std::endl;
+        handler(os);
+    }
+
+    // If load balance should be measured, pass pointer to accumulator
+    if(!loadName.empty()) {
+        os << ", " << (weight.empty() ? "16, " : "") << "&" << loadName << "Load";
+    }
+    os << ");" << std::endl;
+}
+//--------------------------------------------------------------------------
+SingleThreadedCPU::PresynapticUpdateStrategy Backend::getPresynapticUpdateStrategy(const SynapseGroupInternal &sg) const
+{
+    // If atomic updates are requested or connectivity is Toeplitz without specialised code (which is parallelised across diagonals), use atomics
+    if(getPreferences<Preferences>().atomicPresynapticUpdate
+       || ((sg.getMatrixType() & SynapseMatrixConnectivity::TOEPLITZ) && !isToeplitzConvSpecialised(sg)))
+    {
+        return SingleThreadedCPU::PresynapticUpdateStrategy::ATOMIC;
+    }
+    // Otherwise, if every presynaptic neuron's row can be indexed directly by postsynaptic neuron, give each thread a range of postsynaptic neurons
+    // **NOTE** blocked propagation of BITMASK connectivity indexes rows directly even if bitmask optimisations are enabled
+    else if((sg.getMatrixType() & SynapseMatrixConnectivity::DENSE)
+            || ((sg.getMatrixType() & SynapseMatrixConnectivity::BITMASK)
+                && (!getPreferences().enableBitmaskOptimisations || sg.getPostTileSize() > 0)))
+    {
+        return SingleThreadedCPU::PresynapticUpdateStrategy::POST_OWNERSHIP;
+    }
+    // Otherwise, accumulate each thread's input in a private buffer
+    else {
+        return SingleThreadedCPU::PresynapticUpdateStrategy::THREAD_ACCUMULATOR;
+    }
+}
+}   // namespace MultiThreadedCPU
+}   // namespace CodeGenerator
@@ -33,6 +33,41 @@ const std::vector<Substitutions::FunctionTemplate> cpuDoublePrecisionFunctions =
     {"gennrand_gamma", 1, "std::gamma_distribution<double>($(0), 1.0)($(rng))"},
     {"gennrand_binomial", 2, "std::binomial_distribution<unsigned int>($(0), $(1))($(rng))"}
 };
+//--------------------------------------------------------------------------
+const std::vector<Substitutions::FunctionTemplate> cpuPhiloxSinglePrecisionFunctions = {
+    {"gennrand_uniform", 0, "GeNN::philoxUniform<float>($(rng))"},
+    {"gennrand_normal", 0, "GeNN::philoxNormal<float>($(rng))"},
+    {"gennrand_exponential", 0, "GeNN::philoxExponential<float>($(rng))"},
+    {"gennrand_log_normal", 2, "GeNN::philoxLogNormal<float>($(rng), $(0), $(1))"},
+    {"gennrand_gamma", 1, "std::gamma_distribution<float>($(0), 1.0f)($(rng))"},
+    {"gennrand_binomial", 2, "std::binomial_distribution<unsigned int>($(0), $(1))($(rng))"}
+};
+//--------------------------------------------------------------------------
+const std::vector<Substitutions::FunctionTemplate> cpuPhiloxDoublePrecisionFunctions = {
+    {"gennrand_uniform", 0, "GeNN::philoxUniform<double>($(rng))"},
+    {"gennrand_normal", 0, "GeNN::philoxNormal<double>($(rng))"},
+    {"gennrand_exponential", 0, "GeNN::philoxExponential<double>($(rng))"},
+    {"gennrand_log_normal", 2, "GeNN::philoxLogNormal<double>($(rng), $(0), $(1))"},
+    {"gennrand_gamma", 1, "std::gamma_distribution<double>($(0), 1.0)($(rng))"},
+    {"gennrand_binomial", 2, "std::binomial_distribution<unsigned int>($(0), $(1))($(rng))"}
+};
+
+//--------------------------------------------------------------------------
+// PhiloxDomain
+//--------------------------------------------------------------------------
+//! Identifiers used to give each type of merged group its own Philox RNG streams
+enum class PhiloxDomain : unsigned int
+{
+    PRESYNAPTIC_UPDATE = 1,
+    NEURON_UPDATE = 2,
+    CONNECTIVITY_INIT = 3,
+    NEURON_VAR_INIT = 4,
+    SYNAPSE_VAR_INIT = 5,
+    CUSTOM_UPDATE_VAR_INIT = 6,
+    CUSTOM_WU_UPDATE_VAR_INIT = 7,
+    SYNAPSE_SPARSE_VAR_INIT = 8,
+    CUSTOM_WU_UPDATE_SPARSE_VAR_INIT = 9
+};
 
 //--------------------------------------------------------------------------
 // Timer
@@ -66,12 +101,166 @@ private:
     const bool m_TimingEnabled;
 };
 
+//--------------------------------------------------------------------------
+// TraceEvent
+//--------------------------------------------------------------------------
+class TraceEvent
+{
+public:
+    TraceEvent(CodeStream &codeStream, const std::string &name, const std::string &eventName, 
+               const std::string &category, bool traceEnabled)
+    :   m_CodeStream(codeStream), m_Name(name), m_EventName(eventName), m_Category(category), m_TraceEnabled(traceEnabled)
+    {
+        // Record start time
+        if(m_TraceEnabled) {
+            m_CodeStream << "const auto " << m_Name << "TraceStart = GeNN::Trace::Clock::now();" << std::endl;
+        }
+    }
+
+    ~TraceEvent()
+    {
+        // Add event to trace
+        // **NOTE** event name is an expression which evaluates to a string literal
+        if(m_TraceEnabled) {
+            m_CodeStream << "trace.add(" << m_EventName << ", \"" << m_Category << "\", " << m_Name << "TraceStart, iT);" << std::endl;
+        }
+    }
+
+private:
+    //--------------------------------------------------------------------------
+    // Members
+    //--------------------------------------------------------------------------
+    CodeStream &m_CodeStream;
+    const std::string m_Name;
+    const std::string m_EventName;
+    const std::string m_Category;
+    const bool m_TraceEnabled;
+};
+
 //-----------------------------------------------------------------------
 const std::vector<Substitutions::FunctionTemplate> &getFunctionTemplates(const std::string &precision)
 {
     return (precision == "double") ? cpuDoublePrecisionFunctions : cpuSinglePrecisionFunctions;
 }
 //-----------------------------------------------------------------------
+std::string getPhiloxStream(PhiloxDomain domain, size_t mergedGroupIndex)
+{
+    // **NOTE** g is the index of the group within the merged group
+    return "((" + std::to_string(static_cast<unsigned int>(domain)) + "ull << 56) | (" + std::to_string(mergedGroupIndex) + "ull << 32) | g)";
+}
+//-----------------------------------------------------------------------
+void genPhiloxRNG(CodeStream &os, Substitutions &subs, const std::string &precision, const std::string &name,
+                  const std::string &key, const std::string &id, const std::string &timestep = "0")
+{
+    // Create Philox RNG for this member of stream
+    os << "GeNN::Philox " << name << "(" << key << ", " << id << ", " << timestep << ");" << std::endl;
+
+    // Substitute it for $(rng) and use Philox implementations of random functions
+    // **NOTE** function substitutions in child take precedence over those in parent
+    subs.addVarSubstitution("rng", name);
+    for(const auto &f : (precision == "double") ? cpuPhiloxDoublePrecisionFunctions : cpuPhiloxSinglePrecisionFunctions) {
+        subs.addFuncSubstitution(f.genericName, f.numArguments, f.funcTemplate);
+    }
+}
+//-----------------------------------------------------------------------
+void genVarInitPhiloxKey(CodeStream &os, Substitutions &subs, const std::string &precision, PhiloxDomain domain, size_t mergedGroupIndex)
+{
+    // Derive key for this group's variable initialisation RNG streams
+    os << "const uint64_t varInitRNGKey = GeNN::Philox::getKey(deviceRNGSeed, " << getPhiloxStream(domain, mergedGroupIndex) << ");" << std::endl;
+
+    // Add substitutions so backend variable initialisation methods can create Philox RNGs
+    // **NOTE** $(rng) itself is only substituted once these are created
+    subs.addVarSubstitution("init_rng_key", "varInitRNGKey");
+    for(const auto &f : (precision == "double") ? cpuPhiloxDoublePrecisionFunctions : cpuPhiloxSinglePrecisionFunctions) {
+        subs.addFuncSubstitution(f.genericName, f.numArguments, f.funcTemplate);
+    }
+}
+//-----------------------------------------------------------------------
+void genVarInitPhiloxSequenceCounter(CodeStream &os, Substitutions &subs, const std::string &name)
+{
+    // Declare counter from which each variable (or row of synapse variables) takes the next sequence 
+    // number so streams don't depend on the order in which threads initialise elements
+    os << "uint64_t " << name << " = 0;" << std::endl;
+    subs.addVarSubstitution("init_rng_sequence", name);
+}
+//-----------------------------------------------------------------------
+bool isVarInitPhiloxRNG(const Substitutions &subs)
+{
+    return subs.hasVarSubstitution("init_rng_key");
+}
+//-----------------------------------------------------------------------
+void genVarInitPhiloxSequence(CodeStream &os, const Substitutions &subs)
+{
+    // If Philox RNGs are being used for initialisation, take next sequence number for this variable
+    if(isVarInitPhiloxRNG(subs)) {
+        os << "const uint64_t initRNGSequence = " << subs["init_rng_sequence"] << "++;" << std::endl;
+    }
+}
+//-----------------------------------------------------------------------
+void genVarInitPhiloxRNG(CodeStream &os, Substitutions &subs, const std::string &id)
+{
+    // If Philox RNGs are being used for initialisation, create one for this element of the current sequence and substitute it for $(rng)
+    if(isVarInitPhiloxRNG(subs)) {
+        os << "GeNN::Philox initRNG(" << subs["init_rng_key"] << ", " << id << ", initRNGSequence);" << std::endl;
+        subs.addVarSubstitution("rng", "initRNG");
+    }
+}
+//-----------------------------------------------------------------------
+bool isProceduralRowRNGRequired(const SynapseGroupInternal &sg)
+{
+    // Rows of procedural connectivity require an RNG if their row build code or the initialisation of their procedural weights does
+    return ((sg.getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL)
+            && (::Utils::isRNGRequired(sg.getConnectivityInitialiser().getSnippet()->getRowBuildCode())
+                || ((sg.getMatrixType() & SynapseMatrixWeight::PROCEDURAL) && ::Utils::isRNGRequired(sg.getWUVarInitialisers()))));
+}
+//-----------------------------------------------------------------------
+bool isConnectivityInitRNGRequired(const SynapseGroupInternal &sg)
+{
+    // Building rows or columns of sparse connectivity requires an RNG if the row or column build code or the initialisation of kernel-based weights does
+    const auto *snippet = sg.getConnectivityInitialiser().getSnippet();
+    return (::Utils::isRNGRequired(snippet->getRowBuildCode()) || ::Utils::isRNGRequired(snippet->getColBuildCode())
+            || (!sg.getKernelSize().empty() && ::Utils::isRNGRequired(sg.getWUVarInitialisers())));
+}
+//-----------------------------------------------------------------------
+bool isReducedPrecisionType(const std::string &type)
+{
+    // **NOTE** extra global parameters may be pointers to reduced-precision types
+    const std::string underlyingType = ::Utils::isTypePointer(type) ? ::Utils::getUnderlyingType(type) : type;
+    return ((underlyingType == "half") || (underlyingType == "bfloat16") || (underlyingType.compare(0, 6, "int8_q") == 0));
+}
+//-----------------------------------------------------------------------
+template<typename V>
+bool anyReducedPrecisionType(const V &vars)
+{
+    return std::any_of(vars.cbegin(), vars.cend(),
+                       [](const typename V::value_type &v){ return isReducedPrecisionType(v.type); });
+}
+//-----------------------------------------------------------------------
+bool isReducedPrecisionTypeUsed(const Models::Base *model)
+{
+    return (anyReducedPrecisionType(model->getVars()) || anyReducedPrecisionType(model->getExtraGlobalParams()));
+}
+//-----------------------------------------------------------------------
+bool isReducedPrecisionTypeRequired(const ModelSpecInternal &model)
+{
+    // Reduced-precision types are required if any model variables or extra global parameters use them
+    return (std::any_of(model.getNeuronGroups().cbegin(), model.getNeuronGroups().cend(),
+                        [](const ModelSpec::NeuronGroupValueType &n){ return isReducedPrecisionTypeUsed(n.second.getNeuronModel()); })
+            || std::any_of(model.getSynapseGroups().cbegin(), model.getSynapseGroups().cend(),
+                           [](const ModelSpec::SynapseGroupValueType &s)
+                           {
+                               const auto *wum = s.second.getWUModel();
+                               return (isReducedPrecisionTypeUsed(wum) || anyReducedPrecisionType(wum->getPreVars())
+                                       || anyReducedPrecisionType(wum->getPostVars()) || isReducedPrecisionTypeUsed(s.second.getPSModel()));
+                           })
+            || std::any_of(model.getLocalCurrentSources().cbegin(), model.getLocalCurrentSources().cend(),
+                           [](const ModelSpec::CurrentSourceValueType &c){ return isReducedPrecisionTypeUsed(c.second.getCurrentSourceModel()); })
+            || std::any_of(model.getCustomUpdates().cbegin(), model.getCustomUpdates().cend(),
+                           [](const ModelSpec::CustomUpdateValueType &c){ return isReducedPrecisionTypeUsed(c.second.getCustomUpdateModel()); })
+            || std::any_of(model.getCustomWUUpdates().cbegin(), model.getCustomWUUpdates().cend(),
+                           [](const ModelSpec::CustomUpdateWUValueType &c){ return isReducedPrecisionTypeUsed(c.second.getCustomUpdateModel()); }));
+}
+//-----------------------------------------------------------------------
 template<typename G>
 void genKernelIteration(CodeStream &os, const G &g, size_t numKernelDims, const Substitutions &kernelSubs, BackendBase::Handler handler)
 {
@@ -123,13 +312,22 @@ namespace CodeGenerator
 {
 namespace SingleThreadedCPU
 {
+Backend::Backend(const std::string &scalarType, const Preferences &preferences)
+:   BackendBase(scalarType, preferences)
+{
+    // Add reduced-precision storage types defined in reducedPrecision.h
+    addType("half", 2, "-65504.0");
+    addType("bfloat16", 2, "-3.38953139e38");
+    for(int i = 0; i < 8; i++) {
+        addType("int8_q" + std::to_string(i), 1, Utils::writePreciseString(-128.0 / (double)(1 << i)));
+    }
+}
+//--------------------------------------------------------------------------
 void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
-                              HostHandler preambleHandler, HostHandler pushEGPHandler) const
+                              HostHandler preambleHandler, HostHandler pushEGPHandler, ModuleHandler moduleHandler) const
 {
     const ModelSpecInternal &model = modelMerged.getModel();
-    if(model.getBatchSize() != 1) {
-        throw std::runtime_error("The single-threaded CPU backend only supports simulations with a batch size of 1");
-    }
+    const unsigned int batchSize = model.getBatchSize();
 
     // Generate struct definitions
     modelMerged.genMergedNeuronUpdateGroupStructs(os, *this);
@@ -144,164 +342,322 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
     // Generate preamble
     preambleHandler(os);
 
-    os << "void updateNeurons(" << model.getTimePrecision() << " t";
+    // Neuron groups can only be vectorised if they don't share the global RNG
+    const auto &preferences = getPreferences<Preferences>();
+    auto isVectorised = 
+        [&preferences](const NeuronGroupInternal &ng)
+        {
+            return (preferences.vectoriseNeuronUpdate && (!ng.isSimRNGRequired() || preferences.counterBasedRNG));
+        };
+
+    // Determine size of masks required to hold spikes and spike-like events emitted by vectorised neuron groups
+    auto updateMaskSizes =
+        [&isVectorised](const NeuronUpdateGroupMerged &n, unsigned int &maxSpikeMaskSize, unsigned int &maxSpikeEventMaskSize)
+        {
+            if(isVectorised(n.getArchetype())) {
+                for(const auto &g : n.getGroups()) {
+                    if(!n.getArchetype().getNeuronModel()->getThresholdConditionCode().empty()) {
+                        maxSpikeMaskSize = std::max(maxSpikeMaskSize, g.get().getNumNeurons());
+                    }
+                    if(n.getArchetype().isSpikeEventRequired()) {
+                        maxSpikeEventMaskSize = std::max(maxSpikeEventMaskSize, g.get().getNumNeurons());
+                    }
+                }
+            }
+        };
+
+    // Declare masks
+    // **NOTE** these are reused by each neuron group in turn
+    auto genMasks =
+        [](CodeStream &os, unsigned int maxSpikeMaskSize, unsigned int maxSpikeEventMaskSize)
+        {
+            if(maxSpikeMaskSize > 0) {
+                os << "alignas(64) static uint8_t spikeMask[" << maxSpikeMaskSize << "];" << std::endl;
+            }
+            if(maxSpikeEventMaskSize > 0) {
+                os << "alignas(64) static uint8_t spikeEventMask[" << maxSpikeEventMaskSize << "];" << std::endl;
+            }
+        };
+
+    // Build parameter list and arguments of update functions
+    std::string updateParams = model.getTimePrecision() + " t";
+    std::string updateArgs = "t";
     if(model.isRecordingInUse()) {
-        os << ", unsigned int recordingTimestep";
+        updateParams += ", unsigned int recordingTimestep";
+        updateArgs += ", recordingTimestep";
     }
-    os << ")";
+
+    os << "void updateNeurons(" << updateParams << ")";
     {
         CodeStream::Scope b(os);
 
         Substitutions funcSubs(getFunctionTemplates(model.getPrecision()));
         funcSubs.addVarSubstitution("t", "t");
-        funcSubs.addVarSubstitution("batch", "0");
+        funcSubs.addVarSubstitution("batch", (batchSize > 1) ? "batch" : "0");
 
         // Push any required EGPs
         pushEGPHandler(os);
 
+        // If modules aren't split, declare masks large enough for all merged groups
+        if(!preferences.splitModules) {
+            unsigned int maxSpikeMaskSize = 0;
+            unsigned int maxSpikeEventMaskSize = 0;
+            for(const auto &n : modelMerged.getMergedNeuronUpdateGroups()) {
+                updateMaskSizes(n, maxSpikeMaskSize, maxSpikeEventMaskSize);
+            }
+            genMasks(os, maxSpikeMaskSize, maxSpikeEventMaskSize);
+        }
+
         Timer t(os, "neuronUpdate", model.isTimingEnabled());
+        TraceEvent phaseTrace(os, "neuronUpdate", "\"neuronUpdate\"", "neuronUpdate", getPreferences<Preferences>().enableTrace);
 
         // Loop through merged previous spike time update groups
-        for(const auto &n : modelMerged.getMergedNeuronPrevSpikeTimeUpdateGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged neuron prev spike update group " << n.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
-
-                // Get reference to group
-                os << "const auto *group = &mergedNeuronPrevSpikeTimeUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
-
-                if(n.getArchetype().isDelayRequired()) {
-                    // Calculate delay slot corresponding to last timestep
-                    os << "const unsigned int lastTimestepDelaySlot = (*group->spkQuePtr + " << (n.getArchetype().getNumDelaySlots() - 1) << ") % " << n.getArchetype().getNumDelaySlots() << ";" << std::endl;
-                    os << "const unsigned int lastTimestepDelayOffset = lastTimestepDelaySlot * group->numNeurons;" << std::endl;
-
-                    if(n.getArchetype().isPrevSpikeTimeRequired()) {
-                        // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
-                        os << "for(unsigned int i = 0; i < group->spkCnt[lastTimestepDelaySlot]; i++)";
-                        {
-                            CodeStream::Scope b(os);
-                            os << "group->prevST[lastTimestepDelayOffset + group->spk[lastTimestepDelayOffset + i]] = t - DT;" << std::endl;
-                        }
-                    }
-                    if(n.getArchetype().isPrevSpikeEventTimeRequired()) {
-                        // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
-                        os << "for(unsigned int i = 0; i < group->spkCntEvnt[lastTimestepDelaySlot]; i++)";
+        genMergedGroups(os, modelMerged.getMergedNeuronPrevSpikeTimeUpdateGroups(),
+                        [batchSize](CodeStream &os, const NeuronPrevSpikeTimeUpdateGroupMerged &n)
                         {
                             CodeStream::Scope b(os);
-                            os << "group->prevSET[lastTimestepDelayOffset + group->spkEvnt[lastTimestepDelayOffset + i]] = t - DT;" << std::endl;
-                        }
-                    }
-                }
-                else {
-                    if(n.getArchetype().isPrevSpikeTimeRequired()) {
-                        // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
-                        os << "for(unsigned int i = 0; i < group->spkCnt[0]; i++)";
-                        {
-                            CodeStream::Scope b(os);
-                            os << "group->prevST[group->spk[i]] = t - DT;" << std::endl;
-                        }
-                    }
-                    if(n.getArchetype().isPrevSpikeEventTimeRequired()) {
-                        // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
-                        os << "for(unsigned int i = 0; i < group->spkCntEvnt[0]; i++)";
-                        {
-                            CodeStream::Scope b(os);
-                            os << "group->prevSET[group->spkEvnt[i]] = t - DT;" << std::endl;
-                        }
-                    }
-                }
-            }
-        }
-
-        // Loop through merged neuron spike queue update groups
-        for(const auto &n : modelMerged.getMergedNeuronSpikeQueueUpdateGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged neuron spike queue update group " << n.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
-
-                // Get reference to group
-                os << "const auto *group = &mergedNeuronSpikeQueueUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
-
-                // Generate spike count reset
-                n.genMergedGroupSpikeCountReset(os, 1);
-            }
-            
-        }
-        // Loop through merged neuron update groups
-        for(const auto &n : modelMerged.getMergedNeuronUpdateGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged neuron update group " << n.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
+                            os << "// merged neuron prev spike update group " << n.getIndex() << std::endl;
+                            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
+                            {
+                                CodeStream::Scope b(os);
 
-                // Get reference to group
-                os << "const auto *group = &mergedNeuronUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
+                                // Get reference to group
+                                os << "const auto *group = &mergedNeuronPrevSpikeTimeUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
 
-                // If spike or spike-like event recording is in use
-                if(n.getArchetype().isSpikeRecordingEnabled() || n.getArchetype().isSpikeEventRecordingEnabled()) {
-                    // Calculate number of words which will be used to record this population's spikes
-                    os << "const unsigned int numRecordingWords = (group->numNeurons + 31) / 32;" << std::endl;
+                                // If model is batched, loop through batches
+                                if(batchSize > 1) {
+                                    os << "for(unsigned int batch = 0; batch < " << batchSize << "; batch++)";
+                                    os << CodeStream::OB(1);
+                                }
 
-                    // Zero spike recording buffer
-                    if(n.getArchetype().isSpikeRecordingEnabled()) {
-                        os << "std::fill_n(&group->recordSpk[recordingTimestep * numRecordingWords], numRecordingWords, 0);" << std::endl;
-                    }
+                                if(n.getArchetype().isDelayRequired()) {
+                                    // Calculate delay slot corresponding to last timestep
+                                    os << "const unsigned int lastTimestepDelaySlot = (*group->spkQuePtr + " << (n.getArchetype().getNumDelaySlots() - 1) << ") % " << n.getArchetype().getNumDelaySlots();
+                                    if(batchSize > 1) {
+                                        os << " + (batch * " << n.getArchetype().getNumDelaySlots() << ")";
+                                    }
+                                    os << ";" << std::endl;
+                                    os << "const unsigned int lastTimestepDelayOffset = lastTimestepDelaySlot * group->numNeurons;" << std::endl;
+
+                                    if(n.getArchetype().isPrevSpikeTimeRequired()) {
+                                        // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
+                                        os << "for(unsigned int i = 0; i < group->spkCnt[lastTimestepDelaySlot]; i++)";
+                                        {
+                                            CodeStream::Scope b(os);
+                                            os << "group->prevST[lastTimestepDelayOffset + group->spk[lastTimestepDelayOffset + i]] = t - DT;" << std::endl;
+                                        }
+                                    }
+                                    if(n.getArchetype().isPrevSpikeEventTimeRequired()) {
+                                        // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
+                                        os << "for(unsigned int i = 0; i < group->spkCntEvnt[lastTimestepDelaySlot]; i++)";
+                                        {
+                                            CodeStream::Scope b(os);
+                                            os << "group->prevSET[lastTimestepDelayOffset + group->spkEvnt[lastTimestepDelayOffset + i]] = t - DT;" << std::endl;
+                                        }
+                                    }
+                                }
+                                else {
+                                    const std::string batchOffset = (batchSize > 1) ? "batchOffset + " : "";
+                                    if(batchSize > 1) {
+                                        os << "const unsigned int batchOffset = group->numNeurons * batch;" << std::endl;
+                                    }
+                                    if(n.getArchetype().isPrevSpikeTimeRequired()) {
+                                        // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
+                                        os << "for(unsigned int i = 0; i < group->spkCnt[" << ((batchSize > 1) ? "batch" : "0") << "]; i++)";
+                                        {
+                                            CodeStream::Scope b(os);
+                                            os << "group->prevST[" << batchOffset << "group->spk[" << batchOffset << "i]] = t - DT;" << std::endl;
+                                        }
+                                    }
+                                    if(n.getArchetype().isPrevSpikeEventTimeRequired()) {
+                                        // Loop through neurons which spiked last timestep and set their spike time to time of previous timestep
+                                        os << "for(unsigned int i = 0; i < group->spkCntEvnt[" << ((batchSize > 1) ? "batch" : "0") << "]; i++)";
+                                        {
+                                            CodeStream::Scope b(os);
+                                            os << "group->prevSET[" << batchOffset << "group->spkEvnt[" << batchOffset << "i]] = t - DT;" << std::endl;
+                                        }
+                                    }
+                                }
 
-                    // Zero spike-like-event recording buffer
-                    if(n.getArchetype().isSpikeEventRecordingEnabled()) {
-                        os << "std::fill_n(&group->recordSpkEvent[recordingTimestep * numRecordingWords], numRecordingWords, 0);" << std::endl;
-                    }
-                }
+                                // If model is batched, close loop through batches
+                                if(batchSize > 1) {
+                                    os << CodeStream::CB(1);
+                                }
+                            }
+                        });
 
-                genNeuronIndexCalculation(os, n, 1);
-                os << std::endl;
+        // Loop through merged neuron spike queue update groups
+        genMergedGroups(os, modelMerged.getMergedNeuronSpikeQueueUpdateGroups(),
+                        [batchSize](CodeStream &os, const NeuronSpikeQueueUpdateGroupMerged &n)
+                        {
+                            CodeStream::Scope b(os);
+                            os << "// merged neuron spike queue update group " << n.getIndex() << std::endl;
+                            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
+                            {
+                                CodeStream::Scope b(os);
 
-                os << "for(unsigned int i = 0; i < group->numNeurons; i++)";
-                {
-                    CodeStream::Scope b(os);
+                                // Get reference to group
+                                os << "const auto *group = &mergedNeuronSpikeQueueUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
 
-                    Substitutions popSubs(&funcSubs);
-                    popSubs.addVarSubstitution("id", "i");
+                                // If model is batched, loop through batches
+                                if(batchSize > 1) {
+                                    os << "for(unsigned int batch = 0; batch < " << batchSize << "; batch++)";
+                                    os << CodeStream::OB(1);
+                                }
 
-                    // If this neuron group requires a simulation RNG, substitute in global RNG
-                    if(n.getArchetype().isSimRNGRequired()) {
-                        popSubs.addVarSubstitution("rng", "hostRNG");
-                    }
+                                // Generate spike count reset
+                                n.genMergedGroupSpikeCountReset(os, batchSize);
 
-                    n.generateNeuronUpdate(*this, os, modelMerged, popSubs,
-                                           // Emit true spikes
-                                           [&modelMerged, this](CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &subs)
-                                           {
-                                               // Insert code to update WU vars
-                                               ng.generateWUVarUpdate(*this, os, modelMerged, subs);
-
-                                               // Insert code to emit true spikes
-                                               genEmitSpike(os, ng, subs, true, ng.getArchetype().isSpikeRecordingEnabled());
-                                           },
-                                           // Emit spike-like events
-                                           [this](CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &subs)
-                                           {
-                                               // Insert code to emit spike-like events
-                                               genEmitSpike(os, ng, subs, false, ng.getArchetype().isSpikeEventRecordingEnabled());
-                                           });
-                }
-            }
-        }
+                                // If model is batched, close loop through batches
+                                if(batchSize > 1) {
+                                    os << CodeStream::CB(1);
+                                }
+                            }
+            
+                        });
+        // Loop through merged neuron update groups
+        genMergedGroups(os, modelMerged.getMergedNeuronUpdateGroups(),
+                        [batchSize, &funcSubs, &genMasks, &isVectorised, &modelMerged, &moduleHandler, &preferences, &updateArgs, &updateMaskSizes, &updateParams, this](CodeStream &os, const NeuronUpdateGroupMerged &n)
+                        {
+                            CodeStream::Scope b(os);
+                            os << "// merged neuron update group " << n.getIndex() << std::endl;
+                            genMergedGroupCode(os, n, "update", updateParams, updateArgs, moduleHandler,
+                                               [batchSize, &funcSubs, &genMasks, &isVectorised, &modelMerged, &n, &preferences, &updateMaskSizes, this](CodeStream &os)
+                                               {
+                                                   // If modules are split, declare masks large enough for this merged group
+                                                   if(preferences.splitModules) {
+                                                       unsigned int maxSpikeMaskSize = 0;
+                                                       unsigned int maxSpikeEventMaskSize = 0;
+                                                       updateMaskSizes(n, maxSpikeMaskSize, maxSpikeEventMaskSize);
+                                                       genMasks(os, maxSpikeMaskSize, maxSpikeEventMaskSize);
+                                                   }
+
+                                                   TraceEvent mergedTrace(os, "merged", "\"mergedNeuronUpdateGroup" + std::to_string(n.getIndex()) + "\"", "neuronUpdate", getPreferences<Preferences>().enableTrace);
+                                                   os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
+                                                   {
+                                                       CodeStream::Scope b(os);
+
+                                                       // Get reference to group
+                                                       os << "const auto *group = &mergedNeuronUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
+                                                       TraceEvent groupTrace(os, "group", "mergedNeuronUpdateGroup" + std::to_string(n.getIndex()) + "Names[g]", "neuronUpdate", getPreferences<Preferences>().enableTrace);
+
+                                                       // If this neuron group requires a simulation RNG and counter-based RNGs are enabled, derive key for this group's Philox RNG streams
+                                                       const bool counterBasedRNG = (n.getArchetype().isSimRNGRequired() && getPreferences<Preferences>().counterBasedRNG);
+                                                       if(counterBasedRNG) {
+                                                           os << "const uint64_t neuronRNGKey = GeNN::Philox::getKey(deviceRNGSeed, " << getPhiloxStream(PhiloxDomain::NEURON_UPDATE, n.getIndex()) << ");" << std::endl;
+                                                       }
+
+                                                       // If model is batched, loop through batches
+                                                       if(batchSize > 1) {
+                                                           os << "for(unsigned int batch = 0; batch < " << batchSize << "; batch++)";
+                                                           os << CodeStream::OB(1);
+                                                       }
+
+                                                       // If spike or spike-like event recording is in use
+                                                       if(n.getArchetype().isSpikeRecordingEnabled() || n.getArchetype().isSpikeEventRecordingEnabled()) {
+                                                           // Calculate number of words which will be used to record this population's spikes in each batch
+                                                           os << "const unsigned int numRecordingWords = (group->numNeurons + 31) / 32;" << std::endl;
+
+                                                           // Calculate offset of this batch's words in recording buffers
+                                                           os << "const unsigned int recordingOffset = (recordingTimestep * numRecordingWords * " << batchSize << ")";
+                                                           if(batchSize > 1) {
+                                                               os << " + (batch * numRecordingWords)";
+                                                           }
+                                                           os << ";" << std::endl;
+
+                                                           // Zero spike recording buffer
+                                                           if(n.getArchetype().isSpikeRecordingEnabled()) {
+                                                               os << "std::fill_n(&group->recordSpk[recordingOffset], numRecordingWords, 0);" << std::endl;
+                                                           }
+
+                                                           // Zero spike-like-event recording buffer
+                                                           if(n.getArchetype().isSpikeEventRecordingEnabled()) {
+                                                               os << "std::fill_n(&group->recordSpkEvent[recordingOffset], numRecordingWords, 0);" << std::endl;
+                                                           }
+                                                       }
+
+                                                       genNeuronIndexCalculation(os, n, batchSize);
+                                                       os << std::endl;
+
+                                                       // Neurons can only be updated in parallel if they don't share the global RNG
+                                                       const bool vectorised = isVectorised(n.getArchetype());
+                                                       const bool spikes = !n.getArchetype().getNeuronModel()->getThresholdConditionCode().empty();
+                                                       const bool spikeEvents = n.getArchetype().isSpikeEventRequired();
+                                                       genParallelFor(os, "group->numNeurons", "i", !n.getArchetype().isSimRNGRequired() || counterBasedRNG,
+                                                                      [batchSize, counterBasedRNG, vectorised, spikes, spikeEvents, &funcSubs, &modelMerged, &n, this](CodeStream &os)
+                                                                      {
+                                                                          Substitutions popSubs(&funcSubs);
+                                                                          popSubs.addVarSubstitution("id", "i");
+
+                                                                          // If neuron update is vectorised, clear this neuron's entries in masks
+                                                                          if(vectorised && spikes) {
+                                                                              os << "spikeMask[i] = 0;" << std::endl;
+                                                                          }
+                                                                          if(vectorised && spikeEvents) {
+                                                                              os << "spikeEventMask[i] = 0;" << std::endl;
+                                                                          }
+
+                                                                          // If counter-based RNGs are enabled, create Philox RNG for this neuron (in this batch) and timestep
+                                                                          if(counterBasedRNG) {
+                                                                              genPhiloxRNG(os, popSubs, modelMerged.getModel().getPrecision(), "neuronRNG", "neuronRNGKey",
+                                                                                           (batchSize > 1) ? "(batch * group->numNeurons) + i" : "i", "iT");
+                                                                          }
+                                                                          // Otherwise, if this neuron group requires a simulation RNG, substitute in global RNG
+                                                                          else if(n.getArchetype().isSimRNGRequired()) {
+                                                                              popSubs.addVarSubstitution("rng", "hostRNG");
+                                                                          }
+
+                                                                          n.generateNeuronUpdate(*this, os, modelMerged, popSubs,
+                                                                                                 // Emit true spikes
+                                                                                                 [batchSize, vectorised, &modelMerged, this](CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &subs)
+                                                                                                 {
+                                                                                                     // Insert code to update WU vars
+                                                                                                     ng.generateWUVarUpdate(*this, os, modelMerged, subs);
+
+                                                                                                     // If neuron update is vectorised, set mask, otherwise insert code to emit true spikes
+                                                                                                     if(vectorised) {
+                                                                                                         os << "spikeMask[" << subs["id"] << "] = 1;" << std::endl;
+                                                                                                     }
+                                                                                                     else {
+                                                                                                         genEmitSpike(os, ng, subs, batchSize, true, ng.getArchetype().isSpikeRecordingEnabled());
+                                                                                                     }
+                                                                                                 },
+                                                                                                 // Emit spike-like events
+                                                                                                 [batchSize, vectorised, this](CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &subs)
+                                                                                                 {
+                                                                                                     // If neuron update is vectorised, set mask, otherwise insert code to emit spike-like events
+                                                                                                     if(vectorised) {
+                                                                                                         os << "spikeEventMask[" << subs["id"] << "] = 1;" << std::endl;
+                                                                                                     }
+                                                                                                     else {
+                                                                                                         genEmitSpike(os, ng, subs, batchSize, false, ng.getArchetype().isSpikeEventRecordingEnabled());
+                                                                                                     }
+                                                                                                 });
+                                                                      }, vectorised);
+
+                                                       // If neuron update is vectorised, compact masks into spike queues
+                                                       if(vectorised && spikeEvents) {
+                                                           genCompactSpikes(os, n, batchSize, false, n.getArchetype().isSpikeEventRecordingEnabled());
+                                                       }
+                                                       if(vectorised && spikes) {
+                                                           genCompactSpikes(os, n, batchSize, true, n.getArchetype().isSpikeRecordingEnabled());
+                                                       }
+
+                                                       // If model is batched, close loop through batches
+                                                       if(batchSize > 1) {
+                                                           os << CodeStream::CB(1);
+                                                       }
+                                                   }
+                                               });
+                        });
     }
 }
 //--------------------------------------------------------------------------
 void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, 
-                               HostHandler preambleHandler, HostHandler pushEGPHandler) const
+                               HostHandler preambleHandler, HostHandler pushEGPHandler, ModuleHandler moduleHandler) const
 {
     const ModelSpecInternal &model = modelMerged.getModel();
-    if(model.getBatchSize() != 1) {
-        throw std::runtime_error("The single-threaded CPU backend only supports simulations with a batch size of 1");
-    }
+    const unsigned int batchSize = model.getBatchSize();
 
     // Generate struct definitions
     // **YUCK** dendritic delay update structs not actually required
@@ -320,12 +676,13 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
     // Generate preamble
     preambleHandler(os);
     
-    os << "void updateSynapses(" << model.getTimePrecision() << " t)";
+    const std::string updateParams = model.getTimePrecision() + " t";
+    os << "void updateSynapses(" << updateParams << ")";
     {
         CodeStream::Scope b(os);
         Substitutions funcSubs(getFunctionTemplates(model.getPrecision()));
         funcSubs.addVarSubstitution("t", "t");
-        funcSubs.addVarSubstitution("batch", "0");
+        funcSubs.addVarSubstitution("batch", (batchSize > 1) ? "batch" : "0");
 
         // Push any required EGPs
         pushEGPHandler(os);
@@ -334,174 +691,205 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
         {
             // Loop through merged synapse dynamics groups
             Timer t(os, "synapseDynamics", model.isTimingEnabled());
-            for(const auto &s : modelMerged.getMergedSynapseDynamicsGroups()) {
-                CodeStream::Scope b(os);
-                os << "// merged synapse dynamics group " << s.getIndex() << std::endl;
-                os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
-                {
-                    CodeStream::Scope b(os);
-
-                    // Get reference to group
-                    os << "const auto *group = &mergedSynapseDynamicsGroup" << s.getIndex() << "[g]; " << std::endl;
-
-                    genSynapseIndexCalculation(os, s, 1);
-
-                    // Loop through presynaptic neurons
-                    os << "for(unsigned int i = 0; i < group->numSrcNeurons; i++)";
-                    {
-                        // If this synapse group has sparse connectivity, loop through length of this row
-                        CodeStream::Scope b(os);
-                        if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                            os << "for(unsigned int s = 0; s < group->rowLength[i]; s++)";
-                        }
-                        // Otherwise, if it's dense, loop through each postsynaptic neuron
-                        else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::DENSE) {
-                            os << "for (unsigned int j = 0; j < group->numTrgNeurons; j++)";
-                        }
-                        else {
-                            throw std::runtime_error("Only DENSE and SPARSE format connectivity can be used for synapse dynamics");
-                        }
-                        {
-                            CodeStream::Scope b(os);
-
-                            Substitutions synSubs(&funcSubs);
-                            if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                                // Calculate index of synapse and use it to look up postsynaptic index
-                                os << "const unsigned int n = (i * group->rowStride) + s;" << std::endl;
-                                os << "const unsigned int j = group->ind[n];" << std::endl;
-
-                                synSubs.addVarSubstitution("id_syn", "n");
-                            }
-                            else {
-                                synSubs.addVarSubstitution("id_syn", "(i * group->numTrgNeurons) + j");
-                            }
-
-                            // Add pre and postsynaptic indices to substitutions
-                            synSubs.addVarSubstitution("id_pre", "i");
-                            synSubs.addVarSubstitution("id_post", "j");
-
-                            // Add correct functions for apply synaptic input
-                            if(s.getArchetype().isDendriticDelayRequired()) {
-                                synSubs.addFuncSubstitution("addToInSynDelay", 2, "group->denDelay[" + s.getPostDenDelayIndex(1, "j", "$(1)") + "] += $(0)");
-                            }
-                            else {
-                                synSubs.addFuncSubstitution("addToInSyn", 1, "group->inSyn[" + s.getPostISynIndex(1, "j") + "] += $(0)");
-                            }
+            TraceEvent phaseTrace(os, "synapseDynamics", "\"synapseDynamics\"", "synapseDynamics", getPreferences<Preferences>().enableTrace);
+            genMergedGroups(os, modelMerged.getMergedSynapseDynamicsGroups(),
+                            [&funcSubs, &model, &modelMerged, &moduleHandler, &updateParams, this](CodeStream &os, const SynapseDynamicsGroupMerged &s)
+                            {
+                                // Skip groups with lazy synapse dynamics as these are only brought up to date when synapses are touched
+                                if(s.getArchetype().isLazySynapseDynamicsRequired()) {
+                                    return;
+                                }
 
-                            if(s.getArchetype().isPresynapticOutputRequired()) {
-                                synSubs.addFuncSubstitution("addToPre", 1, "group->revInSyn[" + s.getPreISynIndex(1, synSubs["id_pre"]) + "] += $(0)");
-                            }
-                            // Call synapse dynamics handler
-                            s.generateSynapseUpdate(*this, os, modelMerged, synSubs);
-                        }
-                    }
-                }
-            }
+                                CodeStream::Scope b(os);
+                                os << "// merged synapse dynamics group " << s.getIndex() << std::endl;
+                                genMergedGroupCode(os, s, "update", updateParams, "t", moduleHandler,
+                                                   [&funcSubs, &model, &modelMerged, &s, this](CodeStream &os)
+                                                   {
+                                                       TraceEvent mergedTrace(os, "merged", "\"mergedSynapseDynamicsGroup" + std::to_string(s.getIndex()) + "\"", "synapseDynamics", getPreferences<Preferences>().enableTrace);
+                                                       os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+                                                       {
+                                                           CodeStream::Scope b(os);
+
+                                                           // Get reference to group
+                                                           os << "const auto *group = &mergedSynapseDynamicsGroup" << s.getIndex() << "[g]; " << std::endl;
+                                                           TraceEvent groupTrace(os, "group", "mergedSynapseDynamicsGroup" + std::to_string(s.getIndex()) + "Names[g]", "synapseDynamics", getPreferences<Preferences>().enableTrace);
+
+                                                           genSynapseDynamicsGroup(os, modelMerged, s, funcSubs, model.isTimingEnabled() ? "synapseDynamics" : "");
+                                                       }
+                                                   });
+                            });
         }
 
         // Presynaptic update
         {
             Timer t(os, "presynapticUpdate", model.isTimingEnabled());
-            for(const auto &s : modelMerged.getMergedPresynapticUpdateGroups()) {
-                CodeStream::Scope b(os);
-                os << "// merged presynaptic update group " << s.getIndex() << std::endl;
-                os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
-                {
-                    CodeStream::Scope b(os);
-
-                    // Get reference to group
-                    os << "const auto *group = &mergedPresynapticUpdateGroup" << s.getIndex() << "[g]; " << std::endl;
-
-                    genSynapseIndexCalculation(os, s, 1);
-                    
-                    // generate the code for processing spike-like events
-                    if (s.getArchetype().isSpikeEventRequired()) {
-                        genPresynapticUpdate(os, modelMerged, s, funcSubs, false);
-                    }
-
-                    // generate the code for processing true spike events
-                    if (s.getArchetype().isTrueSpikeRequired()) {
-                        genPresynapticUpdate(os, modelMerged, s, funcSubs, true);
-                    }
-                    os << std::endl;
-                }
-            }
+            TraceEvent phaseTrace(os, "presynapticUpdate", "\"presynapticUpdate\"", "presynapticUpdate", getPreferences<Preferences>().enableTrace);
+            genMergedGroups(os, modelMerged.getMergedPresynapticUpdateGroups(),
+                            [batchSize, &funcSubs, &modelMerged, &moduleHandler, &updateParams, this](CodeStream &os, const PresynapticUpdateGroupMerged &s)
+                            {
+                                CodeStream::Scope b(os);
+                                os << "// merged presynaptic update group " << s.getIndex() << std::endl;
+                                genMergedGroupCode(os, s, "update", updateParams, "t", moduleHandler,
+                                                   [batchSize, &funcSubs, &modelMerged, &s, this](CodeStream &os)
+                                                   {
+                                                       TraceEvent mergedTrace(os, "merged", "\"mergedPresynapticUpdateGroup" + std::to_string(s.getIndex()) + "\"", "presynapticUpdate", getPreferences<Preferences>().enableTrace);
+                                                       os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+                                                       {
+                                                           CodeStream::Scope b(os);
+
+                                                           // Get reference to group
+                                                           os << "const auto *group = &mergedPresynapticUpdateGroup" << s.getIndex() << "[g]; " << std::endl;
+                                                           TraceEvent groupTrace(os, "group", "mergedPresynapticUpdateGroup" + std::to_string(s.getIndex()) + "Names[g]", "presynapticUpdate", getPreferences<Preferences>().enableTrace);
+
+                                                           // If rows of procedural connectivity require an RNG, derive key for this group's Philox RNG streams
+                                                           if(isProceduralRowRNGRequired(s.getArchetype())) {
+                                                               os << "const uint64_t rowRNGKey = GeNN::Philox::getKey(deviceRNGSeed, " << getPhiloxStream(PhiloxDomain::PRESYNAPTIC_UPDATE, s.getIndex()) << ");" << std::endl;
+                                                           }
+
+                                                           // If model is batched, loop through batches
+                                                           if(batchSize > 1) {
+                                                               os << "for(unsigned int batch = 0; batch < " << batchSize << "; batch++)";
+                                                               os << CodeStream::OB(1);
+                                                           }
+
+                                                           genSynapseIndexCalculation(os, s, batchSize);
+
+                                                           // generate the code for processing spike-like events
+                                                           if (s.getArchetype().isSpikeEventRequired()) {
+                                                               genPresynapticUpdate(os, modelMerged, s, funcSubs, false);
+                                                           }
+
+                                                           // generate the code for processing true spike events
+                                                           if (s.getArchetype().isTrueSpikeRequired()) {
+                                                               genPresynapticUpdate(os, modelMerged, s, funcSubs, true);
+                                                           }
+
+                                                           // If model is batched, close loop through batches
+                                                           if(batchSize > 1) {
+                                                               os << CodeStream::CB(1);
+                                                           }
+                                                           os << std::endl;
+                                                       }
+                                                   });
+                            });
         }
 
         // Postsynaptic update
         {
             Timer t(os, "postsynapticUpdate", model.isTimingEnabled());
-            for(const auto &s : modelMerged.getMergedPostsynapticUpdateGroups()) {
-                CodeStream::Scope b(os);
-                os << "// merged postsynaptic update group " << s.getIndex() << std::endl;
-                os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
-                {
-                    CodeStream::Scope b(os);
-
-                    // Get reference to group
-                    os << "const auto *group = &mergedPostsynapticUpdateGroup" << s.getIndex() << "[g]; " << std::endl;
-
-                    genSynapseIndexCalculation(os, s, 1);
-
-                    // Get number of postsynaptic spikes
-                    if (s.getArchetype().getTrgNeuronGroup()->isDelayRequired() && s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired()) {
-                        os << "const unsigned int numSpikes = group->trgSpkCnt[postDelaySlot];" << std::endl;
-                    }
-                    else {
-                        os << "const unsigned int numSpikes = group->trgSpkCnt[0];" << std::endl;
-                    }
+            TraceEvent phaseTrace(os, "postsynapticUpdate", "\"postsynapticUpdate\"", "postsynapticUpdate", getPreferences<Preferences>().enableTrace);
+            genMergedGroups(os, modelMerged.getMergedPostsynapticUpdateGroups(),
+                            [batchSize, &funcSubs, &modelMerged, &moduleHandler, &updateParams, this](CodeStream &os, const PostsynapticUpdateGroupMerged &s)
+                            {
+                                CodeStream::Scope b(os);
+                                os << "// merged postsynaptic update group " << s.getIndex() << std::endl;
+                                genMergedGroupCode(os, s, "update", updateParams, "t", moduleHandler,
+                                                   [batchSize, &funcSubs, &modelMerged, &s, this](CodeStream &os)
+                                                   {
+                                                       TraceEvent mergedTrace(os, "merged", "\"mergedPostsynapticUpdateGroup" + std::to_string(s.getIndex()) + "\"", "postsynapticUpdate", getPreferences<Preferences>().enableTrace);
+                                                       os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+                                                       {
+                                                           CodeStream::Scope b(os);
+
+                                                           // Get reference to group
+                                                           os << "const auto *group = &mergedPostsynapticUpdateGroup" << s.getIndex() << "[g]; " << std::endl;
+                                                           TraceEvent groupTrace(os, "group", "mergedPostsynapticUpdateGroup" + std::to_string(s.getIndex()) + "Names[g]", "postsynapticUpdate", getPreferences<Preferences>().enableTrace);
+
+                                                           // If model is batched, loop through batches
+                                                           if(batchSize > 1) {
+                                                               os << "for(unsigned int batch = 0; batch < " << batchSize << "; batch++)";
+                                                               os << CodeStream::OB(1);
+                                                           }
+
+                                                           genSynapseIndexCalculation(os, s, batchSize);
+
+                                                           // Get number of postsynaptic spikes
+                                                           const bool delay = (s.getArchetype().getTrgNeuronGroup()->isDelayRequired() && s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired());
+                                                           os << "const unsigned int numSpikes = group->trgSpkCnt[" << s.getPostVarIndex(delay, batchSize, VarAccessDuplication::SHARED_NEURON, "") << "];" << std::endl;
+
+                                                           // Loop through postsynaptic spikes
+                                                           genParallelFor(os, "numSpikes", "j", true,
+                                                                          [batchSize, delay, &funcSubs, &modelMerged, &s, this](CodeStream &os)
+                                                                          {
+                                                                              os << "const unsigned int spike = group->trgSpk[" << s.getPostVarIndex(delay, batchSize, VarAccessDuplication::DUPLICATE, "j") << "];" << std::endl;
+
+                                                                              // Loop through column of presynaptic neurons
+                                                                              if (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                                                                  os << "const unsigned int npre = group->colLength[spike];" << std::endl;
+                                                                                  os << "for (unsigned int i = 0; i < npre; i++)";
+                                                                              }
+                                                                              else {
+                                                                                  os << "for (unsigned int i = 0; i < group->numSrcNeurons; i++)";
+                                                                              }
+                                                                              {
+                                                                                  CodeStream::Scope b(os);
+
+                                                                                  Substitutions synSubs(&funcSubs);
+                                                                                  if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                                                                      os << "const unsigned int colMajorIndex = (spike * group->colStride) + i;" << std::endl;
+                                                                                      os << "const unsigned int rowMajorIndex = group->remap[colMajorIndex];" << std::endl;
+
+                                                                                      // If presynaptic indices are stored column-major, read them rather than dividing row-major index
+                                                                                      if(isPostsynapticRemapPreIndRequired()) {
+                                                                                          synSubs.addVarSubstitution("id_pre", "group->remapPreInd[colMajorIndex]");
+                                                                                      }
+                                                                                      else {
+                                                                                          // **TODO** fast divide optimisations
+                                                                                          synSubs.addVarSubstitution("id_pre", "(rowMajorIndex / group->rowStride)");
+                                                                                      }
+                                                                                      synSubs.addVarSubstitution("id_syn", "rowMajorIndex");
+                                                                                  }
+                                                                                  else {
+                                                                                      synSubs.addVarSubstitution("id_pre", "i");
+                                                                                      synSubs.addVarSubstitution("id_syn", "((group->numTrgNeurons * i) + spike)");
+                                                                                  }
+                                                                                  synSubs.addVarSubstitution("id_post", "spike");
+
+                                                                                  // **NOTE** postsynaptic spikes may be processed in parallel so presynaptic output must be applied atomically
+                                                                                  if (s.getArchetype().isPresynapticOutputRequired()) {
+                                                                                      synSubs.addFuncSubstitution("addToPre", 1, getAtomicAdd("group->revInSyn[" + s.getPreISynIndex(batchSize, synSubs["id_pre"]) + "]", "$(0)"));
+                                                                                  }
+
+                                                                                  s.generateSynapseUpdate(*this, os, modelMerged, synSubs);
+                                                                              }
+                                                                          });
+
+                                                           // If model is batched, close loop through batches
+                                                           if(batchSize > 1) {
+                                                               os << CodeStream::CB(1);
+                                                           }
+                                                           os << std::endl;
+                                                       }
+                                                   });
+                            });
+        }
+    }
 
-                    // Loop through postsynaptic spikes
-                    os << "for (unsigned int j = 0; j < numSpikes; j++)";
+    // Generate functions to bring groups with lazy synapse dynamics up to the current time before their state is pulled
+    genMergedGroups(os, modelMerged.getMergedSynapseDynamicsGroups(),
+                    [batchSize, &model, &modelMerged, this](CodeStream &os, const SynapseDynamicsGroupMerged &s)
                     {
-                        CodeStream::Scope b(os);
-
-                        const std::string offsetTrueSpkPost = (s.getArchetype().getTrgNeuronGroup()->isTrueSpikeRequired() && s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) ? "postDelayOffset + " : "";
-                        os << "const unsigned int spike = group->trgSpk[" << offsetTrueSpkPost << "j];" << std::endl;
-
-                        // Loop through column of presynaptic neurons
-                        if (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                            os << "const unsigned int npre = group->colLength[spike];" << std::endl;
-                            os << "for (unsigned int i = 0; i < npre; i++)";
-                        }
-                        else {
-                            os << "for (unsigned int i = 0; i < group->numSrcNeurons; i++)";
-                        }
-                        {
-                            CodeStream::Scope b(os);
-
-                            Substitutions synSubs(&funcSubs);
-                            if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                                os << "const unsigned int colMajorIndex = (spike * group->colStride) + i;" << std::endl;
-                                os << "const unsigned int rowMajorIndex = group->remap[colMajorIndex];" << std::endl;
+                        if(s.getArchetype().isLazySynapseDynamicsRequired()) {
+                            os << "void updateLazySynapseDynamics" << s.getIndex() << "(unsigned int g)";
+                            {
+                                CodeStream::Scope b(os);
+                                Substitutions funcSubs(getFunctionTemplates(model.getPrecision()));
+                                funcSubs.addVarSubstitution("t", "t");
+                                funcSubs.addVarSubstitution("batch", (batchSize > 1) ? "batch" : "0");
 
-                                // **TODO** fast divide optimisations
-                                synSubs.addVarSubstitution("id_pre", "(rowMajorIndex / group->rowStride)");
-                                synSubs.addVarSubstitution("id_syn", "rowMajorIndex");
-                            }
-                            else {
-                                synSubs.addVarSubstitution("id_pre", "i");
-                                synSubs.addVarSubstitution("id_syn", "((group->numTrgNeurons * i) + spike)");
+                                // Get reference to group
+                                os << "const auto *group = &mergedSynapseDynamicsGroup" << s.getIndex() << "[g]; " << std::endl;
+                                genSynapseDynamicsGroup(os, modelMerged, s, funcSubs, "");
                             }
-                            synSubs.addVarSubstitution("id_post", "spike");
-                            if (s.getArchetype().isPresynapticOutputRequired()) {
-                                synSubs.addFuncSubstitution("addToPre", 1, "group->revInSyn[" + s.getPreISynIndex(1, synSubs["id_pre"]) + "] += $(0)");        
-                            }
-            
-                            s.generateSynapseUpdate(*this, os, modelMerged, synSubs);
                         }
-                    }
-                    os << std::endl;
-                }
-            }
-        }
-    }
+                    });
 }
 //--------------------------------------------------------------------------
 void Backend::genCustomUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, 
                               HostHandler preambleHandler, HostHandler pushEGPHandler) const
 {
     const ModelSpecInternal &model = modelMerged.getModel();
+    const unsigned int batchSize = model.getBatchSize();
 
     // Generate struct definitions
     modelMerged.genMergedCustomUpdateStructs(os, *this);
@@ -540,209 +928,316 @@ void Backend::genCustomUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
 
             {
                 Timer t(os, "customUpdate" + g, model.isTimingEnabled());
+                TraceEvent phaseTrace(os, "customUpdate" + g, "\"customUpdate" + g + "\"", "customUpdate" + g, getPreferences<Preferences>().enableTrace);
 
                 // Loop through merged custom update groups
-                for(const auto &c : modelMerged.getMergedCustomUpdateGroups()) {
-                    // If this update group isn't for current group, skip
-                    if(c.getArchetype().getUpdateGroupName() != g) {
-                        continue;
-                    }
+                genMergedGroups(os, modelMerged.getMergedCustomUpdateGroups(),
+                                [batchSize, &funcSubs, &g, &modelMerged, this](CodeStream &os, const CustomUpdateGroupMerged &c)
+                                {
+                                    // If this update group isn't for current group, skip
+                                    if(c.getArchetype().getUpdateGroupName() != g) {
+                                        return;
+                                    }
 
-                    CodeStream::Scope b(os);
-                    os << "// merged custom update group " << c.getIndex() << std::endl;
-                    os << "for(unsigned int g = 0; g < " << c.getGroups().size() << "; g++)";
-                    {
-                        CodeStream::Scope b(os);
-
-                        // Get reference to group
-                        os << "const auto *group = &mergedCustomUpdateGroup" << c.getIndex() << "[g]; " << std::endl;
-
-                        genCustomUpdateIndexCalculation(os, c);
-
-                        if (c.getArchetype().isNeuronReduction()) {
-                            // Initialise reduction targets
-                            const auto reductionTargets = genInitReductionTargets(os, c);
-
-                            // Loop through group members
-                            os << "for(unsigned int i = 0; i < group->size; i++)";
-                            {
-                                CodeStream::Scope b(os);
-
-                                Substitutions popSubs(&funcSubs);
-                                popSubs.addVarSubstitution("id", "i");
-
-                                // Generate custom update
-                                c.generateCustomUpdate(*this, os, modelMerged, popSubs);
-
-                                // Loop through reduction targets and generate reduction
-                                for (const auto &r : reductionTargets) {
-                                    os << getReductionOperation("lr" + r.name, "l" + r.name, r.access, r.type) << ";" << std::endl;
-                                }
-                            }
-
-                            // Write back reductions
-                            for (const auto &r : reductionTargets) {
-                                os << "group->" << r.name << "[" << r.index << "] = lr" << r.name << ";" << std::endl;
-                            }
-                        }
-                        else {
-                            // Loop through group members
-                            os << "for(unsigned int i = 0; i < group->size; i++)";
-                            {
-                                CodeStream::Scope b(os);
-
-                                Substitutions popSubs(&funcSubs);
-                                popSubs.addVarSubstitution("id", "i");
-
-                                // Generate custom update
-                                c.generateCustomUpdate(*this, os, modelMerged, popSubs);
-
-                                // Write back reductions
-                                genWriteBackReductions(os, c, popSubs["id"]);
-                            }
-                        }
-                    }
-                }
+                                    CodeStream::Scope b(os);
+                                    os << "// merged custom update group " << c.getIndex() << std::endl;
+                                    TraceEvent mergedTrace(os, "merged", "\"mergedCustomUpdateGroup" + std::to_string(c.getIndex()) + "\"", "customUpdate" + g, getPreferences<Preferences>().enableTrace);
+                                    os << "for(unsigned int g = 0; g < " << c.getGroups().size() << "; g++)";
+                                    {
+                                        CodeStream::Scope b(os);
+
+                                        // Get reference to group
+                                        os << "const auto *group = &mergedCustomUpdateGroup" << c.getIndex() << "[g]; " << std::endl;
+                                        TraceEvent groupTrace(os, "group", "mergedCustomUpdateGroup" + std::to_string(c.getIndex()) + "Names[g]", "customUpdate" + g, getPreferences<Preferences>().enableTrace);
+
+                                        // If update is a batch reduction
+                                        Substitutions cuSubs(&funcSubs);
+                                        if(c.getArchetype().isBatchReduction() && batchSize > 1) {
+                                            // Loop through group members
+                                            genParallelFor(os, "group->size", "i", true,
+                                                           [batchSize, &cuSubs, &modelMerged, &c, this](CodeStream &os)
+                                                           {
+                                                               Substitutions popSubs(&cuSubs);
+                                                               popSubs.addVarSubstitution("id", "i");
+
+                                                               // Initialise reduction targets
+                                                               const auto reductionTargets = genInitReductionTargets(os, c, popSubs["id"]);
+
+                                                               // Loop through batches
+                                                               os << "for(unsigned int batch = 0; batch < " << batchSize << "; batch++)";
+                                                               {
+                                                                   CodeStream::Scope b(os);
+                                                                   popSubs.addVarSubstitution("batch", "batch");
+
+                                                                   genCustomUpdateIndexCalculation(os, c);
+
+                                                                   // Generate custom update
+                                                                   c.generateCustomUpdate(*this, os, modelMerged, popSubs);
+
+                                                                   // Loop through reduction targets and generate reduction
+                                                                   for(const auto &r : reductionTargets) {
+                                                                       os << getReductionOperation("lr" + r.name, "l" + r.name, r.access, r.type) << ";" << std::endl;
+                                                                   }
+                                                               }
+
+                                                               // Loop through reduction targets and write reduced value back to memory
+                                                               for(const auto &r : reductionTargets) {
+                                                                   os << "group->" << r.name << "[" << r.index << "] = lr" << r.name << ";" << std::endl;
+                                                               }
+                                                           });
+                                        }
+                                        // Otherwise
+                                        else {
+                                            // If update is batched, loop through batches
+                                            if(c.getArchetype().isBatched()) {
+                                                os << "for(unsigned int batch = 0; batch < " << batchSize << "; batch++)";
+                                                os << CodeStream::OB(1);
+                                                cuSubs.addVarSubstitution("batch", "batch");
+                                            }
+
+                                            genCustomUpdateIndexCalculation(os, c);
+
+                                            if (c.getArchetype().isNeuronReduction()) {
+                                                // Initialise reduction targets
+                                                const auto reductionTargets = genInitReductionTargets(os, c);
+
+                                                // Loop through group members
+                                                os << "for(unsigned int i = 0; i < group->size; i++)";
+                                                {
+                                                    CodeStream::Scope b(os);
+
+                                                    Substitutions popSubs(&cuSubs);
+                                                    popSubs.addVarSubstitution("id", "i");
+
+                                                    // Generate custom update
+                                                    c.generateCustomUpdate(*this, os, modelMerged, popSubs);
+
+                                                    // Loop through reduction targets and generate reduction
+                                                    for (const auto &r : reductionTargets) {
+                                                        os << getReductionOperation("lr" + r.name, "l" + r.name, r.access, r.type) << ";" << std::endl;
+                                                    }
+                                                }
+
+                                                // Write back reductions
+                                                for (const auto &r : reductionTargets) {
+                                                    os << "group->" << r.name << "[" << r.index << "] = lr" << r.name << ";" << std::endl;
+                                                }
+                                            }
+                                            else {
+                                                // Loop through group members
+                                                genParallelFor(os, "group->size", "i", true,
+                                                               [&cuSubs, &modelMerged, &c, this](CodeStream &os)
+                                                               {
+                                                                   Substitutions popSubs(&cuSubs);
+                                                                   popSubs.addVarSubstitution("id", "i");
+
+                                                                   // Generate custom update
+                                                                   c.generateCustomUpdate(*this, os, modelMerged, popSubs);
+
+                                                                   // Write back reductions
+                                                                   genWriteBackReductions(os, c, popSubs["id"]);
+                                                               });
+                                            }
+
+                                            // If update is batched, close loop through batches
+                                            if(c.getArchetype().isBatched()) {
+                                                os << CodeStream::CB(1);
+                                            }
+                                        }
+                                    }
+                                });
 
                 // Loop through merged custom WU update groups
-                for(const auto &c : modelMerged.getMergedCustomUpdateWUGroups()) {
-                    // If this update group isn't for current group, skip
-                    if(c.getArchetype().getUpdateGroupName() != g) {
-                        continue;
-                    }
-
-                    CodeStream::Scope b(os);
-                    os << "// merged custom WU update group " << c.getIndex() << std::endl;
-                    os << "for(unsigned int g = 0; g < " << c.getGroups().size() << "; g++)";
-                    {
-                        CodeStream::Scope b(os);
-
-                        // Get reference to group
-                        os << "const auto *group = &mergedCustomUpdateWUGroup" << c.getIndex() << "[g]; " << std::endl;
-
-                        const SynapseGroupInternal *sg = c.getArchetype().getSynapseGroup();
-                        if (sg->getMatrixType() & SynapseMatrixWeight::KERNEL) {
-                            genKernelIteration(os, c, c.getArchetype().getSynapseGroup()->getKernelSize().size(), funcSubs,
-                                               [&c, &modelMerged, this]
-                                               (CodeStream &os, Substitutions &subs)
-                                               {
-                                                   // Call custom update handler
-                                                   c.generateCustomUpdate(*this, os, modelMerged, subs);
-
-                                                   // Write back reductions
-                                                   genWriteBackReductions(os, c, subs["id_syn"]);
-                                               });
-                        }
-                        else {
-                            // Loop through presynaptic neurons
-                            os << "for(unsigned int i = 0; i < group->numSrcNeurons; i++)";
-                            {
-                                // If this synapse group has sparse connectivity, loop through length of this row
-                                CodeStream::Scope b(os);
-                                if (sg->getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                                    os << "for(unsigned int s = 0; s < group->rowLength[i]; s++)";
-                                }
-                                // Otherwise, if it's dense, loop through each postsynaptic neuron
-                                else if (sg->getMatrixType() & SynapseMatrixConnectivity::DENSE) {
-                                    os << "for (unsigned int j = 0; j < group->numTrgNeurons; j++)";
-                                }
-                                else {
-                                    throw std::runtime_error("Only DENSE and SPARSE format connectivity can be used for custom updates");
-                                }
+                genMergedGroups(os, modelMerged.getMergedCustomUpdateWUGroups(),
+                                [batchSize, &funcSubs, &g, &modelMerged, this](CodeStream &os, const CustomUpdateWUGroupMerged &c)
                                 {
-                                    CodeStream::Scope b(os);
-
-                                    Substitutions synSubs(&funcSubs);
-                                    if (sg->getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                                        // Calculate index of synapse and use it to look up postsynaptic index
-                                        os << "const unsigned int n = (i * group->rowStride) + s;" << std::endl;
-                                        os << "const unsigned int j = group->ind[n];" << std::endl;
-
-                                        synSubs.addVarSubstitution("id_syn", "n");
+                                    // If this update group isn't for current group, skip
+                                    if(c.getArchetype().getUpdateGroupName() != g) {
+                                        return;
                                     }
-                                    else {
-                                        synSubs.addVarSubstitution("id_syn", "(i * group->numTrgNeurons) + j");
-                                    }
-
-                                    // Add pre and postsynaptic indices to substitutions
-                                    synSubs.addVarSubstitution("id_pre", "i");
-                                    synSubs.addVarSubstitution("id_post", "j");
 
-                                    // Call custom update handler
-                                    c.generateCustomUpdate(*this, os, modelMerged, synSubs);
-
-                                    // Write back reductions
-                                    genWriteBackReductions(os, c, synSubs["id_syn"]);
-                                }
-                            }
-                        }
-                    }
-                }
+                                    CodeStream::Scope b(os);
+                                    os << "// merged custom WU update group " << c.getIndex() << std::endl;
+                                    TraceEvent mergedTrace(os, "merged", "\"mergedCustomUpdateWUGroup" + std::to_string(c.getIndex()) + "\"", "customUpdate" + g, getPreferences<Preferences>().enableTrace);
+                                    os << "for(unsigned int g = 0; g < " << c.getGroups().size() << "; g++)";
+                                    {
+                                        CodeStream::Scope b(os);
+
+                                        // Get reference to group
+                                        os << "const auto *group = &mergedCustomUpdateWUGroup" << c.getIndex() << "[g]; " << std::endl;
+                                        TraceEvent groupTrace(os, "group", "mergedCustomUpdateWUGroup" + std::to_string(c.getIndex()) + "Names[g]", "customUpdate" + g, getPreferences<Preferences>().enableTrace);
+
+                                        const SynapseGroupInternal *sg = c.getArchetype().getSynapseGroup();
+
+                                        // If update is batched, calculate size of each batch
+                                        if(c.getArchetype().isBatched()) {
+                                            if (sg->getMatrixType() & SynapseMatrixWeight::KERNEL) {
+                                                // Loop through kernel dimensions and multiply together
+                                                os << "const unsigned int size = ";
+                                                for (size_t i = 0; i < sg->getKernelSize().size(); i++) {
+                                                    os << c.getKernelSize(i);
+                                                    if (i != (sg->getKernelSize().size() - 1)) {
+                                                        os << " * ";
+                                                    }
+                                                }
+                                                os << ";" << std::endl;
+                                            }
+                                            else {
+                                                os << "const unsigned int size = group->numSrcNeurons * group->rowStride;" << std::endl;
+                                            }
+                                        }
+
+                                        // If update is batched but isn't a batch reduction, loop through batches
+                                        Substitutions cuSubs(&funcSubs);
+                                        const bool batchLoop = (c.getArchetype().isBatched() && !c.getArchetype().isBatchReduction());
+                                        if(batchLoop) {
+                                            os << "for(unsigned int batch = 0; batch < " << batchSize << "; batch++)";
+                                            os << CodeStream::OB(1);
+                                            os << "const unsigned int batchOffset = size * batch;" << std::endl;
+                                            cuSubs.addVarSubstitution("batch", "batch");
+                                        }
+
+                                        if (sg->getMatrixType() & SynapseMatrixWeight::KERNEL) {
+                                            genKernelIteration(os, c, c.getArchetype().getSynapseGroup()->getKernelSize().size(), cuSubs,
+                                                               [&c, &modelMerged, this]
+                                                               (CodeStream &os, Substitutions &subs)
+                                                               {
+                                                                   // Call custom update handler
+                                                                   genCustomUpdateWUSynapse(os, modelMerged, c, subs);
+                                                               });
+                                        }
+                                        else {
+                                            // Loop through presynaptic neurons
+                                            genParallelFor(os, "group->numSrcNeurons", "i", true,
+                                                           [&cuSubs, &modelMerged, &c, sg, this](CodeStream &os)
+                                                           {
+                                                               // If this synapse group has sparse connectivity, loop through length of this row
+                                                               if (sg->getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                                                   os << "for(unsigned int s = 0; s < group->rowLength[i]; s++)";
+                                                               }
+                                                               // Otherwise, if it's dense, loop through each postsynaptic neuron
+                                                               else if (sg->getMatrixType() & SynapseMatrixConnectivity::DENSE) {
+                                                                   os << "for (unsigned int j = 0; j < group->numTrgNeurons; j++)";
+                                                               }
+                                                               else {
+                                                                   throw std::runtime_error("Only DENSE and SPARSE format connectivity can be used for custom updates");
+                                                               }
+                                                               {
+                                                                   CodeStream::Scope b(os);
+
+                                                                   Substitutions synSubs(&cuSubs);
+                                                                   if (sg->getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                                                       // Calculate index of synapse and use it to look up postsynaptic index
+                                                                       os << "const unsigned int n = (i * group->rowStride) + s;" << std::endl;
+                                                                       os << "const unsigned int j = group->ind[n];" << std::endl;
+
+                                                                       synSubs.addVarSubstitution("id_syn", "n");
+                                                                   }
+                                                                   else {
+                                                                       synSubs.addVarSubstitution("id_syn", "(i * group->numTrgNeurons) + j");
+                                                                   }
+
+                                                                   // Add pre and postsynaptic indices to substitutions
+                                                                   synSubs.addVarSubstitution("id_pre", "i");
+                                                                   synSubs.addVarSubstitution("id_post", "j");
+
+                                                                   // Call custom update handler
+                                                                   genCustomUpdateWUSynapse(os, modelMerged, c, synSubs);
+                                                               }
+                                                           });
+                                        }
+
+                                        // If update is batched but isn't a batch reduction, close loop through batches
+                                        if(batchLoop) {
+                                            os << CodeStream::CB(1);
+                                        }
+                                    }
+                                });
             }
 
             // Loop through merged custom WU transpose update groups
             {
                 Timer t(os, "customUpdate" + g + "Transpose", model.isTimingEnabled());
-                for(const auto &c : modelMerged.getMergedCustomUpdateTransposeWUGroups()) {
-                    // If this update group isn't for current group, skip
-                    if(c.getArchetype().getUpdateGroupName() != g) {
-                        continue;
-                    }
-
-                    CodeStream::Scope b(os);
-                    os << "// merged custom WU transpose update group " << c.getIndex() << std::endl;
-                    os << "for(unsigned int g = 0; g < " << c.getGroups().size() << "; g++)";
-                    {
-                        CodeStream::Scope b(os);
-
-                        // Get reference to group
-                        os << "const auto *group = &mergedCustomUpdateTransposeWUGroup" << c.getIndex() << "[g]; " << std::endl;
-
-                        // Get index of variable being transposed
-                        const size_t transposeVarIdx = std::distance(c.getArchetype().getVarReferences().cbegin(),
-                                                                     std::find_if(c.getArchetype().getVarReferences().cbegin(), c.getArchetype().getVarReferences().cend(),
-                                                                                  [](const Models::WUVarReference &v) { return v.getTransposeSynapseGroup() != nullptr; }));
-                        const std::string transposeVarName = c.getArchetype().getCustomUpdateModel()->getVarRefs().at(transposeVarIdx).name;
-
-                        // Loop through presynaptic neurons
-                        os << "for(unsigned int i = 0; i < group->numSrcNeurons; i++)";
-                        {
-                            CodeStream::Scope b(os);
-
-                            // Loop through each postsynaptic neuron
-                            os << "for (unsigned int j = 0; j < group->numTrgNeurons; j++)";
-                            {
-                                CodeStream::Scope b(os);
-
-                                Substitutions synSubs(&funcSubs);
-                                synSubs.addVarSubstitution("id_syn", "(i * group->numTrgNeurons) + j");
-
-                                // Add pre and postsynaptic indices to substitutions
-                                synSubs.addVarSubstitution("id_pre", "i");
-                                synSubs.addVarSubstitution("id_post", "j");
-
-                                // Call custom update handler
-                                c.generateCustomUpdate(*this, os, modelMerged, synSubs);
+                TraceEvent phaseTrace(os, "customUpdate" + g + "Transpose", "\"customUpdate" + g + "Transpose\"", "customUpdate" + g + "Transpose", getPreferences<Preferences>().enableTrace);
+                genMergedGroups(os, modelMerged.getMergedCustomUpdateTransposeWUGroups(),
+                                [batchSize, &funcSubs, &g, &modelMerged, this](CodeStream &os, const CustomUpdateTransposeWUGroupMerged &c)
+                                {
+                                    // If this update group isn't for current group, skip
+                                    if(c.getArchetype().getUpdateGroupName() != g) {
+                                        return;
+                                    }
 
-                                // Update transpose variable
-                                os << "group->" << transposeVarName << "Transpose[(j * group->numSrcNeurons) + i] = l" << transposeVarName << ";" << std::endl;
-                            }
-                        }
+                                    CodeStream::Scope b(os);
+                                    os << "// merged custom WU transpose update group " << c.getIndex() << std::endl;
+                                    TraceEvent mergedTrace(os, "merged", "\"mergedCustomUpdateTransposeWUGroup" + std::to_string(c.getIndex()) + "\"", "customUpdate" + g + "Transpose", getPreferences<Preferences>().enableTrace);
+                                    os << "for(unsigned int g = 0; g < " << c.getGroups().size() << "; g++)";
+                                    {
+                                        CodeStream::Scope b(os);
+
+                                        // Get reference to group
+                                        os << "const auto *group = &mergedCustomUpdateTransposeWUGroup" << c.getIndex() << "[g]; " << std::endl;
+                                        TraceEvent groupTrace(os, "group", "mergedCustomUpdateTransposeWUGroup" + std::to_string(c.getIndex()) + "Names[g]", "customUpdate" + g + "Transpose", getPreferences<Preferences>().enableTrace);
+
+                                        // Get index of variable being transposed
+                                        const size_t transposeVarIdx = std::distance(c.getArchetype().getVarReferences().cbegin(),
+                                                                                     std::find_if(c.getArchetype().getVarReferences().cbegin(), c.getArchetype().getVarReferences().cend(),
+                                                                                                  [](const Models::WUVarReference &v) { return v.getTransposeSynapseGroup() != nullptr; }));
+                                        const std::string transposeVarName = c.getArchetype().getCustomUpdateModel()->getVarRefs().at(transposeVarIdx).name;
+
+                                        // If update is batched, loop through batches
+                                        Substitutions cuSubs(&funcSubs);
+                                        if(c.getArchetype().isBatched()) {
+                                            os << "for(unsigned int batch = 0; batch < " << batchSize << "; batch++)";
+                                            os << CodeStream::OB(1);
+                                            os << "const unsigned int batchOffset = batch * group->numSrcNeurons * group->numTrgNeurons;" << std::endl;
+                                            cuSubs.addVarSubstitution("batch", "batch");
+                                        }
+
+                                        // Loop through presynaptic neurons
+                                        genParallelFor(os, "group->numSrcNeurons", "i", true,
+                                                       [&cuSubs, &modelMerged, &c, &transposeVarName, this](CodeStream &os)
+                                                       {
+                                                           // Loop through each postsynaptic neuron
+                                                           os << "for (unsigned int j = 0; j < group->numTrgNeurons; j++)";
+                                                           {
+                                                               CodeStream::Scope b(os);
+
+                                                               Substitutions synSubs(&cuSubs);
+                                                               synSubs.addVarSubstitution("id_syn", "(i * group->numTrgNeurons) + j");
+
+                                                               // Add pre and postsynaptic indices to substitutions
+                                                               synSubs.addVarSubstitution("id_pre", "i");
+                                                               synSubs.addVarSubstitution("id_post", "j");
+
+                                                               // Call custom update handler
+                                                               c.generateCustomUpdate(*this, os, modelMerged, synSubs);
+
+                                                               // Update transpose variable
+                                                               os << "group->" << transposeVarName << "Transpose[";
+                                                               if(c.getArchetype().isBatched()) {
+                                                                   os << "batchOffset + ";
+                                                               }
+                                                               os << "(j * group->numSrcNeurons) + i] = l" << transposeVarName << ";" << std::endl;
+                                                           }
+                                                       });
+
+                                        // If update is batched, close loop through batches
+                                        if(c.getArchetype().isBatched()) {
+                                            os << CodeStream::CB(1);
+                                        }
 
-                    }
-                }
+                                    }
+                                });
             }
         }
     }
 }
 //--------------------------------------------------------------------------
 void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged, 
-                      HostHandler preambleHandler, HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler) const
+                      HostHandler preambleHandler, HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler,
+                      ModuleHandler moduleHandler) const
 {
     const ModelSpecInternal &model = modelMerged.getModel();
-    if(model.getBatchSize() != 1) {
-        throw std::runtime_error("The single-threaded CPU backend only supports simulations with a batch size of 1");
-    }
 
     // Generate struct definitions
     modelMerged.genMergedNeuronInitGroupStructs(os, *this);
@@ -774,221 +1269,336 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
         initPushEGPHandler(os);
 
         Timer t(os, "init", model.isTimingEnabled());
+        TraceEvent phaseTrace(os, "init", "\"init\"", "init", getPreferences<Preferences>().enableTrace);
 
         // If model requires a host RNG, add RNG to substitutions
         if(isGlobalHostRNGRequired(modelMerged)) {
             funcSubs.addVarSubstitution("rng", "hostRNG");
         }
 
-        os << "// ------------------------------------------------------------------------" << std::endl;
-        os << "// Neuron groups" << std::endl;
-        for(const auto &n : modelMerged.getMergedNeuronInitGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged neuron init group " << n.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
-            {
+        // If model requires counter-based RNGs, initialise the seed used to key them
+        if(isGlobalDeviceRNGRequired(modelMerged)) {
+            // If no seed is specified, use system randomness to generate one
+            if(model.getSeed() == 0) {
                 CodeStream::Scope b(os);
-
-                // Get reference to group
-                os << "const auto *group = &mergedNeuronInitGroup" << n.getIndex() << "[g]; " << std::endl;
-                Substitutions popSubs(&funcSubs);
-                n.generateInit(*this, os, modelMerged, popSubs);
+                os << "std::random_device seedSource;" << std::endl;
+                os << "deviceRNGSeed = ((uint64_t)seedSource() << 32) | seedSource();" << std::endl;
             }
-        }
-        
-        os << "// ------------------------------------------------------------------------" << std::endl;
-        os << "// Synapse groups" << std::endl;
-        for(const auto &s : modelMerged.getMergedSynapseInitGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged synapse init group " << s.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
-
-                // Get reference to group
-                os << "const auto *group = &mergedSynapseInitGroup" << s.getIndex() << "[g]; " << std::endl;
-                Substitutions popSubs(&funcSubs);
-                s.generateInit(*this, os, modelMerged, popSubs);
+            // Otherwise, use model seed
+            else {
+                os << "deviceRNGSeed = " << model.getSeed() << ";" << std::endl;
             }
         }
 
         os << "// ------------------------------------------------------------------------" << std::endl;
-        os << "// Custom update groups" << std::endl;
-        for(const auto &c : modelMerged.getMergedCustomUpdateInitGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged custom update group " << c.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << c.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
-
-                // Get reference to group
-                os << "const auto *group = &mergedCustomUpdateInitGroup" <<c.getIndex() << "[g]; " << std::endl;
-                Substitutions popSubs(&funcSubs);
-                c.generateInit(*this, os, modelMerged, popSubs);
-            }
-        }
-
+        os << "// Neuron groups" << std::endl;
+        genMergedGroups(os, modelMerged.getMergedNeuronInitGroups(),
+                        [&funcSubs, &model, &modelMerged, &moduleHandler, this](CodeStream &os, const NeuronInitGroupMerged &n)
+                        {
+                            CodeStream::Scope b(os);
+                            os << "// merged neuron init group " << n.getIndex() << std::endl;
+                            Timer groupTimer(os, "merged" + NeuronInitGroupMerged::name + "Group" + std::to_string(n.getIndex()), model.isTimingEnabled());
+                            genMergedGroupCode(os, n, "init", "", "", moduleHandler,
+                                               [&funcSubs, &model, &modelMerged, &n, this](CodeStream &os)
+                                               {
+                                                   TraceEvent mergedTrace(os, "merged", "\"mergedNeuronInitGroup" + std::to_string(n.getIndex()) + "\"", "init", getPreferences<Preferences>().enableTrace);
+                                                   os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
+                                                   {
+                                                       CodeStream::Scope b(os);
+
+                                                       // Get reference to group
+                                                       os << "const auto *group = &mergedNeuronInitGroup" << n.getIndex() << "[g]; " << std::endl;
+                                                       TraceEvent groupTrace(os, "group", "mergedNeuronInitGroup" + std::to_string(n.getIndex()) + "Names[g]", "init", getPreferences<Preferences>().enableTrace);
+                                                       Substitutions popSubs(&funcSubs);
+
+                                                       // If variables are initialised using counter-based RNGs, derive key for this group's streams
+                                                       if(getPreferences<Preferences>().counterBasedRNG && n.getArchetype().isInitRNGRequired()) {
+                                                           genVarInitPhiloxKey(os, popSubs, model.getPrecision(), PhiloxDomain::NEURON_VAR_INIT, n.getIndex());
+                                                           genVarInitPhiloxSequenceCounter(os, popSubs, "varInitRNGSequence");
+                                                       }
+                                                       n.generateInit(*this, os, modelMerged, popSubs);
+                                                   }
+                                               });
+                        });
+        
         os << "// ------------------------------------------------------------------------" << std::endl;
-        os << "// Custom WU update groups" << std::endl;
-        for(const auto &c : modelMerged.getMergedCustomWUUpdateInitGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged custom WU update group " << c.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << c.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
-
-                // Get reference to group
-                os << "const auto *group = &mergedCustomWUUpdateInitGroup" << c.getIndex() << "[g]; " << std::endl;
-                Substitutions popSubs(&funcSubs);
-                c.generateInit(*this, os, modelMerged, popSubs);
-            }
-        }
+        os << "// Synapse groups" << std::endl;
+        genMergedGroups(os, modelMerged.getMergedSynapseInitGroups(),
+                        [&funcSubs, &model, &modelMerged, &moduleHandler, this](CodeStream &os, const SynapseInitGroupMerged &s)
+                        {
+                            CodeStream::Scope b(os);
+                            os << "// merged synapse init group " << s.getIndex() << std::endl;
+                            Timer groupTimer(os, "merged" + SynapseInitGroupMerged::name + "Group" + std::to_string(s.getIndex()), model.isTimingEnabled());
+                            genMergedGroupCode(os, s, "init", "", "", moduleHandler,
+                                               [&funcSubs, &model, &modelMerged, &s, this](CodeStream &os)
+                                               {
+                                                   TraceEvent mergedTrace(os, "merged", "\"mergedSynapseInitGroup" + std::to_string(s.getIndex()) + "\"", "init", getPreferences<Preferences>().enableTrace);
+                                                   os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+                                                   {
+                                                       CodeStream::Scope b(os);
+
+                                                       // Get reference to group
+                                                       os << "const auto *group = &mergedSynapseInitGroup" << s.getIndex() << "[g]; " << std::endl;
+                                                       TraceEvent groupTrace(os, "group", "mergedSynapseInitGroup" + std::to_string(s.getIndex()) + "Names[g]", "init", getPreferences<Preferences>().enableTrace);
+                                                       Substitutions popSubs(&funcSubs);
+
+                                                       // If variables are initialised using counter-based RNGs, derive key for this group's streams
+                                                       if(getPreferences<Preferences>().counterBasedRNG && ::Utils::isRNGRequired(s.getArchetype().getWUVarInitialisers())) {
+                                                           genVarInitPhiloxKey(os, popSubs, model.getPrecision(), PhiloxDomain::SYNAPSE_VAR_INIT, s.getIndex());
+                                                           genVarInitPhiloxSequenceCounter(os, popSubs, "varInitRNGSequence");
+                                                       }
+                                                       s.generateInit(*this, os, modelMerged, popSubs);
+
+                                                       // If synapse dynamics are lazy, synapses are initially up to date
+                                                       if(s.getArchetype().isLazySynapseDynamicsRequired()) {
+                                                           os << "std::fill_n(group->lazyT, " << model.getBatchSize() << " * group->numSrcNeurons * group->rowStride, t);" << std::endl;
+                                                       }
+                                                   }
+                                               });
+                        });
 
         os << "// ------------------------------------------------------------------------" << std::endl;
-        os << "// Synapse sparse connectivity" << std::endl;
-        for(const auto &s : modelMerged.getMergedSynapseConnectivityInitGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged synapse connectivity init group " << s.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
-
-                // Get reference to group
-                os << "const auto *group = &mergedSynapseConnectivityInitGroup" << s.getIndex() << "[g]; " << std::endl;
-
-                // If matrix connectivity is ragged
-                if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                    // Zero row lengths
-                    os << "memset(group->rowLength, 0, group->numSrcNeurons * sizeof(unsigned int));" << std::endl;
-                }
-                else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
-                    os << "const size_t gpSize = ((((size_t)group->numSrcNeurons * (size_t)group->rowStride) + 32 - 1) / 32);" << std::endl;
-                    os << "memset(group->gp, 0, gpSize * sizeof(uint32_t));" << std::endl;
-                }
-                else {
-                    throw std::runtime_error("Only BITMASK and SPARSE format connectivity can be generated using a connectivity initialiser");
-                }
-
-                // If there is row-building code in this snippet
-                Substitutions popSubs(&funcSubs);
-                const auto *snippet = s.getArchetype().getConnectivityInitialiser().getSnippet();
-                if(!snippet->getRowBuildCode().empty()) {
-                    // Generate loop through source neurons
-                    os << "for (unsigned int i = 0; i < group->numSrcNeurons; i++)";
-
-                    // Configure substitutions
-                    popSubs.addVarSubstitution("id_pre", "i");
-                    popSubs.addVarSubstitution("id_post_begin", "0");
-                    popSubs.addVarSubstitution("id_thread", "0");
-                    popSubs.addVarSubstitution("num_threads", "1");
-                    popSubs.addVarSubstitution("num_pre", "group->numSrcNeurons");
-                    popSubs.addVarSubstitution("num_post", "group->numTrgNeurons");
-                }
-                // Otherwise
-                else {
-                    assert(!snippet->getColBuildCode().empty());
-
-                    // Loop through target neurons
-                    os << "for (unsigned int j = 0; j < group->numTrgNeurons; j++)";
-
-                    // Configure substitutions
-                    popSubs.addVarSubstitution("id_post", "j");
-                    popSubs.addVarSubstitution("id_pre_begin", "0");
-                    popSubs.addVarSubstitution("id_thread", "0");
-                    popSubs.addVarSubstitution("num_threads", "1");
-                    popSubs.addVarSubstitution("num_pre", "group->numSrcNeurons");
-                    popSubs.addVarSubstitution("num_post", "group->numTrgNeurons");
-                }
-                {
-                    CodeStream::Scope b(os);
-
-                    // Create new stream to generate addSynapse function which initializes all kernel variables
-                    std::ostringstream kernelInitStream;
-                    CodeStream kernelInit(kernelInitStream);
-
-                    // Use classic macro trick to turn block of initialization code into statement and 'eat' semicolon
-                    kernelInit << "do";
-                    {
-                        CodeStream::Scope b(kernelInit);
-
-                        // Calculate index in data structure of this synapse
-                        if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                            if(!snippet->getRowBuildCode().empty()) {
-                                kernelInit << "const unsigned int idx = " << "(" + popSubs["id_pre"] + " * group->rowStride) + group->rowLength[i];" << std::endl;
-                            }
-                            else {
-                                kernelInit << "const unsigned int idx = " << "(($(0)) * group->rowStride) + group->rowLength[$(0)];" << std::endl;
-                            }
-                        }
-
-                        // If there is a kernel
-                        if(!s.getArchetype().getKernelSize().empty()) {
-                            Substitutions kernelInitSubs(&popSubs);
+        os << "// Custom update groups" << std::endl;
+        genMergedGroups(os, modelMerged.getMergedCustomUpdateInitGroups(),
+                        [&funcSubs, &model, &modelMerged, this](CodeStream &os, const CustomUpdateInitGroupMerged &c)
+                        {
+                            CodeStream::Scope b(os);
+                            os << "// merged custom update group " << c.getIndex() << std::endl;
+                            Timer groupTimer(os, "merged" + CustomUpdateInitGroupMerged::name + "Group" + std::to_string(c.getIndex()), model.isTimingEnabled());
+                            TraceEvent mergedTrace(os, "merged", "\"mergedCustomUpdateInitGroup" + std::to_string(c.getIndex()) + "\"", "init", getPreferences<Preferences>().enableTrace);
+                            os << "for(unsigned int g = 0; g < " << c.getGroups().size() << "; g++)";
+                            {
+                                CodeStream::Scope b(os);
 
-                            // Replace $(id_post) with first 'function' parameter as simulation code is
-                            // going to be, in turn, substituted into procedural connectivity generation code
-                            if(!snippet->getRowBuildCode().empty()) {
-                                kernelInitSubs.addVarSubstitution("id_post", "$(0)");
-                            }
-                            else {
-                                kernelInitSubs.addVarSubstitution("id_pre", "$(0)");
-                            }
+                                // Get reference to group
+                                os << "const auto *group = &mergedCustomUpdateInitGroup" <<c.getIndex() << "[g]; " << std::endl;
+                                TraceEvent groupTrace(os, "group", "mergedCustomUpdateInitGroup" + std::to_string(c.getIndex()) + "Names[g]", "init", getPreferences<Preferences>().enableTrace);
+                                Substitutions popSubs(&funcSubs);
 
-                            // Add index of synapse
-                            if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                                kernelInitSubs.addVarSubstitution("id_syn", "idx");
+                                // If variables are initialised using counter-based RNGs, derive key for this group's streams
+                                if(getPreferences<Preferences>().counterBasedRNG && c.getArchetype().isInitRNGRequired()) {
+                                    genVarInitPhiloxKey(os, popSubs, model.getPrecision(), PhiloxDomain::CUSTOM_UPDATE_VAR_INIT, c.getIndex());
+                                    genVarInitPhiloxSequenceCounter(os, popSubs, "varInitRNGSequence");
+                                }
+                                c.generateInit(*this, os, modelMerged, popSubs);
                             }
+                        });
 
-                            // Replace kernel indices with the subsequent 'function' parameters
-                            for(size_t i = 0; i < s.getArchetype().getKernelSize().size(); i++) {
-                                kernelInitSubs.addVarSubstitution("id_kernel_" + std::to_string(i), "$(" + std::to_string(i + 1) + ")");
-                            }
+        os << "// ------------------------------------------------------------------------" << std::endl;
+        os << "// Custom WU update groups" << std::endl;
+        genMergedGroups(os, modelMerged.getMergedCustomWUUpdateInitGroups(),
+                        [&funcSubs, &model, &modelMerged, this](CodeStream &os, const CustomWUUpdateInitGroupMerged &c)
+                        {
+                            CodeStream::Scope b(os);
+                            os << "// merged custom WU update group " << c.getIndex() << std::endl;
+                            Timer groupTimer(os, "merged" + CustomWUUpdateInitGroupMerged::name + "Group" + std::to_string(c.getIndex()), model.isTimingEnabled());
+                            TraceEvent mergedTrace(os, "merged", "\"mergedCustomWUUpdateInitGroup" + std::to_string(c.getIndex()) + "\"", "init", getPreferences<Preferences>().enableTrace);
+                            os << "for(unsigned int g = 0; g < " << c.getGroups().size() << "; g++)";
+                            {
+                                CodeStream::Scope b(os);
 
-                            // Call handler to initialize variables
-                            s.generateKernelInit(*this, kernelInit, modelMerged, kernelInitSubs);
-                        }
+                                // Get reference to group
+                                os << "const auto *group = &mergedCustomWUUpdateInitGroup" << c.getIndex() << "[g]; " << std::endl;
+                                TraceEvent groupTrace(os, "group", "mergedCustomWUUpdateInitGroup" + std::to_string(c.getIndex()) + "Names[g]", "init", getPreferences<Preferences>().enableTrace);
+                                Substitutions popSubs(&funcSubs);
 
-                        // If there is row-building code in this snippet
-                        if(!snippet->getRowBuildCode().empty()) {
-                            // If matrix is sparse, add function to increment row length and insert synapse into ind array
-                            if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                                kernelInit << "group->ind[idx] = $(0);" << std::endl;
-                                kernelInit << "group->rowLength[i]++;" << std::endl;
-                            }
-                            // Otherwise, add function to set correct bit in bitmask
-                            else {
-                                kernelInit << "const int64_t rowStartGID = i * group->rowStride;" << std::endl;
-                                kernelInit << "setB(group->gp[(rowStartGID + ($(0))) / 32], (rowStartGID + $(0)) & 31);" << std::endl;
-                            }
-                        }
-                        // Otherwise
-                        else {
-                            // If matrix is sparse, add function to increment row length and insert synapse into ind array
-                            if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                                kernelInit << "group->ind[idx] = " << popSubs["id_post"] << ";" << std::endl;
-                                kernelInit << "group->rowLength[$(0)]++;" << std::endl;
-                            }
-                            else {
-                                kernelInit << "const int64_t colStartGID = j;" << std::endl;
-                                kernelInit << "setB(group->gp[(colStartGID + (($(0)) * group->rowStride)) / 32], ((colStartGID + (($(0)) * group->rowStride)) & 31));" << std::endl;
+                                // If variables are initialised using counter-based RNGs, derive key for this group's streams
+                                if(getPreferences<Preferences>().counterBasedRNG && c.getArchetype().isInitRNGRequired()) {
+                                    genVarInitPhiloxKey(os, popSubs, model.getPrecision(), PhiloxDomain::CUSTOM_WU_UPDATE_VAR_INIT, c.getIndex());
+                                    genVarInitPhiloxSequenceCounter(os, popSubs, "varInitRNGSequence");
+                                }
+                                c.generateInit(*this, os, modelMerged, popSubs);
                             }
-                        }
-                    }
-                    kernelInit << "while(false)";
-
-                    popSubs.addFuncSubstitution("addSynapse", 1 + (unsigned int)s.getArchetype().getKernelSize().size(),
-                                                kernelInitStream.str());
+                        });
 
-                    // Call appropriate connectivity handler
-                    if(!snippet->getRowBuildCode().empty()) {
-                        s.generateSparseRowInit(*this, os, modelMerged, popSubs);
-                    }
-                    else {
-                        s.generateSparseColumnInit(*this, os, modelMerged, popSubs);
-                    }
-                }
-            }
-        }
+        os << "// ------------------------------------------------------------------------" << std::endl;
+        os << "// Synapse sparse connectivity" << std::endl;
+        genMergedGroups(os, modelMerged.getMergedSynapseConnectivityInitGroups(),
+                        [&funcSubs, &model, &modelMerged, &moduleHandler, this](CodeStream &os, const SynapseConnectivityInitGroupMerged &s)
+                        {
+                            CodeStream::Scope b(os);
+                            os << "// merged synapse connectivity init group " << s.getIndex() << std::endl;
+                            Timer groupTimer(os, "merged" + SynapseConnectivityInitGroupMerged::name + "Group" + std::to_string(s.getIndex()), model.isTimingEnabled());
+                            genMergedGroupCode(os, s, "init", "", "", moduleHandler,
+                                               [&funcSubs, &model, &modelMerged, &s, this](CodeStream &os)
+                                               {
+                                                   TraceEvent mergedTrace(os, "merged", "\"mergedSynapseConnectivityInitGroup" + std::to_string(s.getIndex()) + "\"", "init", getPreferences<Preferences>().enableTrace);
+                                                   os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+                                                   {
+                                                       CodeStream::Scope b(os);
+
+                                                       // Get reference to group
+                                                       os << "const auto *group = &mergedSynapseConnectivityInitGroup" << s.getIndex() << "[g]; " << std::endl;
+                                                       TraceEvent groupTrace(os, "group", "mergedSynapseConnectivityInitGroup" + std::to_string(s.getIndex()) + "Names[g]", "init", getPreferences<Preferences>().enableTrace);
+
+                                                       // If matrix connectivity is ragged
+                                                       if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                                           // Zero row lengths
+                                                           os << "memset(group->rowLength, 0, group->numSrcNeurons * sizeof(unsigned int));" << std::endl;
+                                                       }
+                                                       else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+                                                           os << "const size_t gpSize = ((((size_t)group->numSrcNeurons * (size_t)group->rowStride) + 32 - 1) / 32);" << std::endl;
+                                                           os << "memset(group->gp, 0, gpSize * sizeof(uint32_t));" << std::endl;
+                                                       }
+                                                       else {
+                                                           throw std::runtime_error("Only BITMASK and SPARSE format connectivity can be generated using a connectivity initialiser");
+                                                       }
+
+                                                       // If there is row-building code in this snippet
+                                                       Substitutions popSubs(&funcSubs);
+                                                       const auto *snippet = s.getArchetype().getConnectivityInitialiser().getSnippet();
+                                                       const bool rowBuild = !snippet->getRowBuildCode().empty();
+                                                       if(rowBuild) {
+                                                           // Configure substitutions
+                                                           popSubs.addVarSubstitution("id_pre", "i");
+                                                           popSubs.addVarSubstitution("id_post_begin", "0");
+                                                           popSubs.addVarSubstitution("id_thread", "0");
+                                                           popSubs.addVarSubstitution("num_threads", "1");
+                                                           popSubs.addVarSubstitution("num_pre", "group->numSrcNeurons");
+                                                           popSubs.addVarSubstitution("num_post", "group->numTrgNeurons");
+                                                       }
+                                                       // Otherwise
+                                                       else {
+                                                           assert(!snippet->getColBuildCode().empty());
+
+                                                           // Configure substitutions
+                                                           popSubs.addVarSubstitution("id_post", "j");
+                                                           popSubs.addVarSubstitution("id_pre_begin", "0");
+                                                           popSubs.addVarSubstitution("id_thread", "0");
+                                                           popSubs.addVarSubstitution("num_threads", "1");
+                                                           popSubs.addVarSubstitution("num_pre", "group->numSrcNeurons");
+                                                           popSubs.addVarSubstitution("num_post", "group->numTrgNeurons");
+                                                       }
+
+                                                       // If building connectivity requires an RNG and counter-based RNGs are enabled, 
+                                                       // derive key for this group's Philox RNG streams, giving each row or column its own stream
+                                                       const bool rngRequired = isConnectivityInitRNGRequired(s.getArchetype());
+                                                       const bool counterBasedRNG = (rngRequired && getPreferences<Preferences>().counterBasedRNG);
+                                                       if(counterBasedRNG) {
+                                                           os << "const uint64_t connectivityRNGKey = GeNN::Philox::getKey(deviceRNGSeed, " << getPhiloxStream(PhiloxDomain::CONNECTIVITY_INIT, s.getIndex()) << ");" << std::endl;
+                                                       }
+
+                                                       // Rows or columns can be built in parallel unless they share the host RNG. Columns of sparse 
+                                                       // connectivity with kernel-initialised variables are built serially so synapses stay in column order
+                                                       // **NOTE** columns of sparse connectivity and rows or columns of bitmasks (which may share words) are updated atomically
+                                                       const bool sparse = (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE);
+                                                       const bool parallel = ((!rngRequired || counterBasedRNG) && (rowBuild || !sparse || s.getArchetype().getKernelSize().empty()));
+
+                                                       // Loop through source neurons if there is row-building code or target neurons otherwise
+                                                       genParallelFor(os, rowBuild ? "group->numSrcNeurons" : "group->numTrgNeurons",
+                                                                      rowBuild ? "i" : "j", parallel,
+                                                                      [counterBasedRNG, parallel, rowBuild, sparse, &modelMerged, &popSubs, &s, this](CodeStream &os)
+                                                                      {
+                                                                          // If required, create Philox RNG for this row or column
+                                                                          Substitutions rowSubs(&popSubs);
+                                                                          if(counterBasedRNG) {
+                                                                              genPhiloxRNG(os, rowSubs, modelMerged.getModel().getPrecision(), "connectivityRNG", "connectivityRNGKey", rowBuild ? "i" : "j");
+                                                                          }
+
+                                                                          // Create new stream to generate addSynapse function which initializes all kernel variables
+                                                                          std::ostringstream kernelInitStream;
+                                                                          CodeStream kernelInit(kernelInitStream);
+
+                                                                          // Use classic macro trick to turn block of initialization code into statement and 'eat' semicolon
+                                                                          kernelInit << "do";
+                                                                          {
+                                                                              CodeStream::Scope b(kernelInit);
+
+                                                                              // Calculate index in data structure of this synapse
+                                                                              if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                                                                  if(rowBuild) {
+                                                                                      kernelInit << "const unsigned int idx = " << "(" + rowSubs["id_pre"] + " * group->rowStride) + group->rowLength[i];" << std::endl;
+                                                                                  }
+                                                                                  // **NOTE** if columns are built in parallel, row lengths are incremented atomically here
+                                                                                  else if(parallel) {
+                                                                                      kernelInit << "const unsigned int idx = " << "(($(0)) * group->rowStride) + " << getAtomicIncrement("group->rowLength[$(0)]") << ";" << std::endl;
+                                                                                  }
+                                                                                  else {
+                                                                                      kernelInit << "const unsigned int idx = " << "(($(0)) * group->rowStride) + group->rowLength[$(0)];" << std::endl;
+                                                                                  }
+                                                                              }
+
+                                                                              // If there is a kernel
+                                                                              if(!s.getArchetype().getKernelSize().empty()) {
+                                                                                  Substitutions kernelInitSubs(&rowSubs);
+
+                                                                                  // Replace $(id_post) with first 'function' parameter as simulation code is
+                                                                                  // going to be, in turn, substituted into procedural connectivity generation code
+                                                                                  if(rowBuild) {
+                                                                                      kernelInitSubs.addVarSubstitution("id_post", "$(0)");
+                                                                                  }
+                                                                                  else {
+                                                                                      kernelInitSubs.addVarSubstitution("id_pre", "$(0)");
+                                                                                  }
+
+                                                                                  // Add index of synapse
+                                                                                  if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                                                                      kernelInitSubs.addVarSubstitution("id_syn", "idx");
+                                                                                  }
+
+                                                                                  // Replace kernel indices with the subsequent 'function' parameters
+                                                                                  for(size_t i = 0; i < s.getArchetype().getKernelSize().size(); i++) {
+                                                                                      kernelInitSubs.addVarSubstitution("id_kernel_" + std::to_string(i), "$(" + std::to_string(i + 1) + ")");
+                                                                                  }
+
+                                                                                  // Call handler to initialize variables
+                                                                                  s.generateKernelInit(*this, kernelInit, modelMerged, kernelInitSubs);
+                                                                              }
+
+                                                                              // If there is row-building code in this snippet
+                                                                              if(rowBuild) {
+                                                                                  // If matrix is sparse, add function to increment row length and insert synapse into ind array
+                                                                                  if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                                                                      kernelInit << "group->ind[idx] = $(0);" << std::endl;
+                                                                                      kernelInit << "group->rowLength[i]++;" << std::endl;
+                                                                                  }
+                                                                                  // Otherwise, add function to set correct bit in bitmask
+                                                                                  else {
+                                                                                      kernelInit << "const int64_t rowStartGID = i * group->rowStride;" << std::endl;
+                                                                                      kernelInit << getAtomicOr("group->gp[(rowStartGID + ($(0))) / 32]", "(0x80000000 >> ((rowStartGID + ($(0))) & 31))") << ";" << std::endl;
+                                                                                  }
+                                                                              }
+                                                                              // Otherwise
+                                                                              else {
+                                                                                  // If matrix is sparse, add function to increment row length and insert synapse into ind array
+                                                                                  if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                                                                      kernelInit << "group->ind[idx] = " << rowSubs["id_post"] << ";" << std::endl;
+                                                                                      if(!parallel) {
+                                                                                          kernelInit << "group->rowLength[$(0)]++;" << std::endl;
+                                                                                      }
+                                                                                  }
+                                                                                  else {
+                                                                                      kernelInit << "const int64_t colStartGID = j;" << std::endl;
+                                                                                      kernelInit << getAtomicOr("group->gp[(colStartGID + (($(0)) * group->rowStride)) / 32]", "(0x80000000 >> ((colStartGID + (($(0)) * group->rowStride)) & 31))") << ";" << std::endl;
+                                                                                  }
+                                                                              }
+                                                                          }
+                                                                          kernelInit << "while(false)";
+
+                                                                          rowSubs.addFuncSubstitution("addSynapse", 1 + (unsigned int)s.getArchetype().getKernelSize().size(),
+                                                                                                      kernelInitStream.str());
+
+                                                                          // Call appropriate connectivity handler
+                                                                          if(rowBuild) {
+                                                                              s.generateSparseRowInit(*this, os, modelMerged, rowSubs);
+                                                                          }
+                                                                          else {
+                                                                              s.generateSparseColumnInit(*this, os, modelMerged, rowSubs);
+                                                                          }
+                                                                      });
+
+                                                       // If columns of sparse connectivity were built in parallel, sort each row so synapses 
+                                                       // are in the same order they would be if columns were built serially
+                                                       if(parallel && sparse && !rowBuild) {
+                                                           genParallelFor(os, "group->numSrcNeurons", "i", true,
+                                                                          [](CodeStream &os)
+                                                                          {
+                                                                              os << "std::sort(&group->ind[i * group->rowStride], &group->ind[(i * group->rowStride) + group->rowLength[i]]);" << std::endl;
+                                                                          });
+                                                       }
+                                                   }
+                                               });
+                        });
     }
     os << std::endl;
     os << "void initializeSparse()";
@@ -1000,6 +1610,7 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
         initSparsePushEGPHandler(os);
 
         Timer t(os, "initSparse", model.isTimingEnabled());
+        TraceEvent phaseTrace(os, "initSparse", "\"initSparse\"", "initSparse", getPreferences<Preferences>().enableTrace);
 
         // If model requires RNG, add it to substitutions
         if(isGlobalHostRNGRequired(modelMerged)) {
@@ -1008,86 +1619,134 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
 
         os << "// ------------------------------------------------------------------------" << std::endl;
         os << "// Synapse groups with sparse connectivity" << std::endl;
-        for(const auto &s : modelMerged.getMergedSynapseSparseInitGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged sparse synapse init group " << s.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
-
-                // Get reference to group
-                os << "const auto *group = &mergedSynapseSparseInitGroup" << s.getIndex() << "[g]; " << std::endl;
-
-                // If postsynaptic learning is required, initially zero column lengths
-                if (!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
-                    os << "// Zero column lengths" << std::endl;
-                    os << "std::fill_n(group->colLength, group->numTrgNeurons, 0);" << std::endl;
-                }
-
-                os << "// Loop through presynaptic neurons" << std::endl;
-                os << "for (unsigned int i = 0; i < group->numSrcNeurons; i++)" << std::endl;
-                {
-                    CodeStream::Scope b(os);
-
-                    // Generate sparse initialisation code
-                    if(s.getArchetype().isWUVarInitRequired()) {
-                        Substitutions popSubs(&funcSubs);
-                        popSubs.addVarSubstitution("id_pre", "i");
-                        popSubs.addVarSubstitution("row_len", "group->rowLength[i]");
-                        s.generateInit(*this, os, modelMerged, popSubs);
-                    }
-
-                    // If postsynaptic learning is required
-                    if(!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
-                        os << "// Loop through synapses in corresponding matrix row" << std::endl;
-                        os << "for(unsigned int j = 0; j < group->rowLength[i]; j++)" << std::endl;
+        genMergedGroups(os, modelMerged.getMergedSynapseSparseInitGroups(),
+                        [&funcSubs, &model, &modelMerged, &moduleHandler, this](CodeStream &os, const SynapseSparseInitGroupMerged &s)
                         {
                             CodeStream::Scope b(os);
-
-                            // If postsynaptic learning is required, calculate column length and remapping
-                            if(!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
-                                os << "// Calculate index of this synapse in the row-major matrix" << std::endl;
-                                os << "const unsigned int rowMajorIndex = (i * group->rowStride) + j;" << std::endl;
-                                os << "// Using this, lookup postsynaptic target" << std::endl;
-                                os << "const unsigned int postIndex = group->ind[rowMajorIndex];" << std::endl;
-                                os << "// From this calculate index of this synapse in the column-major matrix" << std::endl;
-                                os << "const unsigned int colMajorIndex = (postIndex * group->colStride) + group->colLength[postIndex];" << std::endl;
-                                os << "// Increment column length corresponding to this postsynaptic neuron" << std::endl;
-                                os << "group->colLength[postIndex]++;" << std::endl;
-                                os << "// Add remapping entry" << std::endl;
-                                os << "group->remap[colMajorIndex] = rowMajorIndex;" << std::endl;
-                            }
-                        }
-                    }
-                }
-            }
-        }
+                            os << "// merged sparse synapse init group " << s.getIndex() << std::endl;
+                            Timer groupTimer(os, "merged" + SynapseSparseInitGroupMerged::name + "Group" + std::to_string(s.getIndex()), model.isTimingEnabled());
+                            genMergedGroupCode(os, s, "init", "", "", moduleHandler,
+                                               [&funcSubs, &model, &modelMerged, &s, this](CodeStream &os)
+                                               {
+                                                   TraceEvent mergedTrace(os, "merged", "\"mergedSynapseSparseInitGroup" + std::to_string(s.getIndex()) + "\"", "initSparse", getPreferences<Preferences>().enableTrace);
+                                                   os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+                                                   {
+                                                       CodeStream::Scope b(os);
+
+                                                       // Get reference to group
+                                                       os << "const auto *group = &mergedSynapseSparseInitGroup" << s.getIndex() << "[g]; " << std::endl;
+                                                       TraceEvent groupTrace(os, "group", "mergedSynapseSparseInitGroup" + std::to_string(s.getIndex()) + "Names[g]", "initSparse", getPreferences<Preferences>().enableTrace);
+
+                                                       // If postsynaptic learning is required, initially zero column lengths
+                                                       if (!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
+                                                           os << "// Zero column lengths" << std::endl;
+                                                           os << "std::fill_n(group->colLength, group->numTrgNeurons, 0);" << std::endl;
+                                                       }
+
+                                                       // If synapse dynamics are lazy, synapses are initially up to date
+                                                       if(s.getArchetype().isLazySynapseDynamicsRequired()) {
+                                                           os << "std::fill_n(group->lazyT, " << model.getBatchSize() << " * group->numSrcNeurons * group->rowStride, t);" << std::endl;
+                                                       }
+
+                                                       // Generate sparse initialisation code
+                                                       if(s.getArchetype().isWUVarInitRequired()) {
+                                                           // If variables are initialised using counter-based RNGs, derive key for this group's streams
+                                                           Substitutions groupSubs(&funcSubs);
+                                                           if(getPreferences<Preferences>().counterBasedRNG && ::Utils::isRNGRequired(s.getArchetype().getWUVarInitialisers())) {
+                                                               genVarInitPhiloxKey(os, groupSubs, model.getPrecision(), PhiloxDomain::SYNAPSE_SPARSE_VAR_INIT, s.getIndex());
+                                                           }
+
+                                                           // Rows can be initialised in parallel unless they share the global RNG
+                                                           os << "// Loop through presynaptic neurons" << std::endl;
+                                                           genParallelFor(os, "group->numSrcNeurons", "i", 
+                                                                          isVarInitPhiloxRNG(groupSubs) || !::Utils::isRNGRequired(s.getArchetype().getWUVarInitialisers()),
+                                                                          [&groupSubs, &modelMerged, &s, this](CodeStream &os)
+                                                                          {
+                                                                              // If required, reset sequence so each variable in this row gets its own Philox stream
+                                                                              Substitutions popSubs(&groupSubs);
+                                                                              if(isVarInitPhiloxRNG(popSubs)) {
+                                                                                  genVarInitPhiloxSequenceCounter(os, popSubs, "rowRNGSequence");
+                                                                              }
+                                                                              popSubs.addVarSubstitution("id_pre", "i");
+                                                                              popSubs.addVarSubstitution("row_len", "group->rowLength[i]");
+                                                                              s.generateInit(*this, os, modelMerged, popSubs);
+                                                                          });
+                                                       }
+
+                                                       // If postsynaptic learning is required, calculate column lengths and remapping
+                                                       // **NOTE** column lengths are incremented in row order so this is always serial
+                                                       if(!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
+                                                           os << "// Loop through presynaptic neurons" << std::endl;
+                                                           os << "for (unsigned int i = 0; i < group->numSrcNeurons; i++)" << std::endl;
+                                                           {
+                                                               CodeStream::Scope b(os);
+
+                                                               os << "// Loop through synapses in corresponding matrix row" << std::endl;
+                                                               os << "for(unsigned int j = 0; j < group->rowLength[i]; j++)" << std::endl;
+                                                               {
+                                                                   CodeStream::Scope b(os);
+
+                                                                   os << "// Calculate index of this synapse in the row-major matrix" << std::endl;
+                                                                   os << "const unsigned int rowMajorIndex = (i * group->rowStride) + j;" << std::endl;
+                                                                   os << "// Using this, lookup postsynaptic target" << std::endl;
+                                                                   os << "const unsigned int postIndex = group->ind[rowMajorIndex];" << std::endl;
+                                                                   os << "// From this calculate index of this synapse in the column-major matrix" << std::endl;
+                                                                   os << "const unsigned int colMajorIndex = (postIndex * group->colStride) + group->colLength[postIndex];" << std::endl;
+                                                                   os << "// Increment column length corresponding to this postsynaptic neuron" << std::endl;
+                                                                   os << "group->colLength[postIndex]++;" << std::endl;
+                                                                   os << "// Add remapping entry" << std::endl;
+                                                                   os << "group->remap[colMajorIndex] = rowMajorIndex;" << std::endl;
+                                                                   if(isPostsynapticRemapPreIndRequired()) {
+                                                                       os << "group->remapPreInd[colMajorIndex] = i;" << std::endl;
+                                                                   }
+                                                               }
+                                                           }
+                                                       }
+                                                   }
+                                               });
+                        });
 
         os << "// ------------------------------------------------------------------------" << std::endl;
         os << "// Custom sparse WU update groups" << std::endl;
-        for(const auto &c : modelMerged.getMergedCustomWUUpdateSparseInitGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged custom sparse WU update group " << c.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << c.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
+        genMergedGroups(os, modelMerged.getMergedCustomWUUpdateSparseInitGroups(),
+                        [&funcSubs, &model, &modelMerged, this](CodeStream &os, const CustomWUUpdateSparseInitGroupMerged &c)
+                        {
+                            CodeStream::Scope b(os);
+                            os << "// merged custom sparse WU update group " << c.getIndex() << std::endl;
+                            Timer groupTimer(os, "merged" + CustomWUUpdateSparseInitGroupMerged::name + "Group" + std::to_string(c.getIndex()), model.isTimingEnabled());
+                            TraceEvent mergedTrace(os, "merged", "\"mergedCustomWUUpdateSparseInitGroup" + std::to_string(c.getIndex()) + "\"", "initSparse", getPreferences<Preferences>().enableTrace);
+                            os << "for(unsigned int g = 0; g < " << c.getGroups().size() << "; g++)";
+                            {
+                                CodeStream::Scope b(os);
 
-                // Get reference to group
-                os << "const auto *group = &mergedCustomWUUpdateSparseInitGroup" << c.getIndex() << "[g]; " << std::endl;
+                                // Get reference to group
+                                os << "const auto *group = &mergedCustomWUUpdateSparseInitGroup" << c.getIndex() << "[g]; " << std::endl;
+                                TraceEvent groupTrace(os, "group", "mergedCustomWUUpdateSparseInitGroup" + std::to_string(c.getIndex()) + "Names[g]", "initSparse", getPreferences<Preferences>().enableTrace);
 
-                os << "// Loop through presynaptic neurons" << std::endl;
-                os << "for (unsigned int i = 0; i < group->numSrcNeurons; i++)" << std::endl;
-                {
-                    CodeStream::Scope b(os);
+                                // If variables are initialised using counter-based RNGs, derive key for this group's streams
+                                Substitutions groupSubs(&funcSubs);
+                                if(getPreferences<Preferences>().counterBasedRNG && c.getArchetype().isInitRNGRequired()) {
+                                    genVarInitPhiloxKey(os, groupSubs, model.getPrecision(), PhiloxDomain::CUSTOM_WU_UPDATE_SPARSE_VAR_INIT, c.getIndex());
+                                }
 
-                    // Generate initialisation code  
-                    Substitutions popSubs(&funcSubs);
-                    popSubs.addVarSubstitution("id_pre", "i");
-                    popSubs.addVarSubstitution("row_len", "group->rowLength[i]");
-                    c.generateInit(*this, os, modelMerged, popSubs);
-                }
-            }
-        }
+                                // Rows can be initialised in parallel unless they share the global RNG
+                                os << "// Loop through presynaptic neurons" << std::endl;
+                                genParallelFor(os, "group->numSrcNeurons", "i", isVarInitPhiloxRNG(groupSubs) || !c.getArchetype().isInitRNGRequired(),
+                                               [&groupSubs, &modelMerged, &c, this](CodeStream &os)
+                                               {
+                                                   // If required, reset sequence so each variable in this row gets its own Philox stream
+                                                   Substitutions popSubs(&groupSubs);
+                                                   if(isVarInitPhiloxRNG(popSubs)) {
+                                                       genVarInitPhiloxSequenceCounter(os, popSubs, "rowRNGSequence");
+                                                   }
+
+                                                   // Generate initialisation code  
+                                                   popSubs.addVarSubstitution("id_pre", "i");
+                                                   popSubs.addVarSubstitution("row_len", "group->rowLength[i]");
+                                                   c.generateInit(*this, os, modelMerged, popSubs);
+                                               });
+                            }
+                        });
     }
 }
 //--------------------------------------------------------------------------
@@ -1107,9 +1766,6 @@ size_t Backend::getSynapticMatrixRowStride(const SynapseGroupInternal &sg) const
 void Backend::genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
 {
     const ModelSpecInternal &model = modelMerged.getModel();
-    if(model.getBatchSize() != 1) {
-        throw std::runtime_error("The single-threaded CPU backend only supports simulations with a batch size of 1");
-    }
 
     os << "// Standard C++ includes" << std::endl;
     os << "#include <algorithm>" << std::endl;
@@ -1122,6 +1778,28 @@ void Backend::genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &mode
     os << "#include <cmath>" << std::endl;
     os << "#include <cstdint>" << std::endl;
     os << "#include <cstring>" << std::endl;
+    os << std::endl;
+
+    // If model uses reduced-precision storage types, include them and typedef them to perform arithmetic in model precision
+    // **NOTE** these typedefs are in the global namespace so are only emitted when required to avoid clashing with user code
+    // **NOTE** int8_qN types are fixed-point with N fractional bits
+    if(isReducedPrecisionTypeRequired(model)) {
+        os << "#include \"single_threaded_cpu/reducedPrecision.h\"" << std::endl;
+        os << std::endl;
+        os << "typedef GeNN::Half<" << model.getPrecision() << "> half;" << std::endl;
+        os << "typedef GeNN::BFloat16<" << model.getPrecision() << "> bfloat16;" << std::endl;
+        for(int i = 0; i < 8; i++) {
+            os << "typedef GeNN::ScaledInt8<" << model.getPrecision() << ", " << i << "> int8_q" << i << ";" << std::endl;
+        }
+        os << std::endl;
+    }
+
+    // If tracing is enabled, declare functions to write and clear trace
+    if(getPreferences<Preferences>().enableTrace) {
+        os << "extern \"C\" EXPORT_FUNC void writeTrace(const char *filename);" << std::endl;
+        os << "extern \"C\" EXPORT_FUNC void clearTrace();" << std::endl;
+        os << std::endl;
+    }
 
      // If a global RNG is required, define standard host distributions as recreating them each call is slow
     if(isGlobalHostRNGRequired(modelMerged)) {
@@ -1132,10 +1810,28 @@ void Backend::genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &mode
     }
 }
 //--------------------------------------------------------------------------
-void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &) const
+void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
 {
     os << "#define SUPPORT_CODE_FUNC inline" << std::endl;
 
+    // Include allocator used for all arrays
+    os << "#include \"single_threaded_cpu/allocator.h\"" << std::endl;
+    os << std::endl;
+
+    // If counter-based RNGs are required, include Philox RNG
+    if(isGlobalDeviceRNGRequired(modelMerged)) {
+        os << "#include \"single_threaded_cpu/philox.h\"" << std::endl;
+        os << std::endl;
+    }
+
+    // If tracing is enabled, include trace and declare global instance
+    if(getPreferences<Preferences>().enableTrace) {
+        os << "#include \"single_threaded_cpu/trace.h\"" << std::endl;
+        os << std::endl;
+        os << "extern GeNN::Trace trace;" << std::endl;
+        os << std::endl;
+    }
+
     // CUDA and OpenCL both provide generic min and max functions 
     // to match this, bring std::min and std::max into global namespace
     os << "using std::min;" << std::endl;
@@ -1160,11 +1856,40 @@ void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerg
             os << "return 32;" << std::endl;
         }
     }
-    // Otherwise, on *nix, use __builtin_clz intrinsic
+    // Also define an inline function, matching the signature of __builtin_ctzll which counts trailing zeros of 64-bit words
+    os << "int inline gennCTZ64(unsigned long long value)";
+    {
+        CodeStream::Scope b(os);
+        os << "unsigned long trailingZero = 0;" << std::endl;
+        os << "if( _BitScanForward64(&trailingZero, value))";
+        {
+            CodeStream::Scope b(os);
+            os << "return trailingZero;" << std::endl;
+        }
+        os << "else";
+        {
+            CodeStream::Scope b(os);
+            os << "return 64;" << std::endl;
+        }
+    }
+    // Otherwise, on *nix, use __builtin_clz and __builtin_ctzll intrinsics
 #else
     os << "#define gennCLZ __builtin_clz" << std::endl;
+    os << "#define gennCTZ64 __builtin_ctzll" << std::endl;
 #endif
     os << std::endl;
+
+    // Define macro to tell compiler that loops it precedes have no loop-carried dependencies and can be vectorised
+    os << "#if defined(__clang__)" << std::endl;
+    os << "#define GENN_IVDEP _Pragma(\"clang loop vectorize(assume_safety)\")" << std::endl;
+    os << "#elif defined(__GNUC__)" << std::endl;
+    os << "#define GENN_IVDEP _Pragma(\"GCC ivdep\")" << std::endl;
+    os << "#elif defined(_MSC_VER)" << std::endl;
+    os << "#define GENN_IVDEP __pragma(loop(ivdep))" << std::endl;
+    os << "#else" << std::endl;
+    os << "#define GENN_IVDEP" << std::endl;
+    os << "#endif" << std::endl;
+    os << std::endl;
 }
 //--------------------------------------------------------------------------
 void Backend::genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerged, const MemAlloc&) const
@@ -1178,6 +1903,46 @@ void Backend::genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerg
         os << "std::exponential_distribution<" << model.getPrecision() << "> standardExponentialDistribution(" << model.scalarExpr(1.0) << ");" << std::endl;
         os << std::endl;
     }
+
+    // If tracing is enabled, implement global trace and functions to write and clear it
+    if(getPreferences<Preferences>().enableTrace) {
+        os << "GeNN::Trace trace;" << std::endl;
+        os << std::endl;
+        os << "void writeTrace(const char *filename)";
+        {
+            CodeStream::Scope b(os);
+            os << "trace.write(filename);" << std::endl;
+        }
+        os << std::endl;
+        os << "void clearTrace()";
+        {
+            CodeStream::Scope b(os);
+            os << "trace.clear();" << std::endl;
+        }
+    }
+
+    // If profile-guided optimisation is enabled, implement function to simulate model
+    // for specified number of timesteps, used by driver to collect profile
+    const unsigned int profileTimesteps = getPreferences<Preferences>().profileGuidedOptimisationTimesteps;
+    if(profileTimesteps > 0) {
+        os << std::endl;
+        os << "void collectProfile()";
+        {
+            CodeStream::Scope b(os);
+            os << "allocateMem();" << std::endl;
+            if(model.isRecordingInUse()) {
+                os << "allocateRecordingBuffers(" << profileTimesteps << ");" << std::endl;
+            }
+            os << "initialize();" << std::endl;
+            os << "initializeSparse();" << std::endl;
+            os << "for(unsigned int i = 0; i < " << profileTimesteps << "; i++)";
+            {
+                CodeStream::Scope b(os);
+                os << "stepTime();" << std::endl;
+            }
+            os << "freeMem();" << std::endl;
+        }
+    }
     os << std::endl;
 }
 //--------------------------------------------------------------------------
@@ -1205,14 +1970,14 @@ void Backend::genVariableImplementation(CodeStream &os, const std::string &type,
 //--------------------------------------------------------------------------
 void Backend::genVariableAllocation(CodeStream &os, const std::string &type, const std::string &name, VarLocation, size_t count, MemAlloc &memAlloc) const
 {
-    os << name << " = new " << type << "[" << count << "];" << std::endl;
+    os << name << " = GeNN::Allocator::allocate<" << type << ">(" << count << ", " << getPreferences<Preferences>().hugePageThreshold << ");" << std::endl;
 
     memAlloc += MemAlloc::host(count * getSize(type));
 }
 //--------------------------------------------------------------------------
 void Backend::genVariableFree(CodeStream &os, const std::string &name, VarLocation) const
 {
-    os << "delete[] " << name << ";" << std::endl;
+    os << "GeNN::Allocator::free(" << name << ");" << std::endl;
 }
 //--------------------------------------------------------------------------
 void Backend::genExtraGlobalParamDefinition(CodeStream &definitions, CodeStream &, 
@@ -1235,7 +2000,7 @@ void Backend::genExtraGlobalParamAllocation(CodeStream &os, const std::string &t
 
     const std::string pointer = pointerToPointer ? ("*" + prefix + name) : (prefix + name);
 
-    os << pointer << " = new " << underlyingType << "[" << countVarName << "];" << std::endl;
+    os << pointer << " = GeNN::Allocator::allocate<" << underlyingType << ">(" << countVarName << ", " << getPreferences<Preferences>().hugePageThreshold << ");" << std::endl;
 }
 //--------------------------------------------------------------------------
 void Backend::genExtraGlobalParamPush(CodeStream &, const std::string &, const std::string &, 
@@ -1270,58 +2035,84 @@ std::string Backend::getMergedGroupSimRNGType() const
 //--------------------------------------------------------------------------
 void Backend::genPopVariableInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const
 {
+    CodeStream::Scope b(os);
     Substitutions varSubs(&kernelSubs);
+    genVarInitPhiloxSequence(os, varSubs);
+    genVarInitPhiloxRNG(os, varSubs, "0");
     handler(os, varSubs);
 }
 //--------------------------------------------------------------------------
 void Backend::genVariableInit(CodeStream &os, const std::string &count, const std::string &indexVarName,
-                              const Substitutions &kernelSubs, Handler handler) const
+                              const Substitutions &kernelSubs, bool rngRequired, Handler handler) const
 {
-     // **TODO** loops like this should be generated like CUDA threads
-    os << "for (unsigned i = 0; i < (" << count << "); i++)";
-    {
-        CodeStream::Scope b(os);
-
-        Substitutions varSubs(&kernelSubs);
-        varSubs.addVarSubstitution(indexVarName, "i");
-        handler(os, varSubs);
-    }
+    // Variables can only be initialised in parallel if they don't use the global RNG
+    // **NOTE** with Philox RNGs, each element gets its own stream within this variable's sequence
+    CodeStream::Scope b(os);
+    genVarInitPhiloxSequence(os, kernelSubs);
+    genParallelFor(os, "(" + count + ")", "i", isVarInitPhiloxRNG(kernelSubs) || !rngRequired,
+                   [&kernelSubs, &indexVarName, handler](CodeStream &os)
+                   {
+                       Substitutions varSubs(&kernelSubs);
+                       varSubs.addVarSubstitution(indexVarName, "i");
+                       genVarInitPhiloxRNG(os, varSubs, "i");
+                       handler(os, varSubs);
+                   });
 }
 //--------------------------------------------------------------------------
 void Backend::genSparseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const
 {
+    // If Philox RNGs are being used, create one stream for this row of this variable
+    // **NOTE** synapses within a row are always initialised serially
+    Substitutions rowSubs(&kernelSubs);
+    genVarInitPhiloxSequence(os, rowSubs);
+    genVarInitPhiloxRNG(os, rowSubs, kernelSubs["id_pre"]);
+
     os << "for (unsigned j = 0; j < group->rowLength[" << kernelSubs["id_pre"] << "]; j++)";
     {
         CodeStream::Scope b(os);
 
-        Substitutions varSubs(&kernelSubs);
+        Substitutions varSubs(&rowSubs);
         varSubs.addVarSubstitution("id_syn", "(" + kernelSubs["id_pre"] + " * group->rowStride) + j");
         varSubs.addVarSubstitution("id_post", "group->ind[(" + kernelSubs["id_pre"] + " * group->rowStride) + j]");
         handler(os, varSubs);
      }
 }
 //--------------------------------------------------------------------------
-void Backend::genDenseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, Handler handler) const
+void Backend::genDenseSynapseVariableRowInit(CodeStream &os, const Substitutions &kernelSubs, bool rngRequired, Handler handler) const
 {
-    os << "for (unsigned j = 0; j < group->numTrgNeurons; j++)";
-    {
-        CodeStream::Scope b(os);
-
-        Substitutions varSubs(&kernelSubs);
-        varSubs.addVarSubstitution("id_syn", "(" + kernelSubs["id_pre"] + " * group->rowStride) + j");
-        varSubs.addVarSubstitution("id_post", "j");
-        handler(os, varSubs);
-    }
+    // Synapses within a row can only be initialised in parallel if they don't use the global RNG
+    genVarInitPhiloxSequence(os, kernelSubs);
+    genParallelFor(os, "group->numTrgNeurons", "j", isVarInitPhiloxRNG(kernelSubs) || !rngRequired,
+                   [&kernelSubs, handler](CodeStream &os)
+                   {
+                       Substitutions varSubs(&kernelSubs);
+                       varSubs.addVarSubstitution("id_syn", "(" + kernelSubs["id_pre"] + " * group->rowStride) + j");
+                       varSubs.addVarSubstitution("id_post", "j");
+                       genVarInitPhiloxRNG(os, varSubs, "j");
+                       handler(os, varSubs);
+                   });
 }
 //--------------------------------------------------------------------------
 void Backend::genKernelSynapseVariableInit(CodeStream &os, const SynapseInitGroupMerged &sg, const Substitutions &kernelSubs, Handler handler) const
 {
-    genKernelIteration(os, sg, sg.getArchetype().getKernelSize().size(), kernelSubs, handler);
+    genVarInitPhiloxSequence(os, kernelSubs);
+    genKernelIteration(os, sg, sg.getArchetype().getKernelSize().size(), kernelSubs,
+                       [handler](CodeStream &os, Substitutions &varSubs)
+                       {
+                           genVarInitPhiloxRNG(os, varSubs, varSubs["id_syn"]);
+                           handler(os, varSubs);
+                       });
 }
 //--------------------------------------------------------------------------
 void Backend::genKernelCustomUpdateVariableInit(CodeStream &os, const CustomWUUpdateInitGroupMerged &cu, const Substitutions &kernelSubs, Handler handler) const
 {
-    genKernelIteration(os, cu, cu.getArchetype().getSynapseGroup()->getKernelSize().size(), kernelSubs, handler);
+    genVarInitPhiloxSequence(os, kernelSubs);
+    genKernelIteration(os, cu, cu.getArchetype().getSynapseGroup()->getKernelSize().size(), kernelSubs,
+                       [handler](CodeStream &os, Substitutions &varSubs)
+                       {
+                           genVarInitPhiloxRNG(os, varSubs, varSubs["id_syn"]);
+                           handler(os, varSubs);
+                       });
 }
 //--------------------------------------------------------------------------
 void Backend::genVariablePush(CodeStream&, const std::string&, const std::string&, VarLocation, bool, size_t) const
@@ -1364,9 +2155,15 @@ void Backend::genCurrentSpikeLikeEventPull(CodeStream&, const NeuronGroupInterna
     assert(!getPreferences().automaticCopy);
 }
 //--------------------------------------------------------------------------
-void Backend::genGlobalDeviceRNG(CodeStream&, CodeStream&, CodeStream&, CodeStream&, CodeStream&, MemAlloc&) const
+void Backend::genGlobalDeviceRNG(CodeStream&, CodeStream &definitionsInternal, CodeStream &runner, CodeStream&, CodeStream&, MemAlloc &memAlloc) const
 {
-    assert(false);
+    // Rather than a single RNG, define seed used to key counter-based Philox RNGs
+    definitionsInternal << "EXPORT_VAR uint64_t deviceRNGSeed;" << std::endl;
+
+    // Implement seed
+    runner << "uint64_t deviceRNGSeed;" << std::endl;
+
+    memAlloc += MemAlloc::host(sizeof(uint64_t));
 }
 //--------------------------------------------------------------------------
 void Backend::genPopulationRNG(CodeStream&, CodeStream&, CodeStream&, CodeStream&, CodeStream&,
@@ -1387,23 +2184,48 @@ void Backend::genReturnFreeDeviceMemoryBytes(CodeStream &os) const
 //--------------------------------------------------------------------------
 void Backend::genMakefilePreamble(std::ostream &os) const
 {
+    const auto &preferences = getPreferences<Preferences>();
     std::string linkFlags = "-shared ";
     std::string cxxFlags = "-c -fPIC -std=c++11 -MMD -MP";
 #ifdef __APPLE__
     cxxFlags += " -Wno-return-type-c-linkage";
 #endif
-    cxxFlags += " " + getPreferences().userCxxFlagsGNU;
-    if (getPreferences().optimizeCode) {
+    cxxFlags += " " + preferences.userCxxFlagsGNU;
+    if (preferences.optimizeCode) {
         cxxFlags += " -O3 -ffast-math";
     }
-    if (getPreferences().debugCode) {
+    if (preferences.profileGuidedOptimisationTimesteps > 0) {
+        cxxFlags += " -O3";
+    }
+    if (preferences.nativeArchitecture) {
+        cxxFlags += " -march=native";
+    }
+    if (preferences.debugCode) {
         cxxFlags += " -O0 -g";
     }
+    if (preferences.linkTimeOptimisation) {
+        cxxFlags += " -flto";
+        linkFlags += "-flto ";
+    }
 
     // Write variables to preamble
     os << "CXXFLAGS := " << cxxFlags << std::endl;
     os << "LINKFLAGS := " << linkFlags << std::endl;
 
+    // If profile-guided optimisation is enabled, instrument code when collecting profile and, otherwise, 
+    // use profile and link-time optimisation (ignoring any groups which weren't run during profiling)
+    // **NOTE** whether profile should be used is only determined when compiling as it may fail to be collected during this build
+    if (preferences.profileGuidedOptimisationTimesteps > 0) {
+        os << "ifeq ($(PGO_PHASE),generate)" << std::endl;
+        os << "CXXFLAGS += -fprofile-generate" << std::endl;
+        os << "LINKFLAGS += -fprofile-generate" << std::endl;
+        os << "else" << std::endl;
+        os << "CXXFLAGS += -flto" << std::endl;
+        os << "LINKFLAGS += -flto" << std::endl;
+        os << "PROFILE_USE_FLAGS = $(shell [ -f profile.failed ] || echo -fprofile-use -fprofile-correction -Wno-missing-profile)" << std::endl;
+        os << "endif" << std::endl;
+    }
+
     os << std::endl;
 }
 //--------------------------------------------------------------------------
@@ -1415,7 +2237,28 @@ void Backend::genMakefileLinkRule(std::ostream &os) const
 void Backend::genMakefileCompileRule(std::ostream &os) const
 {
     os << "%.o: %.cc %.d" << std::endl;
-    os << "\t@$(CXX) $(CXXFLAGS) -o $@ $<" << std::endl;
+    os << "\t@$(CXX) $(CXXFLAGS) $(PROFILE_USE_FLAGS) -o $@ $<" << std::endl;
+
+    // If profile-guided optimisation is enabled
+    if(getPreferences<Preferences>().profileGuidedOptimisationTimesteps > 0) {
+        // Unless profile is being collected, objects are built using it
+        os << std::endl;
+        os << "ifneq ($(PGO_PHASE),generate)" << std::endl;
+        os << "$(OBJECTS): profile.stamp" << std::endl;
+        os << "endif" << std::endl;
+        os << std::endl;
+
+        // Add rule to collect profile whenever generated code changes by building instrumented 
+        // code and running driver which simulates model, before removing instrumented build
+        // **NOTE** if the driver fails, any partial profile is deleted and code is built without it
+        os << "profile.stamp: $(OBJECTS:.o=.cc) $(wildcard *.h)" << std::endl;
+        os << "\t@rm -f $(OBJECTS) *.gcda profile.failed" << std::endl;
+        os << "\t@$(MAKE) --no-print-directory PGO_PHASE=generate librunner.so" << std::endl;
+        os << "\t@$(CXX) -o profileDriver single_threaded_cpu/profileDriver.cc -L. -lrunner -pthread -Wl,-rpath,." << std::endl;
+        os << "\t@./profileDriver || (echo \"Collecting profile failed, building without profile-guided optimisation\"; rm -f *.gcda; touch profile.failed)" << std::endl;
+        os << "\t@rm -f $(OBJECTS) librunner.so profileDriver" << std::endl;
+        os << "\t@touch $@" << std::endl;
+    }
 }
 //--------------------------------------------------------------------------
 void Backend::genMSBuildConfigProperties(std::ostream&) const
@@ -1460,25 +2303,56 @@ void Backend::genMSBuildImportTarget(std::ostream&) const
 {
 }
 //--------------------------------------------------------------------------
+std::vector<filesystem::path> Backend::getFilesToCopy(const ModelSpecMerged &modelMerged) const
+{
+    // Copy allocator
+    std::vector<filesystem::path> files{filesystem::path("single_threaded_cpu") / "allocator.h"};
+
+    // If reduced-precision storage types are used, copy them
+    if(isReducedPrecisionTypeRequired(modelMerged.getModel())) {
+        files.push_back(filesystem::path("single_threaded_cpu") / "reducedPrecision.h");
+    }
+
+    // If counter-based RNGs are required, copy Philox RNG
+    if(isGlobalDeviceRNGRequired(modelMerged)) {
+        files.push_back(filesystem::path("single_threaded_cpu") / "philox.h");
+    }
+
+    // If tracing is enabled, copy trace
+    if(getPreferences<Preferences>().enableTrace) {
+        files.push_back(filesystem::path("single_threaded_cpu") / "trace.h");
+    }
+
+    // If profile-guided optimisation is enabled, copy driver used to collect profile
+    if(getPreferences<Preferences>().profileGuidedOptimisationTimesteps > 0) {
+        files.push_back(filesystem::path("single_threaded_cpu") / "profileDriver.cc");
+    }
+    return files;
+}
+//--------------------------------------------------------------------------
 bool Backend::isGlobalHostRNGRequired(const ModelSpecMerged &modelMerged) const
 {
-    // If any neuron groups require simulation RNGs or require RNG for initialisation, return true
+    // If any neuron groups require simulation RNGs (and aren't using counter-based RNGs) or require RNG for initialisation, return true
     // **NOTE** this takes postsynaptic model initialisation into account
     const ModelSpecInternal &model = modelMerged.getModel();
     if(std::any_of(model.getNeuronGroups().cbegin(), model.getNeuronGroups().cend(),
-                   [](const ModelSpec::NeuronGroupValueType &n)
+                   [this](const ModelSpec::NeuronGroupValueType &n)
                    {
-                       return n.second.isSimRNGRequired() || n.second.isInitRNGRequired();
+                       return ((n.second.isSimRNGRequired() || n.second.isInitRNGRequired()) 
+                               && !getPreferences<Preferences>().counterBasedRNG);
                    }))
     {
         return true;
     }
 
-    // If any synapse groups require an RNG for weight update model initialisation, return true
+    // If any synapse groups require an RNG for weight update model initialisation or for building 
+    // connectivity (and aren't using counter-based RNGs to do so), return true
     if(std::any_of(model.getSynapseGroups().cbegin(), model.getSynapseGroups().cend(),
-                   [](const ModelSpec::SynapseGroupValueType &s)
+                   [this](const ModelSpec::SynapseGroupValueType &s)
                    {
-                       return (s.second.isWUInitRNGRequired() || s.second.isHostInitRNGRequired());
+                       return (s.second.isHostInitRNGRequired()
+                               || ((::Utils::isRNGRequired(s.second.getWUVarInitialisers()) || s.second.isWUInitRNGRequired()) 
+                                   && !getPreferences<Preferences>().counterBasedRNG));
                    }))
     {
         return true;
@@ -1487,9 +2361,38 @@ bool Backend::isGlobalHostRNGRequired(const ModelSpecMerged &modelMerged) const
     return false;
 }
 //--------------------------------------------------------------------------
-bool Backend::isGlobalDeviceRNGRequired(const ModelSpecMerged &) const
+bool Backend::isGlobalDeviceRNGRequired(const ModelSpecMerged &modelMerged) const
 {
-    return false;
+    // If counter-based RNGs are enabled and any neuron groups require simulation or initialisation RNGs, return true
+    const ModelSpecInternal &model = modelMerged.getModel();
+    const bool counterBasedRNG = getPreferences<Preferences>().counterBasedRNG;
+    if(counterBasedRNG
+       && std::any_of(model.getNeuronGroups().cbegin(), model.getNeuronGroups().cend(),
+                      [](const ModelSpec::NeuronGroupValueType &n){ return (n.second.isSimRNGRequired() || n.second.isInitRNGRequired()); }))
+    {
+        return true;
+    }
+
+    // If counter-based RNGs are enabled and any custom updates require initialisation RNGs, return true
+    if(counterBasedRNG
+       && (std::any_of(model.getCustomUpdates().cbegin(), model.getCustomUpdates().cend(),
+                       [](const ModelSpec::CustomUpdateValueType &c){ return c.second.isInitRNGRequired(); })
+           || std::any_of(model.getCustomWUUpdates().cbegin(), model.getCustomWUUpdates().cend(),
+                          [](const ModelSpec::CustomUpdateWUValueType &c){ return c.second.isInitRNGRequired(); })))
+    {
+        return true;
+    }
+
+    // If any synapse groups regenerate rows of procedural connectivity using an RNG or
+    // build sparse connectivity or initialise weight update model variables using counter-based RNGs, return true
+    return std::any_of(model.getSynapseGroups().cbegin(), model.getSynapseGroups().cend(),
+                       [counterBasedRNG](const ModelSpec::SynapseGroupValueType &s)
+                       {
+                           return (isProceduralRowRNGRequired(s.second)
+                                   || (counterBasedRNG && s.second.isSparseConnectivityInitRequired()
+                                       && isConnectivityInitRNGRequired(s.second))
+                                   || (counterBasedRNG && ::Utils::isRNGRequired(s.second.getWUVarInitialisers())));
+                       });
 }
 //--------------------------------------------------------------------------
 Backend::MemorySpaces Backend::getMergedGroupMemorySpaces(const ModelSpecMerged &) const
@@ -1510,179 +2413,419 @@ boost::uuids::detail::sha1::digest_type Backend::getHashDigest() const
     return hash.get_digest();
 }
 //--------------------------------------------------------------------------
+void Backend::genParallelFor(CodeStream &os, const std::string &count, const std::string &indexVarName,
+                             bool, HostHandler handler, bool vectorise) const
+{
+    // Single-threaded backend always generates serial loops
+    if(vectorise) {
+        os << "GENN_IVDEP" << std::endl;
+    }
+    os << "for(unsigned int " << indexVarName << " = 0; " << indexVarName << " < " << count << "; " << indexVarName << "++)";
+    {
+        CodeStream::Scope b(os);
+        handler(os);
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genParallelForChunks(CodeStream &os, const std::string &count, const std::string &beginVarName,
+                                   const std::string &endVarName, const std::string &threadVarName, HostHandler handler,
+                                   const std::string&, const std::string&) const
+{
+    // Single-threaded backend processes all iterations as a single chunk
+    CodeStream::Scope b(os);
+    os << "const unsigned int " << beginVarName << " = 0;" << std::endl;
+    os << "const unsigned int " << endVarName << " = " << count << ";" << std::endl;
+    os << "const unsigned int " << threadVarName << " = 0;" << std::endl;
+    handler(os);
+}
+//--------------------------------------------------------------------------
+PresynapticUpdateStrategy Backend::getPresynapticUpdateStrategy(const SynapseGroupInternal&) const
+{
+    // With a single thread, 'atomic' adds are just additions
+    return PresynapticUpdateStrategy::ATOMIC;
+}
+//--------------------------------------------------------------------------
+bool Backend::isToeplitzConvSpecialised(const SynapseGroupInternal &sg) const
+{
+    if(sg.getMatrixType() & SynapseMatrixConnectivity::TOEPLITZ) {
+        const auto *snippet = sg.getToeplitzConnectivityInitialiser().getSnippet();
+        return ((snippet == InitToeplitzConnectivitySnippet::Conv2D::getInstance())
+                || (snippet == InitToeplitzConnectivitySnippet::AvgPoolConv2D::getInstance()));
+    }
+    else {
+        return false;
+    }
+}
+//--------------------------------------------------------------------------
 void Backend::genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg, const Substitutions &popSubs, bool trueSpike) const
 {
     // Get suffix based on type of events
     const std::string eventSuffix = trueSpike ? "" : "Evnt";
     const auto *wu = sg.getArchetype().getWUModel();
+    const unsigned int batchSize = modelMerged.getModel().getBatchSize();
 
-    if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::TOEPLITZ) {
+    // If connectivity is Toeplitz and can't be propagated spike-by-spike with specialised code
+    if((sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::TOEPLITZ) && !isToeplitzConvSpecialised(sg.getArchetype())) {
         const auto &connectInit = sg.getArchetype().getToeplitzConnectivityInitialiser();
 
         // Loop through Toeplitz matrix diagonals
-        os << "for(unsigned int j = 0; j < group->rowStride; j++)";
-        {
-            CodeStream::Scope b(os);
+        // **NOTE** each diagonal touches every presynaptic neuron so all outputs must be applied atomically
+        genParallelFor(os, "group->rowStride", "j", true,
+                       [batchSize, eventSuffix, trueSpike, wu, &connectInit, &modelMerged, &sg, &popSubs, this](CodeStream &os)
+                       {
+                           // Create substitution stack for generating procedural connectivity code
+                           Substitutions connSubs(&popSubs);
+                           connSubs.addVarSubstitution("id_diag", "j");
+
+                           // Add substitutions
+                           connSubs.addParamValueSubstitution(connectInit.getSnippet()->getParamNames(), connectInit.getParams(),
+                                                              [&sg](size_t i) { return sg.isToeplitzConnectivityInitParamHeterogeneous(i);  },
+                                                              "", "group->");
+                           connSubs.addVarValueSubstitution(connectInit.getSnippet()->getDerivedParams(), connectInit.getDerivedParams(),
+                                                            [&sg](size_t i) { return sg.isToeplitzConnectivityInitDerivedParamHeterogeneous(i);  },
+                                                            "", "group->");
+                           connSubs.addVarNameSubstitution(connectInit.getSnippet()->getExtraGlobalParams(), "", "group->");
+                           connSubs.addVarNameSubstitution(connectInit.getSnippet()->getDiagonalBuildStateVars());
+
+                           // Initialise any diagonal build state variables defined
+                           for (const auto &d : connectInit.getSnippet()->getDiagonalBuildStateVars()) {
+                               // Apply substitutions to value
+                               std::string value = d.value;
+                               connSubs.applyCheckUnreplaced(value, "toeplitz diagonal build state var : merged" + std::to_string(sg.getIndex()));
+                               value = ensureFtype(value, modelMerged.getModel().getPrecision());
+
+                               os << d.type << " " << d.name << " = " << value << ";" << std::endl;
+                           }
+
+                            // Detect spike events or spikes and do the update
+                           os << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << std::endl;
+                           os << "for (unsigned int i = 0; i < group->srcSpkCnt" << eventSuffix << "[" << sg.getPreSlot(batchSize) << "]; i++)";
+                           {
+                               CodeStream::Scope b(os);
+
+                               os << "const unsigned int ipre = group->srcSpk" << eventSuffix << "[" << sg.getPreVarIndex(batchSize, VarAccessDuplication::DUPLICATE, "i") << "];" << std::endl;
+
+                               // Create another substitution stack for generating presynaptic simulation code
+                               Substitutions presynapticUpdateSubs(&popSubs);
+                               connSubs.addVarSubstitution("id_pre", "ipre");
+                               presynapticUpdateSubs.addVarSubstitution("id_pre", "ipre");
+
+                               if(!wu->getSimSupportCode().empty()) {
+                                   os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) << ";" << std::endl;
+                               }
+
+                               // If this is a spike-like event, insert threshold check for this presynaptic neuron
+                               if(!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
+                                   os << "if(";
+
+                                   // Generate weight update threshold condition
+                                   sg.generateSpikeEventThreshold(*this, os, modelMerged, presynapticUpdateSubs);
+
+                                   os << ")";
+                                   os << CodeStream::OB(10);
+                               }
+
+                               // Replace $(id_post) with first 'function' parameter as simulation code is
+                               // going to be, in turn, substituted into procedural connectivity generation code
+                               presynapticUpdateSubs.addVarSubstitution("id_post", "$(0)");
+
+                               // Replace kernel indices with the subsequent 'function' parameters
+                               for(size_t i = 0; i < sg.getArchetype().getKernelSize().size(); i++) {
+                                   presynapticUpdateSubs.addVarSubstitution("id_kernel_" + std::to_string(i),
+                                                                            "$(" + std::to_string(i + 1) + ")");
+                               }
+
+                               if(sg.getArchetype().isDendriticDelayRequired()) {
+                                   presynapticUpdateSubs.addFuncSubstitution("addToInSynDelay", 2, getAtomicAdd("group->denDelay[" + sg.getPostDenDelayIndex(batchSize, "$(id_post)", "$(1)") + "]", "$(0)"));
+                               }
+                               else {
+                                   presynapticUpdateSubs.addFuncSubstitution("addToInSyn", 1, getAtomicAdd("group->inSyn[" + sg.getPostISynIndex(batchSize, "$(id_post)") + "]", "$(0)"));
+                               }
+
+                               if(sg.getArchetype().isPresynapticOutputRequired()) {
+                                   presynapticUpdateSubs.addFuncSubstitution("addToPre", 1, getAtomicAdd("group->revInSyn[" + sg.getPreISynIndex(batchSize, "ipre") + "]", "$(0)"));
+                               }
+
+                               // Generate presynaptic simulation code into new stringstream-backed code stream
+                               std::ostringstream presynapticUpdateStream;
+                               CodeStream presynapticUpdate(presynapticUpdateStream);
+                               if(trueSpike) {
+                                   sg.generateSpikeUpdate(*this, presynapticUpdate, modelMerged, presynapticUpdateSubs);
+                               }
+                               else {
+                                   sg.generateSpikeEventUpdate(*this, presynapticUpdate, modelMerged, presynapticUpdateSubs);
+                               }
+
+                               // When a synapse should be 'added', substitute in presynaptic update code
+                               connSubs.addFuncSubstitution("addSynapse", 1 + (unsigned int)sg.getArchetype().getKernelSize().size(), presynapticUpdateStream.str());
+
+                               // Generate toeplitz connectivity code
+                               sg.generateToeplitzConnectivity(*this, os, modelMerged, connSubs);
+
+                               if(!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
+                                   os << CodeStream::CB(130); // end if (eCode)
+                               }
+                           }
+                       });
+    }
+    else {
+        CodeStream::Scope b(os);
+
+        // Detect spike events or spikes and do the update
+        os << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << std::endl;
+        os << "const unsigned int numSpikes = group->srcSpkCnt" << eventSuffix << "[" << sg.getPreSlot(batchSize) << "];" << std::endl;
+
+        const auto strategy = getPresynapticUpdateStrategy(sg.getArchetype());
+        const bool dendriticDelay = sg.getArchetype().isDendriticDelayRequired();
+        Substitutions inSynSubs(&popSubs);
+
+        // If timing is enabled, measure balance of work between threads
+        const std::string loadName = modelMerged.getModel().isTimingEnabled() ? "presynapticUpdate" : "";
 
-            // Create substitution stack for generating procedural connectivity code
-            Substitutions connSubs(&popSubs);
-            connSubs.addVarSubstitution("id_diag", "j");
-
-            // Add substitutions
-            connSubs.addParamValueSubstitution(connectInit.getSnippet()->getParamNames(), connectInit.getParams(),
-                                               [&sg](size_t i) { return sg.isToeplitzConnectivityInitParamHeterogeneous(i);  },
-                                               "", "group->");
-            connSubs.addVarValueSubstitution(connectInit.getSnippet()->getDerivedParams(), connectInit.getDerivedParams(),
-                                             [&sg](size_t i) { return sg.isToeplitzConnectivityInitDerivedParamHeterogeneous(i);  },
-                                             "", "group->");
-            connSubs.addVarNameSubstitution(connectInit.getSnippet()->getExtraGlobalParams(), "", "group->");
-            connSubs.addVarNameSubstitution(connectInit.getSnippet()->getDiagonalBuildStateVars());
-
-            // Initialise any diagonal build state variables defined
-            for (const auto &d : connectInit.getSnippet()->getDiagonalBuildStateVars()) {
-                // Apply substitutions to value
-                std::string value = d.value;
-                connSubs.applyCheckUnreplaced(value, "toeplitz diagonal build state var : merged" + std::to_string(sg.getIndex()));
-                value = ensureFtype(value, modelMerged.getModel().getPrecision());
-
-                os << d.type << " " << d.name << " = " << value << ";" << std::endl;
+        // If connectivity is sparse, weight each spike by the length of its row when balancing work between threads
+        const std::string spikeWeight = (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) 
+            ? ("group->rowLength[group->srcSpk" + eventSuffix + "[" + sg.getPreVarIndex(batchSize, VarAccessDuplication::DUPLICATE, "$(id)") + "]]") : "";
+
+        // If each thread owns a range of postsynaptic neurons
+        if(strategy == PresynapticUpdateStrategy::POST_OWNERSHIP) {
+            // **NOTE** postsynaptic input can be added non-atomically but all threads process every spike so presynaptic output must be applied atomically
+            if(dendriticDelay) {
+                inSynSubs.addFuncSubstitution("addToInSynDelay", 2, "group->denDelay[" + sg.getPostDenDelayIndex(batchSize, "$(id_post)", "$(1)") + "] += $(0)");
+            }
+            else {
+                inSynSubs.addFuncSubstitution("addToInSyn", 1, "group->inSyn[" + sg.getPostISynIndex(batchSize, "$(id_post)") + "] += $(0)");
+            }
+
+            if(sg.getArchetype().isPresynapticOutputRequired()) {
+                inSynSubs.addFuncSubstitution("addToPre", 1, getAtomicAdd("group->revInSyn[" + sg.getPreISynIndex(batchSize, "ipre") + "]", "$(0)"));
             }
 
-             // Detect spike events or spikes and do the update
-            os << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << std::endl;
-            if(sg.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
-                os << "for (unsigned int i = 0; i < group->srcSpkCnt" << eventSuffix << "[preDelaySlot]; i++)";
+            // Split postsynaptic neurons between threads and loop through all spikes on each one
+            genParallelForChunks(os, "group->numTrgNeurons", "postBegin", "postEnd", "thread",
+                                 [trueSpike, &inSynSubs, &modelMerged, &sg, this](CodeStream &os)
+                                 {
+                                     genPresynapticSpikeLoop(os, modelMerged, sg, inSynSubs, trueSpike, "0", "numSpikes", "postBegin", "postEnd");
+                                 }, "", loadName);
+        }
+        // Otherwise, if each thread accumulates input into a private buffer
+        else if(strategy == PresynapticUpdateStrategy::THREAD_ACCUMULATOR) {
+            // Indices into buffers are calculated as if model wasn't batched; the batch offset is added during the reduction
+            if(dendriticDelay) {
+                inSynSubs.addFuncSubstitution("addToInSynDelay", 2, "threadInSynBuffer[" + sg.getPostDenDelayIndex(1, "$(id_post)", "$(1)") + "] += $(0)");
             }
             else {
-                os << "for (unsigned int i = 0; i < group->srcSpkCnt" << eventSuffix << "[0]; i++)";
+                inSynSubs.addFuncSubstitution("addToInSyn", 1, "threadInSynBuffer[$(id_post)] += $(0)");
+            }
+
+            if(sg.getArchetype().isPresynapticOutputRequired()) {
+                inSynSubs.addFuncSubstitution("addToPre", 1, "group->revInSyn[" + sg.getPreISynIndex(batchSize, "ipre") + "] += $(0)");
             }
+
+            // Skip accumulation and reduction entirely if there are no spikes
+            os << "if(numSpikes > 0)";
             {
                 CodeStream::Scope b(os);
 
-                const std::string queueOffset = sg.getArchetype().getSrcNeuronGroup()->isDelayRequired() ? "preDelayOffset + " : "";
-                os << "const unsigned int ipre = group->srcSpk" << eventSuffix << "[" << queueOffset << "i];" << std::endl;
-
-                // Create another substitution stack for generating presynaptic simulation code
-                Substitutions presynapticUpdateSubs(&popSubs);
-                connSubs.addVarSubstitution("id_pre", "ipre");
-                presynapticUpdateSubs.addVarSubstitution("id_pre", "ipre");
+                os << "const unsigned int accumSize = group->numTrgNeurons";
+                if(dendriticDelay) {
+                    os << " * " << sg.getArchetype().getMaxDendriticDelayTimesteps();
+                }
+                os << ";" << std::endl;
+                os << "const unsigned int numThreads = " << getNumThreads() << ";" << std::endl;
 
-                if(!wu->getSimSupportCode().empty()) {
-                    os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) << ";" << std::endl;
+                // Grow buffer with space for each thread to accumulate input if required
+                // **NOTE** the reduction re-zeroes buffer so it never needs clearing
+                os << "static std::vector<scalar> threadInSyn;" << std::endl;
+                os << "if(threadInSyn.size() < (numThreads * accumSize))";
+                {
+                    CodeStream::Scope b(os);
+                    os << "threadInSyn.resize(numThreads * accumSize, 0);" << std::endl;
                 }
+                os << "scalar *threadInSynData = threadInSyn.data();" << std::endl;
+
+                // Split spikes between threads and accumulate input into each thread's buffer
+                genParallelForChunks(os, "numSpikes", "spikeBegin", "spikeEnd", "thread",
+                                     [trueSpike, &inSynSubs, &modelMerged, &sg, this](CodeStream &os)
+                                     {
+                                         os << "scalar *threadInSynBuffer = &threadInSynData[thread * accumSize];" << std::endl;
+                                         genPresynapticSpikeLoop(os, modelMerged, sg, inSynSubs, trueSpike, "spikeBegin", "spikeEnd", "0", "group->numTrgNeurons");
+                                     }, spikeWeight, loadName);
+
+                // Reduce buffers into postsynaptic input, zeroing them as we go
+                genParallelFor(os, "accumSize", "j", true,
+                               [batchSize, dendriticDelay](CodeStream &os)
+                               {
+                                   os << "scalar input = 0;" << std::endl;
+                                   os << "for(unsigned int t = 0; t < numThreads; t++)";
+                                   {
+                                       CodeStream::Scope b(os);
+                                       os << "input += threadInSynData[(t * accumSize) + j];" << std::endl;
+                                       os << "threadInSynData[(t * accumSize) + j] = 0;" << std::endl;
+                                   }
+                                   os << "group->" << (dendriticDelay ? "denDelay" : "inSyn") << "[" << ((batchSize > 1) ? "postBatchOffset + j" : "j") << "] += input;" << std::endl;
+                               }, true);
+            }
+        }
+        // Otherwise, split spikes between threads and add input atomically
+        else {
+            if(dendriticDelay) {
+                inSynSubs.addFuncSubstitution("addToInSynDelay", 2, getAtomicAdd("group->denDelay[" + sg.getPostDenDelayIndex(batchSize, "$(id_post)", "$(1)") + "]", "$(0)"));
+            }
+            else {
+                inSynSubs.addFuncSubstitution("addToInSyn", 1, getAtomicAdd("group->inSyn[" + sg.getPostISynIndex(batchSize, "$(id_post)") + "]", "$(0)"));
+            }
 
-                // If this is a spike-like event, insert threshold check for this presynaptic neuron
-                if(!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
-                    os << "if(";
+            if(sg.getArchetype().isPresynapticOutputRequired()) {
+                inSynSubs.addFuncSubstitution("addToPre", 1, "group->revInSyn[" + sg.getPreISynIndex(batchSize, "ipre") + "] += $(0)");
+            }
 
-                    // Generate weight update threshold condition
-                    sg.generateSpikeEventThreshold(*this, os, modelMerged, presynapticUpdateSubs);
+            genParallelForChunks(os, "numSpikes", "spikeBegin", "spikeEnd", "thread",
+                                 [trueSpike, &inSynSubs, &modelMerged, &sg, this](CodeStream &os)
+                                 {
+                                     genPresynapticSpikeLoop(os, modelMerged, sg, inSynSubs, trueSpike, "spikeBegin", "spikeEnd", "0", "group->numTrgNeurons");
+                                 }, spikeWeight, loadName);
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genPresynapticSpikeUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg, const Substitutions &popSubs, 
+                                        bool trueSpike, const std::string &postBegin, const std::string &postEnd) const
+{
+    // Get suffix based on type of events
+    const std::string eventSuffix = trueSpike ? "" : "Evnt";
+    const auto *wu = sg.getArchetype().getWUModel();
+    const unsigned int batchSize = modelMerged.getModel().getBatchSize();
 
-                    os << ")";
-                    os << CodeStream::OB(10);
-                }
+    if(!wu->getSimSupportCode().empty()) {
+        os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) << ";" << std::endl;
+    }
 
-                // Replace $(id_post) with first 'function' parameter as simulation code is
-                // going to be, in turn, substituted into procedural connectivity generation code
-                presynapticUpdateSubs.addVarSubstitution("id_post", "$(0)");
+    os << "const unsigned int ipre = group->srcSpk" << eventSuffix << "[" << sg.getPreVarIndex(batchSize, VarAccessDuplication::DUPLICATE, "i") << "];" << std::endl;
 
-                // Replace kernel indices with the subsequent 'function' parameters
-                for(size_t i = 0; i < sg.getArchetype().getKernelSize().size(); i++) {
-                    presynapticUpdateSubs.addVarSubstitution("id_kernel_" + std::to_string(i),
-                                                             "$(" + std::to_string(i + 1) + ")");
-                }
+    // If this is a spike-like event, insert threshold check for this presynaptic neuron
+    if(!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
+        os << "if(";
 
-                if(sg.getArchetype().isDendriticDelayRequired()) {
-                    presynapticUpdateSubs.addFuncSubstitution("addToInSynDelay", 2, "group->denDelay[" + sg.getPostDenDelayIndex(1, "$(id_post)", "$(1)") + "] += $(0)");
-                }
-                else {
-                    presynapticUpdateSubs.addFuncSubstitution("addToInSyn", 1, "group->inSyn[" + sg.getPostISynIndex(1, "$(id_post)") + "] += $(0)");
-                }
+        Substitutions threshSubs(&popSubs);
+        threshSubs.addVarSubstitution("id_pre", "ipre");
 
-                if(sg.getArchetype().isPresynapticOutputRequired()) {
-                    presynapticUpdateSubs.addFuncSubstitution("addToPre", 1, "group->revInSyn[" + sg.getPreISynIndex(1, "ipre") + "] += $(0)");
-                }
+        // Generate weight update threshold condition
+        sg.generateSpikeEventThreshold(*this, os, modelMerged, threshSubs);
 
-                // Generate presynaptic simulation code into new stringstream-backed code stream
-                std::ostringstream presynapticUpdateStream;
-                CodeStream presynapticUpdate(presynapticUpdateStream);
-                if(trueSpike) {
-                    sg.generateSpikeUpdate(*this, presynapticUpdate, modelMerged, presynapticUpdateSubs);
-                }
-                else {
-                    sg.generateSpikeEventUpdate(*this, presynapticUpdate, modelMerged, presynapticUpdateSubs);
-                }
+        os << ")";
+        os << CodeStream::OB(10);
+    }
 
-                // When a synapse should be 'added', substitute in presynaptic update code
-                connSubs.addFuncSubstitution("addSynapse", 1 + (unsigned int)sg.getArchetype().getKernelSize().size(), presynapticUpdateStream.str());
+    Substitutions synSubs(&popSubs);
+    synSubs.addVarSubstitution("id_pre", "ipre");
+    synSubs.addVarSubstitution("id_post", "ipost");
+    synSubs.addVarSubstitution("id_syn", "synAddress");
+
+    if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+        os << "const unsigned int npost = group->rowLength[ipre];" << std::endl;
+        os << "for (unsigned int j = 0; j < npost; j++)";
+        {
+            CodeStream::Scope b(os);
 
-                // Generate toeplitz connectivity code
-                sg.generateToeplitzConnectivity(*this, os, modelMerged, connSubs);
+            // **TODO** seperate stride from max connection
+            os << "const unsigned int synAddress = (ipre * group->rowStride) + j;" << std::endl;
+            os << "const unsigned int ipost = group->ind[synAddress];" << std::endl;
 
-                if(!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
-                    os << CodeStream::CB(130); // end if (eCode)
-                }
+            if(trueSpike) {
+                sg.generateSpikeUpdate(*this, os, modelMerged, synSubs);
+            }
+            else {
+                sg.generateSpikeEventUpdate(*this, os, modelMerged, synSubs);
             }
         }
     }
-    else {
-        // Detect spike events or spikes and do the update
-        os << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << std::endl;
-        if(sg.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
-            os << "for (unsigned int i = 0; i < group->srcSpkCnt" << eventSuffix << "[preDelaySlot]; i++)";
+    else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL) {
+        // Create substitution stack for regenerating row
+        Substitutions rowSubs(&popSubs);
+        rowSubs.addVarSubstitution("id_pre", "ipre");
+
+        // If row requires an RNG, create Philox RNG for this row
+        // **NOTE** this is keyed only by presynaptic index so row is identical whenever it is regenerated
+        // **NOTE** add RNG to rowSubs so it can be correctly referenced in presynapticUpdateSubs below
+        if(isProceduralRowRNGRequired(sg.getArchetype())) {
+            genPhiloxRNG(os, rowSubs, modelMerged.getModel().getPrecision(), "rowRNG", "rowRNGKey", "ipre");
         }
-        else {
-            os << "for (unsigned int i = 0; i < group->srcSpkCnt" << eventSuffix << "[0]; i++)";
-        }
-        {
-            CodeStream::Scope b(os);
-            if(!wu->getSimSupportCode().empty()) {
-                os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) << ";" << std::endl;
-            }
 
-            const std::string queueOffset = sg.getArchetype().getSrcNeuronGroup()->isDelayRequired() ? "preDelayOffset + " : "";
-            os << "const unsigned int ipre = group->srcSpk" << eventSuffix << "[" << queueOffset << "i];" << std::endl;
-
-            // If this is a spike-like event, insert threshold check for this presynaptic neuron
-            if(!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
-                os << "if(";
+        // Create substitution stack for generating procedural connectivity code
+        Substitutions connSubs(&rowSubs);
+        connSubs.addVarSubstitution("num_threads", "1");
+        connSubs.addVarSubstitution("id_post_begin", "0");
+        connSubs.addVarSubstitution("id_thread", "0");
+        connSubs.addVarSubstitution("num_post", "group->numTrgNeurons");
+        connSubs.addVarSubstitution("num_pre", "group->numSrcNeurons");
+
+        // Create another substitution stack for generating presynaptic simulation code
+        Substitutions presynapticUpdateSubs(&rowSubs);
+
+        // Replace $(id_post) with first 'function' parameter as simulation code is
+        // going to be, in turn, substituted into procedural connectivity generation code
+        presynapticUpdateSubs.addVarSubstitution("id_post", "$(0)");
+
+        // Replace kernel indices with the subsequent 'function' parameters
+        for(size_t i = 0; i < sg.getArchetype().getKernelSize().size(); i++) {
+            presynapticUpdateSubs.addVarSubstitution("id_kernel_" + std::to_string(i),
+                                                     "$(" + std::to_string(i + 1) + ")");
+        }
 
-                Substitutions threshSubs(&popSubs);
-                threshSubs.addVarSubstitution("id_pre", "ipre");
+        // Generate presynaptic simulation code into new stringstream-backed code stream
+        std::ostringstream presynapticUpdateStream;
+        CodeStream presynapticUpdate(presynapticUpdateStream);
+        if(trueSpike) {
+            sg.generateSpikeUpdate(*this, presynapticUpdate, modelMerged, presynapticUpdateSubs);
+        }
+        else {
+            sg.generateSpikeEventUpdate(*this, presynapticUpdate, modelMerged, presynapticUpdateSubs);
+        }
 
-                // Generate weight update threshold condition
-                sg.generateSpikeEventThreshold(*this, os, modelMerged, threshSubs);
+        // When a synapse should be 'added', substitute in presynaptic update code
+        connSubs.addFuncSubstitution("addSynapse", 1 + (unsigned int)sg.getArchetype().getKernelSize().size(), presynapticUpdateStream.str());
 
-                os << ")";
-                os << CodeStream::OB(10);
-            }
+        // Generate procedural connectivity code
+        sg.generateProceduralConnectivity(*this, os, modelMerged, connSubs);
+    }
+    // Otherwise, if connectivity is Toeplitz (and hence a built-in convolution), generate specialised code
+    else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::TOEPLITZ) {
+        genToeplitzConvSpikeUpdate(os, modelMerged, sg, synSubs, trueSpike);
+    }
+    // Otherwise, if bitmask optimisations are enabled and propagation isn't blocked, scan through the row's connectivity words
+    else if(getPreferences().enableBitmaskOptimisations && (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK)
+            && sg.getArchetype().getPostTileSize() == 0)
+    {
+        // Get pointer to start of row
+        // **NOTE** rows are padded to a whole number of 32-bit words so may not be 64-bit aligned
+        os << "const unsigned int rowWords = ((group->numTrgNeurons + 32 - 1) / 32);" << std::endl;
+        os << "const uint32_t *rowConnectivity = &group->gp[ipre * rowWords];" << std::endl;
 
-            Substitutions synSubs(&popSubs);
-            synSubs.addVarSubstitution("id_pre", "ipre");
-            synSubs.addVarSubstitution("id_post", "ipost");
-            synSubs.addVarSubstitution("id_syn", "synAddress");
+        // Loop through row 64 synapses at a time
+        os << "for(unsigned int w = 0; w < rowWords; w += 2)";
+        {
+            CodeStream::Scope b(os);
 
-            if(sg.getArchetype().isDendriticDelayRequired()) {
-                synSubs.addFuncSubstitution("addToInSynDelay", 2, "group->denDelay[" + sg.getPostDenDelayIndex(1, "ipost", "$(1)") + "] += $(0)");
-            }
-            else {
-                synSubs.addFuncSubstitution("addToInSyn", 1, "group->inSyn[" + sg.getPostISynIndex(1, "ipost") + "] += $(0)");
+            // Combine pair of 32-bit words into 64-bit word
+            // **NOTE** as bits are indexed from the most significant, the first word forms the upper half
+            os << "uint64_t connectivityWord = ((uint64_t)rowConnectivity[w] << 32);" << std::endl;
+            os << "if((w + 1) < rowWords)";
+            {
+                CodeStream::Scope b(os);
+                os << "connectivityWord |= rowConnectivity[w + 1];" << std::endl;
             }
 
-            if(sg.getArchetype().isPresynapticOutputRequired()) {
-                synSubs.addFuncSubstitution("addToPre", 1, "group->revInSyn[" + sg.getPreISynIndex(1, synSubs["id_pre"]) + "] += $(0)");
-            }
+            // Get index of first synapse in word
+            os << "const unsigned int wordStart = w * 32;" << std::endl;
 
-            if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-                os << "const unsigned int npost = group->rowLength[ipre];" << std::endl;
-                os << "for (unsigned int j = 0; j < npost; j++)";
+            // If all 64 synapses are present and word doesn't extend into padding region, 
+            // process them with a simple loop with no bit manipulation
+            os << "if(connectivityWord == UINT64_MAX && (wordStart + 64) <= group->numTrgNeurons)";
+            {
+                CodeStream::Scope b(os);
+                os << "for(unsigned int ipost = wordStart; ipost < (wordStart + 64); ipost++)";
                 {
                     CodeStream::Scope b(os);
-
-                    // **TODO** seperate stride from max connection
-                    os << "const unsigned int synAddress = (ipre * group->rowStride) + j;" << std::endl;
-                    os << "const unsigned int ipost = group->ind[synAddress];" << std::endl;
-
                     if(trueSpike) {
                         sg.generateSpikeUpdate(*this, os, modelMerged, synSubs);
                     }
@@ -1691,118 +2834,435 @@ void Backend::genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelM
                     }
                 }
             }
-            else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL) {
-                throw std::runtime_error("The single-threaded CPU backend does not support procedural connectivity.");
-            }
-            else if(getPreferences().enableBitmaskOptimisations && (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK)) {
-                // Determine the number of words in each row
-                os << "const unsigned int rowWords = ((group->numTrgNeurons + 32 - 1) / 32);" << std::endl;
-                os << "for(unsigned int w = 0; w < rowWords; w++)";
+            os << "else";
+            {
+                CodeStream::Scope b(os);
+
+                // While there any bits left
+                os << "while(connectivityWord != 0)";
                 {
                     CodeStream::Scope b(os);
 
-                    // Read row word
-                    os << "uint32_t connectivityWord = group->gp[(ipre * rowWords) + w];" << std::endl;
+                    // Count trailing zeros to find lowest set bit and hence (as bits are indexed backwards) the last remaining synapse
+                    os << "const unsigned int ipost = wordStart + 63 - gennCTZ64(connectivityWord);" << std::endl;
 
-                    // Set ipost to first synapse in connectivity word
-                    os << "unsigned int ipost = w * 32;" << std::endl;
+                    // Clear lowest set bit
+                    os << "connectivityWord &= (connectivityWord - 1);" << std::endl;
 
-                    // While there any bits left
-                    os << "while(connectivityWord != 0)";
+                    // If we aren't in padding region
+                    // **TODO** don't bother checking if there is no padding
+                    os << "if(ipost < group->numTrgNeurons)";
                     {
                         CodeStream::Scope b(os);
-
-                        // Cound leading zeros (as bits are indexed backwards this is index of next synapse)
-                        os << "const int numLZ = gennCLZ(connectivityWord);" << std::endl;
-
-                        // Shift off zeros and the one just discovered
-                        // **NOTE** << 32 appears to result in undefined behaviour
-                        os << "connectivityWord = (numLZ == 31) ? 0 : (connectivityWord << (numLZ + 1));" << std::endl;
-
-                        // Add to ipost
-                        os << "ipost += numLZ;" << std::endl;
-
-                        // If we aren't in padding region
-                        // **TODO** don't bother checking if there is no padding
-                        os << "if(ipost < group->numTrgNeurons)";
-                        {
-                            CodeStream::Scope b(os);
-                            if(trueSpike) {
-                                sg.generateSpikeUpdate(*this, os, modelMerged, synSubs);
-                            }
-                            else {
-                                sg.generateSpikeEventUpdate(*this, os, modelMerged, synSubs);
-                            }
+                        if(trueSpike) {
+                            sg.generateSpikeUpdate(*this, os, modelMerged, synSubs);
+                        }
+                        else {
+                            sg.generateSpikeEventUpdate(*this, os, modelMerged, synSubs);
                         }
-
-                        // Increment ipost to take into account fact the next CLZ will go from bit AFTER synapse
-                        os << "ipost++;" << std::endl;
                     }
                 }
             }
-            // Otherwise (DENSE or BITMASK)
+        }
+    }
+    // Otherwise (DENSE or BITMASK)
+    else {
+        os << "for (unsigned int ipost = " << postBegin << "; ipost < " << postEnd << "; ipost++)";
+        {
+            CodeStream::Scope b(os);
+
+            if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+                // **NOTE** if bitmask optimisations are enabled, rows are padded to a whole number of words
+                if(getPreferences().enableBitmaskOptimisations) {
+                    os << "const uint64_t gid = (ipre * (uint64_t)((group->numTrgNeurons + 32 - 1) / 32) * 32) + ipost;" << std::endl;
+                }
+                else {
+                    os << "const uint64_t gid = (ipre * (uint64_t)group->numTrgNeurons + ipost);" << std::endl;
+                }
+                os << "if (B(group->gp[gid / 32], gid & 31))" << CodeStream::OB(20);
+            }
+
+            os << "const unsigned int synAddress = (ipre * group->numTrgNeurons) + ipost;" << std::endl;
+
+            if(trueSpike) {
+                sg.generateSpikeUpdate(*this, os, modelMerged, synSubs);
+            }
             else {
-                os << "for (unsigned int ipost = 0; ipost < group->numTrgNeurons; ipost++)";
-                {
-                    CodeStream::Scope b(os);
+                sg.generateSpikeEventUpdate(*this, os, modelMerged, synSubs);
+            }
 
-                    if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
-                        os << "const uint64_t gid = (ipre * (uint64_t)group->numTrgNeurons + ipost);" << std::endl;
-                        os << "if (B(group->gp[gid / 32], gid & 31))" << CodeStream::OB(20);
-                    }
+            if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+                os << CodeStream::CB(20);
+            }
+        }
+    }
+    // If this is a spike-like event, close braces around threshold check
+    if(!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
+        os << CodeStream::CB(10);
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genPresynapticSpikeLoop(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg, const Substitutions &popSubs,
+                                      bool trueSpike, const std::string &spikeBegin, const std::string &spikeEnd,
+                                      const std::string &postBegin, const std::string &postEnd) const
+{
+    const unsigned int postTileSize = sg.getArchetype().getPostTileSize();
+
+    // If propagation is blocked, loop through tiles of postsynaptic neurons
+    // **NOTE** this keeps each tile of postsynaptic input in cache while every spike's row segment is streamed through it
+    if(postTileSize > 0) {
+        os << "for(unsigned int tileBegin = " << postBegin << "; tileBegin < " << postEnd << "; tileBegin += " << postTileSize << ")";
+        os << CodeStream::OB(1);
+        os << "const unsigned int tileEnd = std::min(tileBegin + " << postTileSize << "u, (unsigned int)" << postEnd << ");" << std::endl;
+    }
 
-                    os << "const unsigned int synAddress = (ipre * group->numTrgNeurons) + ipost;" << std::endl;
+    os << "for(unsigned int i = " << spikeBegin << "; i < " << spikeEnd << "; i++)";
+    {
+        CodeStream::Scope b(os);
+        genPresynapticSpikeUpdate(os, modelMerged, sg, popSubs, trueSpike,
+                                  (postTileSize > 0) ? "tileBegin" : postBegin,
+                                  (postTileSize > 0) ? "tileEnd" : postEnd);
+    }
 
-                    if(trueSpike) {
-                        sg.generateSpikeUpdate(*this, os, modelMerged, synSubs);
-                    }
-                    else {
-                        sg.generateSpikeEventUpdate(*this, os, modelMerged, synSubs);
-                    }
+    if(postTileSize > 0) {
+        os << CodeStream::CB(1);
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genToeplitzConvSpikeUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                                         const Substitutions &synSubs, bool trueSpike) const
+{
+    const auto &connectInit = sg.getArchetype().getToeplitzConnectivityInitialiser();
+    const auto *snippet = connectInit.getSnippet();
+    const auto *wu = sg.getArchetype().getWUModel();
+    const bool avgPool = (snippet == InitToeplitzConnectivitySnippet::AvgPoolConv2D::getInstance());
 
-                    if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
-                        os << CodeStream::CB(20);
-                    }
+    // Get indices of parameters and derived parameters by name
+    const auto paramNames = snippet->getParamNames();
+    const auto derivedParams = snippet->getDerivedParams();
+    auto getParamIndex = [&paramNames](const std::string &name)
+    {
+        return (size_t)std::distance(paramNames.cbegin(), std::find(paramNames.cbegin(), paramNames.cend(), name));
+    };
+    auto getDerivedParamIndex = [&derivedParams](const std::string &name)
+    {
+        return (size_t)std::distance(derivedParams.cbegin(), std::find_if(derivedParams.cbegin(), derivedParams.cend(),
+                                                                          [&name](const Snippet::Base::DerivedParam &d){ return (d.name == name); }));
+    };
+
+    // Are (derived) parameters homogeneous across merged group?
+    auto isParamHomogeneous = [getParamIndex, &sg](const std::string &name)
+    {
+        return !sg.isToeplitzConnectivityInitParamHeterogeneous(getParamIndex(name));
+    };
+    auto isDerivedParamHomogeneous = [getDerivedParamIndex, &sg](const std::string &name)
+    {
+        return !sg.isToeplitzConnectivityInitDerivedParamHeterogeneous(getDerivedParamIndex(name));
+    };
+
+    // Get (derived) parameters as integer literals if they are homogeneous or, otherwise, read them from merged group
+    auto getParam = [getParamIndex, isParamHomogeneous, &connectInit](const std::string &name)
+    {
+        return isParamHomogeneous(name) ? std::to_string((int)connectInit.getParams().at(getParamIndex(name))) : ("((int)group->" + name + ")");
+    };
+    auto getDerivedParam = [getDerivedParamIndex, isDerivedParamHomogeneous, &connectInit](const std::string &name)
+    {
+        return isDerivedParamHomogeneous(name) ? std::to_string((int)connectInit.getDerivedParams().at(getDerivedParamIndex(name))) : ("((int)group->" + name + ")");
+    };
+
+    // If kernel size and padding are homogeneous and kernel isn't too large, unroll loops over kernel rows and columns
+    const bool unroll = (isParamHomogeneous("conv_kh") && isParamHomogeneous("conv_kw")
+                         && isDerivedParamHomogeneous("conv_bh") && isDerivedParamHomogeneous("conv_bw")
+                         && (connectInit.getParams().at(getParamIndex("conv_kh")) * connectInit.getParams().at(getParamIndex("conv_kw"))) <= 64.0);
+
+    // Output channels can be vectorised unless updates might touch the same presynaptic state
+    const bool vectorise = (!sg.getArchetype().isPresynapticOutputRequired() && wu->getPreVars().empty());
+
+    // Convert presynaptic neuron index into row, column and channel
+    // **NOTE** if connectivity is preceded by average pooling, these are the row and column coming OUT of the pool
+    if(avgPool) {
+        os << "const int prePoolInRow = (ipre / " << getParam("pool_ic") << ") / " << getParam("pool_iw") << ";" << std::endl;
+        os << "const int prePoolInCol = (ipre / " << getParam("pool_ic") << ") % " << getParam("pool_iw") << ";" << std::endl;
+        os << "const int preChan = ipre % " << getParam("pool_ic") << ";" << std::endl;
+        os << "const int preRow = prePoolInRow / " << getParam("pool_sh") << ";" << std::endl;
+        os << "const int preCol = prePoolInCol / " << getParam("pool_sw") << ";" << std::endl;
+
+        // Skip neurons which aren't in any pool
+        os << "if(prePoolInRow < ((preRow * " << getParam("pool_sh") << ") + " << getParam("pool_kh") << ") && prePoolInCol < ((preCol * " << getParam("pool_sw") << ") + " << getParam("pool_kw") << "))";
+        os << CodeStream::OB(1);
+    }
+    else {
+        os << "const int preRow = (ipre / " << getParam("conv_ic") << ") / " << getParam("conv_iw") << ";" << std::endl;
+        os << "const int preCol = (ipre / " << getParam("conv_ic") << ") % " << getParam("conv_iw") << ";" << std::endl;
+        os << "const int preChan = ipre % " << getParam("conv_ic") << ";" << std::endl;
+    }
+
+    // Add substitutions for input and output channel kernel indices
+    Substitutions kernSubs(&synSubs);
+    kernSubs.addVarSubstitution("id_kernel_2", "preChan");
+    kernSubs.addVarSubstitution("id_kernel_3", "kernOutChan");
+
+    // Generate code to process all output channels at one kernel position
+    auto genKernelPosition = [&modelMerged, &sg, &getParam, trueSpike, vectorise, this]
+        (CodeStream &os, const std::string &postRow, const std::string &postCol,
+         const std::string &flipKernRow, const std::string &flipKernCol, const Substitutions &kernSubs)
+    {
+        CodeStream::Scope b(os);
+        os << "const int postRow = " << postRow << ";" << std::endl;
+        os << "const int postCol = " << postCol << ";" << std::endl;
+
+        // If we haven't gone off edge of output
+        os << "if(postRow >= 0 && postCol >= 0 && postRow < " << getParam("conv_oh") << " && postCol < " << getParam("conv_ow") << ")";
+        {
+            CodeStream::Scope b(os);
+
+            Substitutions posSubs(&kernSubs);
+            posSubs.addVarSubstitution("id_kernel_0", flipKernRow);
+            posSubs.addVarSubstitution("id_kernel_1", flipKernCol);
+
+            // Loop through output channels which, in the postsynaptic population and kernel, are contiguous
+            os << "const unsigned int postStart = ((postRow * " << getParam("conv_ow") << ") + postCol) * " << getParam("conv_oc") << ";" << std::endl;
+            if(vectorise) {
+                os << "GENN_IVDEP" << std::endl;
+            }
+            os << "for(int kernOutChan = 0; kernOutChan < " << getParam("conv_oc") << "; kernOutChan++)";
+            {
+                CodeStream::Scope b(os);
+                os << "const unsigned int ipost = postStart + kernOutChan;" << std::endl;
+                if(trueSpike) {
+                    sg.generateSpikeUpdate(*this, os, modelMerged, posSubs);
+                }
+                else {
+                    sg.generateSpikeEventUpdate(*this, os, modelMerged, posSubs);
                 }
             }
-            // If this is a spike-like event, close braces around threshold check
-            if(!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
-                os << CodeStream::CB(10);
+        }
+    };
+
+    if(unroll) {
+        const int kernHeight = (int)connectInit.getParams().at(getParamIndex("conv_kh"));
+        const int kernWidth = (int)connectInit.getParams().at(getParamIndex("conv_kw"));
+        const int padHeight = (int)connectInit.getDerivedParams().at(getDerivedParamIndex("conv_bh"));
+        const int padWidth = (int)connectInit.getDerivedParams().at(getDerivedParamIndex("conv_bw"));
+        auto getOffset = [](int offset)
+        {
+            if(offset == 0) {
+                return std::string();
+            }
+            else {
+                return ((offset < 0) ? " - " : " + ") + std::to_string(std::abs(offset));
+            }
+        };
+        for(int kernRow = 0; kernRow < kernHeight; kernRow++) {
+            for(int kernCol = 0; kernCol < kernWidth; kernCol++) {
+                genKernelPosition(os, "preRow" + getOffset(kernRow - padHeight), "preCol" + getOffset(kernCol - padWidth),
+                                  std::to_string(kernHeight - kernRow - 1), std::to_string(kernWidth - kernCol - 1), kernSubs);
+            }
+        }
+    }
+    else {
+        os << "for(int kernRow = 0; kernRow < " << getParam("conv_kh") << "; kernRow++)";
+        {
+            CodeStream::Scope b(os);
+            os << "for(int kernCol = 0; kernCol < " << getParam("conv_kw") << "; kernCol++)";
+            {
+                CodeStream::Scope b(os);
+                genKernelPosition(os, "preRow + kernRow - " + getDerivedParam("conv_bh"), "preCol + kernCol - " + getDerivedParam("conv_bw"),
+                                  "(" + getParam("conv_kh") + " - kernRow - 1)", "(" + getParam("conv_kw") + " - kernCol - 1)", kernSubs);
             }
         }
     }
+
+    if(avgPool) {
+        os << CodeStream::CB(1);
+    }
 }
 //--------------------------------------------------------------------------
-void Backend::genEmitSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, const Substitutions &subs, bool trueSpike, bool recordingEnabled) const
+void Backend::genSynapseDynamicsGroup(CodeStream &os, const ModelSpecMerged &modelMerged, const SynapseDynamicsGroupMerged &s,
+                                      const Substitutions &funcSubs, const std::string &timingName) const
+{
+    const unsigned int batchSize = modelMerged.getModel().getBatchSize();
+
+    // If model is batched, loop through batches
+    if(batchSize > 1) {
+        os << "for(unsigned int batch = 0; batch < " << batchSize << "; batch++)";
+        os << CodeStream::OB(1);
+    }
+
+    genSynapseIndexCalculation(os, s, batchSize);
+
+    // Loop through presynaptic neurons
+    // **NOTE** if connectivity is sparse, rows are weighted by their length when balancing work between threads
+    const bool sparse = (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE);
+    genParallelForChunks(os, "group->numSrcNeurons", "rowBegin", "rowEnd", "thread",
+                         [batchSize, &funcSubs, &modelMerged, &s, this](CodeStream &os)
+                         {
+                             os << "for(unsigned int i = rowBegin; i < rowEnd; i++)";
+                             {
+                                 CodeStream::Scope b(os);
+
+                                 // If this synapse group has sparse connectivity, loop through length of this row
+                                 if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                     os << "for(unsigned int s = 0; s < group->rowLength[i]; s++)";
+                                 }
+                                 // Otherwise, if it's dense, loop through each postsynaptic neuron
+                                 else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::DENSE) {
+                                     os << "for (unsigned int j = 0; j < group->numTrgNeurons; j++)";
+                                 }
+                                 else {
+                                     throw std::runtime_error("Only DENSE and SPARSE format connectivity can be used for synapse dynamics");
+                                 }
+                                 {
+                                     CodeStream::Scope b(os);
+
+                                     Substitutions synSubs(&funcSubs);
+                                     if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                         // Calculate index of synapse and use it to look up postsynaptic index
+                                         os << "const unsigned int n = (i * group->rowStride) + s;" << std::endl;
+                                         os << "const unsigned int j = group->ind[n];" << std::endl;
+
+                                         synSubs.addVarSubstitution("id_syn", "n");
+                                     }
+                                     else {
+                                         synSubs.addVarSubstitution("id_syn", "(i * group->numTrgNeurons) + j");
+                                     }
+
+                                     // Add pre and postsynaptic indices to substitutions
+                                     synSubs.addVarSubstitution("id_pre", "i");
+                                     synSubs.addVarSubstitution("id_post", "j");
+
+                                     // Add correct functions for apply synaptic input
+                                     // **NOTE** rows may be processed in parallel so postsynaptic input must be applied atomically
+                                     if(s.getArchetype().isDendriticDelayRequired()) {
+                                         synSubs.addFuncSubstitution("addToInSynDelay", 2, getAtomicAdd("group->denDelay[" + s.getPostDenDelayIndex(batchSize, "j", "$(1)") + "]", "$(0)"));
+                                     }
+                                     else {
+                                         synSubs.addFuncSubstitution("addToInSyn", 1, getAtomicAdd("group->inSyn[" + s.getPostISynIndex(batchSize, "j") + "]", "$(0)"));
+                                     }
+
+                                     if(s.getArchetype().isPresynapticOutputRequired()) {
+                                         synSubs.addFuncSubstitution("addToPre", 1, "group->revInSyn[" + s.getPreISynIndex(batchSize, synSubs["id_pre"]) + "] += $(0)");
+                                     }
+                                     // Call synapse dynamics handler
+                                     s.generateSynapseUpdate(*this, os, modelMerged, synSubs);
+                                 }
+                             }
+                         },
+                         sparse ? "group->rowLength[$(id)]" : "",
+                         timingName);
+
+    // If model is batched, close loop through batches
+    if(batchSize > 1) {
+        os << CodeStream::CB(1);
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genEmitSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, const Substitutions &subs, unsigned int batchSize, 
+                           bool trueSpike, bool recordingEnabled) const
 {
     // Determine if delay is required and thus, at what offset we should write into the spike queue
     const bool spikeDelayRequired = trueSpike ? (ng.getArchetype().isDelayRequired() && ng.getArchetype().isTrueSpikeRequired()) : ng.getArchetype().isDelayRequired();
-    const std::string spikeQueueOffset = spikeDelayRequired ? "writeDelayOffset + " : "";
+    const std::string spikeQueueOffset = ng.getWriteVarIndex(spikeDelayRequired, batchSize, VarAccessDuplication::DUPLICATE, "");
 
     const std::string suffix = trueSpike ? "" : "Evnt";
-    os << "group->spk" << suffix << "[" << spikeQueueOffset << "group->spkCnt" << suffix;
-    if(spikeDelayRequired) { // WITH DELAY
-        os << "[*group->spkQuePtr]++]";
-    }
-    else { // NO DELAY
-        os << "[0]++]";
-    }
+    const std::string spikeCount = "group->spkCnt" + suffix + "[" + ng.getWriteVarIndex(spikeDelayRequired, batchSize, VarAccessDuplication::SHARED_NEURON, "") + "]";
+    os << "group->spk" << suffix << "[" << spikeQueueOffset << getAtomicIncrement(spikeCount) << "]";
     os << " = " << subs["id"] << ";" << std::endl;
 
     // Reset spike and spike-like-event times
-    const std::string queueOffset = ng.getArchetype().isDelayRequired() ? "writeDelayOffset + " : "";
+    const std::string queueIndex = ng.getWriteVarIndex(ng.getArchetype().isDelayRequired(), batchSize, VarAccessDuplication::DUPLICATE, subs["id"]);
     if(trueSpike && ng.getArchetype().isSpikeTimeRequired()) {
-        os << "group->sT[" << queueOffset << subs["id"] << "] = " << subs["t"] << ";" << std::endl;
+        os << "group->sT[" << queueIndex << "] = " << subs["t"] << ";" << std::endl;
     }
     else if(!trueSpike && ng.getArchetype().isSpikeEventTimeRequired()) {
-        os << "group->seT[" << queueOffset << subs["id"] << "] = " << subs["t"] << ";" << std::endl;
+        os << "group->seT[" << queueIndex << "] = " << subs["t"] << ";" << std::endl;
     }
     
     // If recording is enabled
     if(recordingEnabled) {
         const std::string recordSuffix = trueSpike ? "" : "Event";
-        os << "group->recordSpk" << recordSuffix << "[(recordingTimestep * numRecordingWords) + (" << subs["id"] << " / 32)]";
-        os << " |= (1 << (" << subs["id"] << " % 32));" << std::endl;
+        os << getAtomicOr("group->recordSpk" + recordSuffix + "[recordingOffset + (" + subs["id"] + " / 32)]",
+                          "(1 << (" + subs["id"] + " % 32))") << ";" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genCompactSpikes(CodeStream &os, const NeuronUpdateGroupMerged &ng, unsigned int batchSize,
+                               bool trueSpike, bool recordingEnabled) const
+{
+    CodeStream::Scope b(os);
+
+    // Determine if delay is required and thus, at what offset we should write into the spike queue
+    const bool spikeDelayRequired = trueSpike ? (ng.getArchetype().isDelayRequired() && ng.getArchetype().isTrueSpikeRequired()) : ng.getArchetype().isDelayRequired();
+    const std::string spikeQueueOffset = ng.getWriteVarIndex(spikeDelayRequired, batchSize, VarAccessDuplication::DUPLICATE, "");
+
+    const std::string suffix = trueSpike ? "" : "Evnt";
+    const std::string mask = trueSpike ? "spikeMask" : "spikeEventMask";
+    const std::string spikeCount = "group->spkCnt" + suffix + "[" + ng.getWriteVarIndex(spikeDelayRequired, batchSize, VarAccessDuplication::SHARED_NEURON, "") + "]";
+
+    // Loop through mask, unconditionally writing each neuron's index to the end of the spike 
+    // queue but only advancing the count if it's set so no branches are required
+    // **NOTE** as count can't exceed the index of the current neuron, this can't overrun the queue
+    os << "unsigned int numSpikes = " << spikeCount << ";" << std::endl;
+    os << "for(unsigned int i = 0; i < group->numNeurons; i++)";
+    {
+        CodeStream::Scope b(os);
+        os << "group->spk" << suffix << "[" << spikeQueueOffset << "numSpikes] = i;" << std::endl;
+        os << "numSpikes += " << mask << "[i];" << std::endl;
+
+        // If recording is enabled, OR mask bit into recording word
+        if(recordingEnabled) {
+            const std::string recordSuffix = trueSpike ? "" : "Event";
+            os << "group->recordSpk" << recordSuffix << "[recordingOffset + (i / 32)] |= ((uint32_t)" << mask << "[i] << (i % 32));" << std::endl;
+        }
+    }
+    os << spikeCount << " = numSpikes;" << std::endl;
+
+    // If spike or spike-like event times are required, loop through compacted spikes and update them
+    const bool spikeTimeRequired = trueSpike ? ng.getArchetype().isSpikeTimeRequired() : ng.getArchetype().isSpikeEventTimeRequired();
+    if(spikeTimeRequired) {
+        os << "for(unsigned int s = 0; s < numSpikes; s++)";
+        {
+            CodeStream::Scope b(os);
+            os << "const unsigned int i = group->spk" << suffix << "[" << spikeQueueOffset << "s];" << std::endl;
+            os << "group->" << (trueSpike ? "sT" : "seT") << "[" << ng.getWriteVarIndex(ng.getArchetype().isDelayRequired(), batchSize, VarAccessDuplication::DUPLICATE, "i") << "] = t;" << std::endl;
+        }
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genCustomUpdateWUSynapse(CodeStream &os, const ModelSpecMerged &modelMerged, const CustomUpdateWUGroupMerged &cg, Substitutions &synSubs) const
+{
+    // If this is a batch reduction
+    const unsigned int batchSize = modelMerged.getModel().getBatchSize();
+    if(cg.getArchetype().isBatchReduction() && batchSize > 1) {
+        // Initialise reduction targets
+        const auto reductionTargets = genInitReductionTargets(os, cg, synSubs["id_syn"]);
+
+        // Loop through batches
+        os << "for(unsigned int batch = 0; batch < " << batchSize << "; batch++)";
+        {
+            CodeStream::Scope b(os);
+            synSubs.addVarSubstitution("batch", "batch");
+
+            // Calculate batch offset
+            os << "const unsigned int batchOffset = size * batch;" << std::endl;
+
+            cg.generateCustomUpdate(*this, os, modelMerged, synSubs);
+
+            // Loop through reduction targets and generate reduction
+            for(const auto &r : reductionTargets) {
+                os << getReductionOperation("lr" + r.name, "l" + r.name, r.access, r.type) << ";" << std::endl;
+            }
+        }
+
+        // Loop through reduction targets and write reduced value back to memory
+        for(const auto &r : reductionTargets) {
+            os << "group->" << r.name << "[" << r.index << "] = lr" << r.name << ";" << std::endl;
+        }
+    }
+    // Otherwise, generate custom update and write back any reductions
+    else {
+        cg.generateCustomUpdate(*this, os, modelMerged, synSubs);
+        genWriteBackReductions(os, cg, synSubs["id_syn"]);
     }
 }
 //--------------------------------------------------------------------------
@@ -16,6 +16,7 @@
 #include "modelSpecInternal.h"
 
 // GeNN code generator includes
+#include "code_generator/changedFileStream.h"
 #include "code_generator/generateMakefile.h"
 #include "code_generator/generateModules.h"
 #include "code_generator/generateMSBuild.h"
@@ -109,11 +110,11 @@ int main(int argc,     //!< number of arguments; expected to be 3
             LOGI_CODE_GEN << "Using previously generated project GUID:" << projectGUIDString;
         }
         // Create MSBuild project to compile and link all generated modules
-        std::ofstream makefile((outputPath / "runner.vcxproj").str());
+        CodeGenerator::ChangedFileStream makefile((outputPath / "runner.vcxproj").str());
         CodeGenerator::generateMSBuild(makefile, model, backend, projectGUIDString, moduleNames);
 #else
         // Create makefile to compile and link all generated modules
-        std::ofstream makefile((outputPath / "Makefile").str());
+        CodeGenerator::ChangedFileStream makefile((outputPath / "Makefile").str());
         CodeGenerator::generateMakefile(makefile, backend, moduleNames);
 #endif
 
@@ -73,7 +73,7 @@ void BackendSIMT::genPopVariableInit(CodeStream &os, const Substitutions &kernel
 }
 //--------------------------------------------------------------------------
 void BackendSIMT::genVariableInit(CodeStream &os, const std::string &, const std::string &countVarName,
-                                  const Substitutions &kernelSubs, Handler handler) const
+                                  const Substitutions &kernelSubs, bool, Handler handler) const
 {
     // Variable should already be provided via parallelism
     assert(kernelSubs.hasVarSubstitution(countVarName));
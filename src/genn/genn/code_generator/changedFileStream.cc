@@ -0,0 +1,56 @@
+#include "code_generator/changedFileStream.h"
+
+// Standard C++ includes
+#include <fstream>
+#include <iterator>
+
+// PLOG includes
+#include <plog/Log.h>
+
+// GeNN includes
+#include "logging.h"
+
+//----------------------------------------------------------------------------
+// CodeGenerator::ChangedFileStream
+//----------------------------------------------------------------------------
+namespace CodeGenerator
+{
+ChangedFileStream::ChangedFileStream(const std::string &filename)
+:   m_Filename(filename), m_Closed(false)
+{
+}
+//----------------------------------------------------------------------------
+ChangedFileStream::~ChangedFileStream()
+{
+    close();
+}
+//----------------------------------------------------------------------------
+bool ChangedFileStream::close()
+{
+    // If stream has already been closed, do nothing
+    if(m_Closed) {
+        return false;
+    }
+    m_Closed = true;
+
+    // If a file already exists, read its contents and, if they match, don't touch it
+    const std::string newContents = str();
+    {
+        std::ifstream existingStream(m_Filename, std::ios::binary);
+        if(existingStream.good()) {
+            const std::string existingContents{std::istreambuf_iterator<char>(existingStream),
+                                               std::istreambuf_iterator<char>()};
+            if(existingContents == newContents) {
+                LOGD_CODE_GEN << "'" << m_Filename << "' unchanged";
+                return false;
+            }
+        }
+    }
+
+    // Otherwise, write new contents
+    LOGD_CODE_GEN << "Writing '" << m_Filename << "'";
+    std::ofstream outputStream(m_Filename, std::ios::binary);
+    outputStream << newContents;
+    return true;
+}
+}   // namespace CodeGenerator
@@ -18,6 +18,9 @@
     #error "GeNN now requires a functioning std::regex implementation - please upgrade your version of GCC to at least 4.9.1"
 #endif
 
+// Standard C++ includes
+#include <unordered_map>
+
 // Standard C includes
 #include <cstring>
 
@@ -102,6 +105,67 @@ const char *mathsFuncs[][MathsFuncMax] = {
     {"fma", "fmaf"}
 };
 
+//--------------------------------------------------------------------------
+//! Can character form part of a C identifier?
+//--------------------------------------------------------------------------
+bool isIdentifierChar(char c)
+{
+    return ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_');
+}
+
+//--------------------------------------------------------------------------
+//! Is the identifier ending at position end in s followed by optional whitespace and an open bracket?
+//--------------------------------------------------------------------------
+bool isFollowedByCall(const std::string &s, size_t end)
+{
+    while(end < s.size() && ::isspace(s[end])) {
+        end++;
+    }
+    return (end < s.size() && s[end] == '(');
+}
+
+//--------------------------------------------------------------------------
+/*! \brief Replace whole identifiers matching trg in s with rep in a single pass,
+           optionally only where they are used as a function name
+ */
+//--------------------------------------------------------------------------
+bool identifierSubstitute(std::string &s, const std::string &trg, const std::string &rep, bool functionsOnly)
+{
+    size_t found = s.find(trg);
+    if(found == std::string::npos) {
+        return false;
+    }
+
+    std::string output;
+    size_t copied = 0;
+    for(; found != std::string::npos; found = s.find(trg, found + 1)) {
+        // Skip matches which are only part of a larger identifier
+        const size_t end = found + trg.size();
+        if(found > 0 && isIdentifierChar(s[found - 1])) {
+            continue;
+        }
+        if(functionsOnly ? !isFollowedByCall(s, end) : (end < s.size() && isIdentifierChar(s[end]))) {
+            continue;
+        }
+
+        // Copy code up to match, followed by replacement
+        output.append(s, copied, found - copied);
+        output.append(rep);
+        copied = end;
+    }
+
+    // If no replacements were made, leave s unmodified and return false
+    if(copied == 0) {
+        return false;
+    }
+    // Otherwise, copy remaining code and replace s
+    else {
+        output.append(s, copied, std::string::npos);
+        s = output;
+        return true;
+    }
+}
+
 //--------------------------------------------------------------------------
 /*! \brief This function removes explicit single precision function calls as
            single-threaded CPU and CUDA kernels both support C++ i.e. overloads 
@@ -111,10 +175,46 @@ const char *mathsFuncs[][MathsFuncMax] = {
 //--------------------------------------------------------------------------
 void ensureMathFunctionFtype(std::string &code)
 {
-    // Replace any outstanding explicit single-precision maths functions  
-    // with C++ versions where overloads should work the same
-    for(const auto &m : mathsFuncs) {
-        CodeGenerator::regexFuncSubstitute(code, m[MathsFuncSingle], m[MathsFuncCPP]);
+    // Build map of explicit single-precision maths functions to C++ versions
+    static const std::unordered_map<std::string, std::string> singleMathsFuncs =
+        []()
+        {
+            std::unordered_map<std::string, std::string> funcs;
+            for(const auto &m : mathsFuncs) {
+                funcs.emplace(m[MathsFuncSingle], m[MathsFuncCPP]);
+            }
+            return funcs;
+        }();
+
+    // Tokenise code into identifiers and replace any outstanding explicit
+    // single-precision maths function calls with C++ versions where overloads should work the same
+    std::string output;
+    size_t copied = 0;
+    for(size_t i = 0; i < code.size();) {
+        if(!isIdentifierChar(code[i])) {
+            i++;
+            continue;
+        }
+
+        // Find end of identifier
+        const size_t start = i;
+        while(i < code.size() && isIdentifierChar(code[i])) {
+            i++;
+        }
+
+        // If identifier is the name of a single-precision maths function which is being called, replace it
+        const auto func = singleMathsFuncs.find(code.substr(start, i - start));
+        if(func != singleMathsFuncs.cend() && isFollowedByCall(code, i)) {
+            output.append(code, copied, start - copied);
+            output.append(func->second);
+            copied = i;
+        }
+    }
+
+    // If any replacements were made, copy remaining code and replace
+    if(copied > 0) {
+        output.append(code, copied, std::string::npos);
+        code = output;
     }
 }
 
@@ -144,48 +244,6 @@ void doFinal(std::string &code, unsigned int i, const std::string &type, unsigne
     }
 }
 
-bool regexSubstitute(std::string &s, const std::regex &regex, const std::string &format)
-{
-    // **NOTE** the following code performs the same function as std::regex_replace
-    // but has a return value indicating whether any replacements are made
-    // see http://en.cppreference.com/w/cpp/regex/regex_replace
-
-    // Create regex iterator to iterate over matches found in code
-    std::sregex_iterator matchesBegin(s.cbegin(), s.cend(), regex);
-    std::sregex_iterator matchesEnd;
-
-    // If there are no matches, leave s unmodified and return false
-    if(matchesBegin == matchesEnd) {
-        return false;
-    }
-    // Otherwise
-    else {
-        // Loop through matches
-        std::string output;
-        for(std::sregex_iterator m = matchesBegin;;) {
-            // Copy the non-matched subsequence (m->prefix()) onto output
-            std::copy(m->prefix().first, m->prefix().second, std::back_inserter(output));
-
-            // Then replaces the matched subsequence with the formatted replacement string
-            m->format(std::back_inserter(output), format);
-
-            // If there are no subsequent matches
-            if(std::next(m) == matchesEnd) {
-                // Copy the remaining non-matched characters onto output
-                std::copy(m->suffix().first, m->suffix().second, std::back_inserter(output));
-                break;
-            }
-            // Otherwise go onto next match
-            else {
-                m++;
-            }
-        }
-
-        // Set reference to newly processed version and return true
-        s = output;
-        return true;
-    }
-}
 }    // Anonymous namespace
 
 //--------------------------------------------------------------------------
@@ -206,37 +264,23 @@ void substitute(std::string &s, const std::string &trg, const std::string &rep)
 }
 
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting variable  names in the neuron code strings or other templates using regular expressions
+//! \brief Tool for substituting variable names in the neuron code strings or other templates
 //--------------------------------------------------------------------------
 bool regexVarSubstitute(std::string &s, const std::string &trg, const std::string &rep)
 {
-    // Build a regex to match variable name with at least one
-    // character that can't be in a variable name on either side (or an end/beginning of string)
-    // **NOTE** the suffix is non-capturing so two instances of variables separated by a single character are matched e.g. a*a
-    std::regex regex("(^|[^0-9a-zA-Z_])" + trg + "(?=$|[^a-zA-Z0-9_])");
-
-    // Create format string to replace in text
-    // **NOTE** preceding character is captured as C++ regex doesn't support lookbehind so this needs to be replaced in
-    const std::string format = "$1" + rep;
-
-    return regexSubstitute(s, regex, format);
+    // Replace instances of trg with no characters that can be in a
+    // variable name on either side (or an end/beginning of string)
+    return identifierSubstitute(s, trg, rep, false);
 }
 
 //--------------------------------------------------------------------------
-//! \brief Tool for substituting function  names in the neuron code strings or other templates using regular expressions
+//! \brief Tool for substituting function names in the neuron code strings or other templates
 //--------------------------------------------------------------------------
 bool regexFuncSubstitute(std::string &s, const std::string &trg, const std::string &rep)
 {
-    // Build a regex to match function name with at least one
-    // character that can't be part of the function name on the left and a bracket on the right (with optional whitespace)
-    // **NOTE** the suffix is non-capturing so two instances of functions separated by a single character are matched e.g. sin(cos(x));
-    std::regex regex("(^|[^0-9a-zA-Z_])" + trg + "(?=\\s*\\()");
-
-    // Create format string to replace in text
-    // **NOTE** preceding character is captured as C++ regex doesn't support lookbehind so this needs to be replaced in
-    const std::string format = "$1" + rep;
-
-    return regexSubstitute(s, regex, format);
+    // Replace instances of trg with no character that can be part of the function
+    // name on the left and a bracket on the right (with optional whitespace)
+    return identifierSubstitute(s, trg, rep, true);
 }
 
 //--------------------------------------------------------------------------
@@ -253,91 +297,10 @@ bool regexFuncSubstitute(std::string &s, const std::string &trg, const std::stri
 void functionSubstitute(std::string &code, const std::string &funcName,
                         unsigned int numParams, const std::string &replaceFuncTemplate)
 {
-    // If there are no parameters, just replace the function name (wrapped in '$()')
-    // with the template (which will, inherantly, not have any parameters)
-    if(numParams == 0) {
-        substitute(code, "$(" + funcName + ")", replaceFuncTemplate);
-    }
-    // Otherwise
-    else {
-        // Reserve vector to hold parameters
-        std::vector<std::string> params;
-        params.reserve(numParams);
-
-        // String to hold parameter currently being parsed
-        std::string currentParam = "";
-
-        // Function will start with opening GeNN wrapper, name and comma before first argument
-        // **NOTE** need to match up to comma so longer function names with same prefix aren't matched
-        const std::string funcStart = "$(" + funcName + ",";
-
-        // Find first occurance of start of function
-        size_t found = code.find(funcStart);
-
-        // While functions are found
-        while (found != std::string::npos) {
-            // Loop through subsequent characerters of code
-            unsigned int bracketDepth = 0;
-            for(size_t i = found + funcStart.length(); i < code.size(); i++) {
-                // If this character is a comma at function bracket depth
-                if(code[i] == ',' && bracketDepth == 0) {
-                    assert(!currentParam.empty());
-
-                    // Add parameter to array
-                    params.push_back(currentParam);
-                    currentParam = "";
-                }
-                // Otherwise
-                else {
-                    // If this is an open bracket, increase bracket depth
-                    if(code[i] == '(') {
-                        bracketDepth++;
-                    }
-                    // Otherwise, it's a close bracket
-                    else if(code[i] == ')') {
-                        // If we are at a deeper bracket depth than function, decrease bracket depth
-                        if(bracketDepth > 0) {
-                            bracketDepth--;
-                        }
-                        // Otherwise
-                        else {
-                            assert(!currentParam.empty());
-
-                            // Add parameter to array
-                            params.push_back(currentParam);
-                            currentParam = "";
-
-                            // Check parameters match
-                            assert(params.size() == numParams);
-
-                            // Substitute parsed parameters into function template
-                            std::string replaceFunc = replaceFuncTemplate;
-                            for(unsigned int p = 0; p < numParams; p++) {
-                                substitute(replaceFunc, "$(" + std::to_string(p) + ")", params[p]);
-                            }
-
-                            // Clear parameters now they have been substituted
-                            // into the final string to replace in to code
-                            params.clear();
-
-                            // Replace this into code
-                            code.replace(found, i - found + 1, replaceFunc);
-                            break;
-                        }
-                    }
-
-                    // If this isn't a space at function bracket depth,
-                    // add to parameter string
-                    if(bracketDepth > 0 || !::isspace(code[i])) {
-                        currentParam += code[i];
-                    }
-                }
-            }
-
-            // Find start of next function to replace
-            found = code.find(funcStart);
-        }
-    }
+    // Apply substitutions containing only this function
+    Substitutions subs;
+    subs.addFuncSubstitution(funcName, numParams, replaceFuncTemplate);
+    subs.apply(code);
 }
 
 void genTypeRange(CodeStream &os, const std::string &precision, const std::string &prefix)
@@ -511,10 +474,16 @@ std::string getReductionOperation(const std::string &reduction, const std::strin
 
 void checkUnreplacedVariables(const std::string &code, const std::string &codeName)
 {
-    std::regex rgx("\\$\\([\\w]+\\)");
+    // Find all remaining $(name) references
     std::string vars= "";
-    for (std::sregex_iterator it(code.begin(), code.end(), rgx), end; it != end; it++) {
-        vars+= it->str().substr(2,it->str().size()-3) + ", ";
+    for(size_t found = code.find("$("); found != std::string::npos; found = code.find("$(", found + 2)) {
+        size_t end = found + 2;
+        while(end < code.size() && isIdentifierChar(code[end])) {
+            end++;
+        }
+        if(end > (found + 2) && end < code.size() && code[end] == ')') {
+            vars+= code.substr(found + 2, end - found - 2) + ", ";
+        }
     }
     if (vars.size() > 0) {
         vars= vars.substr(0, vars.size()-2);
@@ -37,7 +37,7 @@ int CodeStream::IndentBuffer::overflow(int c)
 //------------------------------------------------------------------------
 // CodeGenerator::CodeStream::Scope
 //------------------------------------------------------------------------
-unsigned int CodeStream::Scope::s_NextLevel = 0;
+std::atomic<unsigned int> CodeStream::Scope::s_NextLevel{0};
 
 //----------------------------------------------------------------------------
 // Operators
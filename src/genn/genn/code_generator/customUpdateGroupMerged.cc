@@ -122,7 +122,9 @@ CustomUpdateGroupMerged::CustomUpdateGroupMerged(size_t index, const std::string
     addHeterogeneousParams<CustomUpdateGroupMerged>(
         cm->getParamNames(), "",
         [](const CustomUpdateInternal &cg) { return cg.getParams(); },
-        &CustomUpdateGroupMerged::isParamHeterogeneous);
+        &CustomUpdateGroupMerged::isParamHeterogeneous,
+        [](const CustomUpdateInternal &cg, size_t p) { return cg.isParamDynamic(p); },
+        [](const CustomUpdateInternal &cg) { return cg.getName(); });
 
     // Add heterogeneous weight update model derived parameters
     addHeterogeneousDerivedParams<CustomUpdateGroupMerged>(
@@ -143,7 +145,8 @@ CustomUpdateGroupMerged::CustomUpdateGroupMerged(size_t index, const std::string
 //----------------------------------------------------------------------------
 bool CustomUpdateGroupMerged::isParamHeterogeneous(size_t index) const
 {
-    return isParamValueHeterogeneous(index, [](const CustomUpdateInternal &cg) { return cg.getParams(); });
+    return (getArchetype().isParamDynamic(index)
+            || isParamValueHeterogeneous(index, [](const CustomUpdateInternal &cg) { return cg.getParams(); }));
 }
 //----------------------------------------------------------------------------    
 bool CustomUpdateGroupMerged::isDerivedParamHeterogeneous(size_t index) const
@@ -162,7 +165,7 @@ boost::uuids::detail::sha1::digest_type CustomUpdateGroupMerged::getHashDigest()
     updateHash([](const CustomUpdateInternal &cg) { return cg.getSize(); }, hash);
 
     // Update hash with each group's parameters, derived parameters and variable references
-    updateHash([](const CustomUpdateInternal &cg) { return cg.getParams(); }, hash);
+    updateHash([](const CustomUpdateInternal &cg) { return cg.getHashableParams(); }, hash);
     updateHash([](const CustomUpdateInternal &cg) { return cg.getDerivedParams(); }, hash);
     updateHash([](const CustomUpdateInternal &cg) { return cg.getVarReferences(); }, hash);
 
@@ -222,7 +225,8 @@ std::string CustomUpdateGroupMerged::getVarRefIndex(bool delay, VarAccessDuplica
 //----------------------------------------------------------------------------
 bool CustomUpdateWUGroupMergedBase::isParamHeterogeneous(size_t index) const
 {
-    return isParamValueHeterogeneous(index, [](const CustomUpdateWUInternal &cg) { return cg.getParams(); });
+    return (getArchetype().isParamDynamic(index)
+            || isParamValueHeterogeneous(index, [](const CustomUpdateWUInternal &cg) { return cg.getParams(); }));
 }
 //----------------------------------------------------------------------------
 bool CustomUpdateWUGroupMergedBase::isDerivedParamHeterogeneous(size_t index) const
@@ -249,7 +253,7 @@ boost::uuids::detail::sha1::digest_type CustomUpdateWUGroupMergedBase::getHashDi
                }, hash);
 
     // Update hash with each group's parameters, derived parameters and variable referneces
-    updateHash([](const CustomUpdateWUInternal &cg) { return cg.getParams(); }, hash);
+    updateHash([](const CustomUpdateWUInternal &cg) { return cg.getHashableParams(); }, hash);
     updateHash([](const CustomUpdateWUInternal &cg) { return cg.getDerivedParams(); }, hash);
     updateHash([](const CustomUpdateWUInternal &cg) { return cg.getVarReferences(); }, hash);
 
@@ -330,7 +334,9 @@ CustomUpdateWUGroupMergedBase::CustomUpdateWUGroupMergedBase(size_t index, const
     addHeterogeneousParams<CustomUpdateWUGroupMerged>(
         cm->getParamNames(), "",
         [](const CustomUpdateWUInternal &cg) { return cg.getParams(); },
-        &CustomUpdateWUGroupMergedBase::isParamHeterogeneous);
+        &CustomUpdateWUGroupMergedBase::isParamHeterogeneous,
+        [](const CustomUpdateWUInternal &cg, size_t p) { return cg.isParamDynamic(p); },
+        [](const CustomUpdateWUInternal &cg) { return cg.getName(); });
 
     // Add heterogeneous weight update model derived parameters
     addHeterogeneousDerivedParams<CustomUpdateWUGroupMerged>(
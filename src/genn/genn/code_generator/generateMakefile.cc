@@ -36,8 +36,27 @@ void CodeGenerator::generateMakefile(std::ostream &os, const BackendBase &backen
     os << ".PHONY: all clean" << std::endl;
     os << std::endl;
 
-    // Add rule to build runner
-    os << "all: librunner.so" << std::endl;
+    // If model cache is enabled
+    const std::string &modelCachePath = backend.getPreferences().modelCachePath;
+    if(!modelCachePath.empty()) {
+        // Locate built model in cache using key written by code generator
+        os << "MODEL_CACHE := " << modelCachePath << "/$(shell cat cache.sha)" << std::endl;
+        os << std::endl;
+
+        // Add rule to copy runner from cache if it's present or, otherwise, build it and add it to cache
+        // **NOTE** runner is copied into cache under a temporary name and renamed so concurrent builds never see a partial file
+        os << "all:" << std::endl;
+        os << "\t@if [ -f $(MODEL_CACHE)/librunner.so ]; then \\" << std::endl;
+        os << "\t\tcmp -s $(MODEL_CACHE)/librunner.so librunner.so || cp -p $(MODEL_CACHE)/librunner.so librunner.so; \\" << std::endl;
+        os << "\telse \\" << std::endl;
+        os << "\t\t$(MAKE) --no-print-directory librunner.so && mkdir -p $(MODEL_CACHE) && \\" << std::endl;
+        os << "\t\tcp -p librunner.so $(MODEL_CACHE)/librunner.so.$$$$ && mv -f $(MODEL_CACHE)/librunner.so.$$$$ $(MODEL_CACHE)/librunner.so; \\" << std::endl;
+        os << "\tfi" << std::endl;
+    }
+    // Otherwise, add rule to build runner
+    else {
+        os << "all: librunner.so" << std::endl;
+    }
     os << std::endl;
 
     // Add rule to build shared library from objects
@@ -1,7 +1,13 @@
 #include "code_generator/generateModules.h"
 
 // Standard C++ includes
+#include <algorithm>
 #include <fstream>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -15,7 +21,9 @@
 #include "modelSpecInternal.h"
 
 // Code generator includes
+#include "code_generator/changedFileStream.h"
 #include "code_generator/codeStream.h"
+#include "code_generator/generateMakefile.h"
 #include "code_generator/generateSupportCode.h"
 #include "code_generator/generateRunner.h"
 #include "code_generator/modelSpecMerged.h"
@@ -39,16 +47,15 @@ void copyFile(const filesystem::path &file, const filesystem::path &sharePath, c
     // Create output directory if required
     filesystem::create_directory_recursive(outputFile.parent_path());
 
-    // Copy file
-    // **THINK** we could check modification etc but it doesn't seem worthwhile
+    // Copy file, leaving output untouched if it is unchanged
     LOGD_CODE_GEN << "Copying '" << inputFile << "' to '" << outputFile << "'" << std::endl;
     std::ifstream inputFileStream(inputFile.str(), std::ios::binary);
-    std::ofstream outputFileStream(outputFile.str(), std::ios::binary);
-    assert(outputFileStream.good());
+    ChangedFileStream outputFileStream(outputFile.str());
     outputFileStream << inputFileStream.rdbuf();
 }
 //--------------------------------------------------------------------------
-bool shouldRebuildModel(const filesystem::path &outputPath, const boost::uuids::detail::sha1::digest_type &hashDigest, MemAlloc &mem)
+bool shouldRebuildModel(const filesystem::path &outputPath, const boost::uuids::detail::sha1::digest_type &hashDigest, 
+                        MemAlloc &mem, std::vector<std::string> &modules)
 {
     try
     {
@@ -69,6 +76,14 @@ bool shouldRebuildModel(const filesystem::path &outputPath, const boost::uuids::
         is >> std::dec;
         is >> mem;
 
+        // Read names of modules generated
+        size_t numModules;
+        is >> numModules;
+        modules.resize(numModules);
+        for(auto &m : modules) {
+            is >> m;
+        }
+
         // If hash matches
         if(previousHashDigest == hashDigest) {
             LOGD_CODE_GEN << "Model unchanged - skipping code generation";
@@ -84,7 +99,30 @@ bool shouldRebuildModel(const filesystem::path &outputPath, const boost::uuids::
 
     return true;
 }
-
+//--------------------------------------------------------------------------
+BackendBase::ModuleHandler createModuleHandler(const filesystem::path &outputPath, const BackendBase &backend, 
+                                               const std::string &suffix, std::vector<std::string> &modules)
+{
+    // **NOTE** merged groups may be generated in parallel so access to list of modules is protected by mutex
+    auto modulesMutex = std::make_shared<std::mutex>();
+    return [&outputPath, &backend, &suffix, &modules, modulesMutex](const std::string &name, BackendBase::HostHandler handler)
+           {
+               // Create output stream to write to file and wrap in CodeStream
+               ChangedFileStream moduleStream((outputPath / (name + suffix + ".cc")).str());
+               CodeStream module(moduleStream);
+
+               module << "#include \"definitionsInternal" << suffix << ".h\"" << std::endl;
+               if (backend.supportsNamespace()) {
+                   module << "#include \"supportCode" << suffix << ".h\"" << std::endl;
+               }
+               module << std::endl;
+
+               // Generate module contents and add name to list
+               handler(module);
+               std::lock_guard<std::mutex> lock(*modulesMutex);
+               modules.push_back(name);
+           };
+}
 }   // Anonymous namespace
 
 //--------------------------------------------------------------------------
@@ -103,18 +141,31 @@ std::pair<std::vector<std::string>, MemAlloc> CodeGenerator::generateAll(const M
     // If force rebuild flag is set or model should be rebuilt
     const auto hashDigest = modelMerged.getHashDigest(backend);
     MemAlloc mem = MemAlloc::zero();
-    if(forceRebuild || shouldRebuildModel(outputPath, hashDigest, mem)) {
-        // Generate modules
-        mem = generateRunner(outputPath, modelMerged, backend);
-        generateSynapseUpdate(outputPath, modelMerged, backend);
-        generateNeuronUpdate(outputPath, modelMerged, backend);
-        generateCustomUpdate(outputPath, modelMerged, backend);
-        generateInit(outputPath, modelMerged, backend);
+    std::vector<std::string> modules;
+    if(forceRebuild || shouldRebuildModel(outputPath, hashDigest, mem, modules)) {
+        // Generate modules in parallel as they are independent once merged model is built
+        std::vector<std::string> synapseUpdateModules;
+        std::vector<std::string> neuronUpdateModules;
+        std::vector<std::string> initModules;
+        std::vector<std::function<void()>> generators{
+            [&backend, &mem, &modelMerged, &outputPath](){ mem = generateRunner(outputPath, modelMerged, backend); },
+            [&backend, &modelMerged, &outputPath, &synapseUpdateModules](){ synapseUpdateModules = generateSynapseUpdate(outputPath, modelMerged, backend); },
+            [&backend, &modelMerged, &neuronUpdateModules, &outputPath](){ neuronUpdateModules = generateNeuronUpdate(outputPath, modelMerged, backend); },
+            [&backend, &modelMerged, &outputPath](){ generateCustomUpdate(outputPath, modelMerged, backend); },
+            [&backend, &initModules, &modelMerged, &outputPath](){ initModules = generateInit(outputPath, modelMerged, backend); }};
 
         // Generate support code module if the backend supports namespaces
         if(backend.supportsNamespace()) {
-            generateSupportCode(outputPath, modelMerged);
+            generators.emplace_back([&modelMerged, &outputPath](){ generateSupportCode(outputPath, modelMerged); });
         }
+        Utils::parallelFor(generators.size(), backend.getPreferences().numCodeGenThreads,
+                           [&generators](size_t i){ generators[i](); });
+
+        // Build list of modules, including any additional ones generated by backend
+        modules = {"customUpdate", "neuronUpdate", "synapseUpdate", "init", "runner"};
+        modules.insert(modules.end(), synapseUpdateModules.cbegin(), synapseUpdateModules.cend());
+        modules.insert(modules.end(), neuronUpdateModules.cbegin(), neuronUpdateModules.cend());
+        modules.insert(modules.end(), initModules.cbegin(), initModules.cend());
 
         // Get list of files to copy into generated code
         const auto backendSharePath = sharePath / "backends";
@@ -137,6 +188,30 @@ std::pair<std::vector<std::string>, MemAlloc> CodeGenerator::generateAll(const M
         // Write model memory usage estimates so it can be reloaded if code doesn't need re-generating
         os << std::dec;
         os << mem << std::endl;
+
+        // Write list of modules so Makefile can be regenerated if code doesn't need re-generating
+        os << modules.size() << std::endl;
+        for(const auto &m : modules) {
+            os << m << std::endl;
+        }
+    }
+
+    // If model cache is enabled
+    if(!backend.getPreferences().modelCachePath.empty()) {
+        // Build key from model hash and makefile, which contains all the build configuration
+        boost::uuids::detail::sha1 cacheHash;
+        Utils::updateHash(hashDigest, cacheHash);
+        std::ostringstream makefile;
+        generateMakefile(makefile, backend, modules);
+        Utils::updateHash(makefile.str(), cacheHash);
+
+        // Write key as hex so makefile can find built model in cache
+        ChangedFileStream os((outputPath / "cache.sha").str());
+        os << std::hex << std::setfill('0');
+        for(const auto d : cacheHash.get_digest()) {
+            os << std::setw(8) << d;
+        }
+        os << std::endl;
     }
 
     // Show memory usage
@@ -170,15 +245,14 @@ std::pair<std::vector<std::string>, MemAlloc> CodeGenerator::generateAll(const M
     LOGI_CODE_GEN << "\t" << modelMerged.getMergedSynapseConnectivityHostInitGroups().size() << " merged synapse connectivity host init groups";
 
     // Return list of modules and memory usage
-    const std::vector<std::string> modules = {"customUpdate", "neuronUpdate", "synapseUpdate", "init", "runner"};
     return std::make_pair(modules, mem);
 }
 //--------------------------------------------------------------------------
-void CodeGenerator::generateNeuronUpdate(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
+std::vector<std::string> CodeGenerator::generateNeuronUpdate(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
                                          const BackendBase &backend, const std::string &suffix)
 {
     // Create output stream to write to file and wrap in CodeStream
-    std::ofstream neuronUpdateStream((outputPath / ("neuronUpdate" + suffix + ".cc")).str());
+    ChangedFileStream neuronUpdateStream((outputPath / ("neuronUpdate" + suffix + ".cc")).str());
     CodeStream neuronUpdate(neuronUpdateStream);
 
     neuronUpdate << "#include \"definitionsInternal" << suffix << ".h\"" << std::endl;
@@ -188,6 +262,7 @@ void CodeGenerator::generateNeuronUpdate(const filesystem::path &outputPath, con
     neuronUpdate << std::endl;
 
     // Neuron update kernel
+    std::vector<std::string> modules;
     backend.genNeuronUpdate(neuronUpdate, modelMerged,
         // Preamble handler
         [&modelMerged, &backend](CodeStream &os)
@@ -200,14 +275,20 @@ void CodeGenerator::generateNeuronUpdate(const filesystem::path &outputPath, con
         [&backend, &modelMerged](CodeStream &os)
         {
             modelMerged.genScalarEGPPush<NeuronUpdateGroupMerged>(os, backend);
-        });
+        },
+        // Module handler
+        createModuleHandler(outputPath, backend, suffix, modules));
+
+    // Sort modules so their order doesn't depend on the order merged groups were generated in
+    std::sort(modules.begin(), modules.end());
+    return modules;
 }
 //--------------------------------------------------------------------------
 void CodeGenerator::generateCustomUpdate(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
                                          const BackendBase &backend, const std::string &suffix)
 {
     // Create output stream to write to file and wrap in CodeStream
-    std::ofstream customUpdateStream((outputPath / ("customUpdate" + suffix + ".cc")).str());
+    ChangedFileStream customUpdateStream((outputPath / ("customUpdate" + suffix + ".cc")).str());
     CodeStream customUpdate(customUpdateStream);
 
     customUpdate << "#include \"definitionsInternal" << suffix << ".h\"" << std::endl;
@@ -233,11 +314,11 @@ void CodeGenerator::generateCustomUpdate(const filesystem::path &outputPath, con
         });
 }
 //--------------------------------------------------------------------------
-void CodeGenerator::generateSynapseUpdate(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
+std::vector<std::string> CodeGenerator::generateSynapseUpdate(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
                                           const BackendBase &backend, const std::string &suffix)
 {
     // Create output stream to write to file and wrap in CodeStream
-    std::ofstream synapseUpdateStream((outputPath / ("synapseUpdate" + suffix + ".cc")).str());
+    ChangedFileStream synapseUpdateStream((outputPath / ("synapseUpdate" + suffix + ".cc")).str());
     CodeStream synapseUpdate(synapseUpdateStream);
 
     synapseUpdate << "#include \"definitionsInternal" << suffix << ".h\"" << std::endl;
@@ -247,6 +328,7 @@ void CodeGenerator::generateSynapseUpdate(const filesystem::path &outputPath, co
     synapseUpdate << std::endl;
 
     // Synaptic update kernels
+    std::vector<std::string> modules;
     backend.genSynapseUpdate(synapseUpdate, modelMerged,
         // Preamble handler
         [&modelMerged, &backend](CodeStream &os)
@@ -262,18 +344,25 @@ void CodeGenerator::generateSynapseUpdate(const filesystem::path &outputPath, co
             modelMerged.genScalarEGPPush<PresynapticUpdateGroupMerged>(os, backend);
             modelMerged.genScalarEGPPush<PostsynapticUpdateGroupMerged>(os, backend);
             modelMerged.genScalarEGPPush<SynapseDynamicsGroupMerged>(os, backend);
-        });
+        },
+        // Module handler
+        createModuleHandler(outputPath, backend, suffix, modules));
+
+    // Sort modules so their order doesn't depend on the order merged groups were generated in
+    std::sort(modules.begin(), modules.end());
+    return modules;
 }
 //--------------------------------------------------------------------------
-void CodeGenerator::generateInit(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
+std::vector<std::string> CodeGenerator::generateInit(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
                                  const BackendBase &backend, const std::string &suffix)
 {
     // Create output stream to write to file and wrap in CodeStream
-    std::ofstream initStream((outputPath / ("init" + suffix + ".cc")).str());
+    ChangedFileStream initStream((outputPath / ("init" + suffix + ".cc")).str());
     CodeStream init(initStream);
 
     init << "#include \"definitionsInternal" << suffix << ".h\"" << std::endl;
 
+    std::vector<std::string> modules;
     backend.genInit(init, modelMerged,
         // Preamble handler
         [&modelMerged, &backend](CodeStream &os)
@@ -299,5 +388,11 @@ void CodeGenerator::generateInit(const filesystem::path &outputPath, const Model
         {
             modelMerged.genScalarEGPPush<SynapseSparseInitGroupMerged>(os, backend);
             modelMerged.genScalarEGPPush<CustomWUUpdateSparseInitGroupMerged>(os, backend);
-        });
+        },
+        // Module handler
+        createModuleHandler(outputPath, backend, suffix, modules));
+
+    // Sort modules so their order doesn't depend on the order merged groups were generated in
+    std::sort(modules.begin(), modules.end());
+    return modules;
 }
@@ -1,7 +1,9 @@
 #include "code_generator/generateRunner.h"
 
 // Standard C++ includes
+#include <algorithm>
 #include <fstream>
+#include <iterator>
 #include <numeric>
 #include <random>
 #include <set>
@@ -12,6 +14,7 @@
 #include "gennUtils.h"
 
 // GeNN code generator
+#include "code_generator/changedFileStream.h"
 #include "code_generator/codeGenUtils.h"
 #include "code_generator/codeStream.h"
 #include "code_generator/groupMerged.h"
@@ -92,6 +95,20 @@ void genHostScalar(CodeStream &definitionsVar, CodeStream &runnerVarDecl, const
     runnerVarDecl << type << " " << name << " = " << value << ";" << std::endl;
 }
 //--------------------------------------------------------------------------
+template<typename T>
+void genMergedGroupTimes(CodeStream &definitionsVar, CodeStream &runnerVarDecl, const std::vector<T> &mergedGroups)
+{
+    for(const auto &m : mergedGroups) {
+        // List the groups merged into this one so time can be attributed to them
+        definitionsVar << "// merged" << T::name << "Group" << m.getIndex() << ":";
+        for(const auto &g : m.getGroups()) {
+            definitionsVar << " " << g.get().getName();
+        }
+        definitionsVar << std::endl;
+        genHostScalar(definitionsVar, runnerVarDecl, "double", "merged" + T::name + "Group" + std::to_string(m.getIndex()) + "Time", "0.0");
+    }
+}
+//--------------------------------------------------------------------------
 void genHostDeviceScalar(const BackendBase &backend, CodeStream &definitionsVar, CodeStream &definitionsInternalVar,
                          CodeStream &runnerVarDecl, CodeStream &runnerVarAlloc, CodeStream &runnerVarFree,
                          const std::string &type, const std::string &name, const std::string &hostValue, MemAlloc &mem)
@@ -253,12 +270,15 @@ void genVariable(const BackendBase &backend, CodeStream &definitionsVar, CodeStr
                      CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
                      CodeStream &push, CodeStream &pull, const std::string &type, const std::string &name,
                      VarLocation loc, bool autoInitialized, size_t count, MemAlloc &mem,
-                     std::vector<std::string> &statePushPullFunction)
+                     std::vector<std::string> &statePushPullFunction, const std::string &pullPreamble = "",
+                     const std::string &pushPreamble = "")
 {
     // Generate push and pull functions
     genVarPushPullScope(definitionsFunc, push, pull, loc, backend.getPreferences().automaticCopy, name, statePushPullFunction,
         [&]()
         {
+            push << pushPreamble;
+            pull << pullPreamble;
             backend.genVariablePushPull(push, pull, type, name, loc, autoInitialized, count);
         });
 
@@ -331,6 +351,31 @@ void genExtraGlobalParam(const ModelSpecMerged &modelMerged, const BackendBase &
     }
 }
 //-------------------------------------------------------------------------
+template<typename D>
+void genDynamicParams(const ModelSpecInternal &model, CodeStream &definitionsVar, CodeStream &definitionsFunc,
+                      CodeStream &runnerVarDecl, CodeStream &runnerExtraGlobalParamFunc, 
+                      const Snippet::Base::StringVec &paramNames, const std::vector<double> &params,
+                      const std::string &suffix, D isDynamicFn)
+{
+    for(size_t p = 0; p < paramNames.size(); p++) {
+        if(isDynamicFn(p)) {
+            // Generate host scalar, initialised to parameter value model was built with
+            // **NOTE** this is copied into merged structures before each kernel launch like scalar extra global parameters
+            const std::string name = paramNames[p] + suffix;
+            genHostScalar(definitionsVar, runnerVarDecl, model.getPrecision(), name, 
+                          Utils::writePreciseString(params[p]));
+
+            // Generate setter function
+            definitionsFunc << "EXPORT_FUNC void set" << name << "(" << model.getPrecision() << " value);" << std::endl;
+            runnerExtraGlobalParamFunc << "void set" << name << "(" << model.getPrecision() << " value)";
+            {
+                CodeStream::Scope b(runnerExtraGlobalParamFunc);
+                runnerExtraGlobalParamFunc << name << " = value;" << std::endl;
+            }
+        }
+    }
+}
+//-------------------------------------------------------------------------
 void genGlobalHostRNG(CodeStream &definitionsVar, CodeStream &runnerVarDecl,
                       CodeStream &runnerVarAlloc, unsigned int seed, MemAlloc &mem)
 {
@@ -476,6 +521,10 @@ void genCustomUpdate(const ModelSpecMerged &modelMerged, const BackendBase &back
                                 csExtraGlobalParams[i].type, csExtraGlobalParams[i].name + c.first,
                                 true, VarLocation::HOST_DEVICE);
         }
+
+        genDynamicParams(modelMerged.getModel(), definitionsVar, definitionsFunc, runnerVarDecl, runnerExtraGlobalParamFunc,
+                         cuModel->getParamNames(), c.second.getParams(), c.first,
+                         [&c](size_t p) { return c.second.isParamDynamic(p); });
     }
 }
 }   // Anonymous namespace
@@ -487,9 +536,9 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
                                        const BackendBase &backend, const std::string &suffix)
 {
     // Create output streams to write to file and wrap in CodeStreams
-    std::ofstream definitionsStream((outputPath / ("definitions" + suffix + ".h")).str());
-    std::ofstream definitionsInternalStream((outputPath / ("definitionsInternal" + suffix + ".h")).str());
-    std::ofstream runnerStream((outputPath / ("runner" + suffix + ".cc")).str());
+    ChangedFileStream definitionsStream((outputPath / ("definitions" + suffix + ".h")).str());
+    ChangedFileStream definitionsInternalStream((outputPath / ("definitionsInternal" + suffix + ".h")).str());
+    ChangedFileStream runnerStream((outputPath / ("runner" + suffix + ".cc")).str());
     CodeStream definitions(definitionsStream);
     CodeStream definitionsInternal(definitionsInternalStream);
     CodeStream runner(runnerStream);
@@ -629,6 +678,21 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
     genHostScalar(definitionsVar, runnerVarDecl, "double", "postsynapticUpdateTime", "0.0");
     genHostScalar(definitionsVar, runnerVarDecl, "double", "synapseDynamicsTime", "0.0");
 
+    // Generate variables to store the load imbalance between threads of the last timestep's synapse updates
+    // **NOTE** these are only measured by backends which balance work between threads on the host
+    genHostScalar(definitionsVar, runnerVarDecl, "double", "presynapticUpdateImbalance", "0.0");
+    genHostScalar(definitionsVar, runnerVarDecl, "double", "synapseDynamicsImbalance", "0.0");
+
+    // Generate variables to store total elapsed time initialising each merged group
+    // **NOTE** these are only measured by backends which initialise merged groups on the host
+    genMergedGroupTimes(definitionsVar, runnerVarDecl, modelMerged.getMergedNeuronInitGroups());
+    genMergedGroupTimes(definitionsVar, runnerVarDecl, modelMerged.getMergedSynapseInitGroups());
+    genMergedGroupTimes(definitionsVar, runnerVarDecl, modelMerged.getMergedCustomUpdateInitGroups());
+    genMergedGroupTimes(definitionsVar, runnerVarDecl, modelMerged.getMergedCustomWUUpdateInitGroups());
+    genMergedGroupTimes(definitionsVar, runnerVarDecl, modelMerged.getMergedSynapseConnectivityInitGroups());
+    genMergedGroupTimes(definitionsVar, runnerVarDecl, modelMerged.getMergedSynapseSparseInitGroups());
+    genMergedGroupTimes(definitionsVar, runnerVarDecl, modelMerged.getMergedCustomWUUpdateSparseInitGroups());
+
     // Generate variables to store total elapsed time for each custom update group
     for(const auto &g : customUpdateGroups) {
         genHostScalar(definitionsVar, runnerVarDecl, "double", "customUpdate" + g + "Time", "0.0");
@@ -772,6 +836,11 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
     for(const auto &m : modelMerged.getMergedSynapseDynamicsGroups()) {
         m.generateRunner(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar,
                          runnerVarDecl, runnerMergedStructAlloc);
+
+        // If synapse dynamics are lazily evaluated, declare function generated by backend to bring a group up to date
+        if(backend.isLazySynapseDynamicsSupported() && m.getArchetype().isLazySynapseDynamicsRequired()) {
+            definitionsInternalFunc << "EXPORT_FUNC void updateLazySynapseDynamics" << m.getIndex() << "(unsigned int g);" << std::endl;
+        }
     }
 
     // Loop through neuron groups whose previous spike times need resetting
@@ -1005,6 +1074,11 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
         const auto vars = neuronModel->getVars();
         std::vector<std::string> neuronStatePushPullFunctions;
         for(size_t i = 0; i < vars.size(); i++) {
+            // Skip variables which have been eliminated or folded into code
+            if(!n.second.isVarArrayRequired(i)) {
+                continue;
+            }
+
             const auto *varInitSnippet = n.second.getVarInitialisers()[i].getSnippet();
             const unsigned int numCopies = getNumVarCopies(vars[i].access, batchSize);
             const unsigned int numElements = getNumVarElements(vars[i].access, n.second.getNumNeurons());
@@ -1067,6 +1141,10 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
                                 true, n.second.getExtraGlobalParamLocation(i));
         }
 
+        genDynamicParams(model, definitionsVar, definitionsFunc, runnerVarDecl, runnerExtraGlobalParamFunc,
+                         neuronModel->getParamNames(), n.second.getParams(), n.first,
+                         [&n](size_t p) { return n.second.isParamDynamic(p); });
+
         if(!n.second.getCurrentSources().empty()) {
             allVarStreams << "// current source variables" << std::endl;
         }
@@ -1076,6 +1154,11 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
 
             std::vector<std::string> currentSourceStatePushPullFunctions;
             for(size_t i = 0; i < csVars.size(); i++) {
+                // Skip variables which have been eliminated or folded into code
+                if(!cs->isVarArrayRequired(i)) {
+                    continue;
+                }
+
                 const auto *varInitSnippet = cs->getVarInitialisers()[i].getSnippet();
                 const bool autoInitialized = !varInitSnippet->getCode().empty();
                 genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
@@ -1106,6 +1189,10 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
                                     csExtraGlobalParams[i].type, csExtraGlobalParams[i].name + cs->getName(),
                                     true, cs->getExtraGlobalParamLocation(i));
             }
+
+            genDynamicParams(model, definitionsVar, definitionsFunc, runnerVarDecl, runnerExtraGlobalParamFunc,
+                             csModel->getParamNames(), cs->getParams(), cs->getName(),
+                             [cs](size_t p) { return cs->isParamDynamic(p); });
         }
     }
     allVarStreams << std::endl;
@@ -1157,6 +1244,11 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
             if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) {
                 const auto psmVars = sg->getPSModel()->getVars();
                 for(size_t v = 0; v < psmVars.size(); v++) {
+                    // Skip variables which have been eliminated or folded into code
+                    if(!sg->isPSVarArrayRequired(v)) {
+                        continue;
+                    }
+
                     backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                      psmVars[v].type, psmVars[v].name + sg->getFusedPSVarSuffix(), sg->getPSVarLocation(v),
                                      getVarSize(psmVars[v].access, sg->getTrgNeuronGroup()->getNumNeurons(), batchSize), mem);
@@ -1280,6 +1372,12 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
                     // Allocate remap
                     backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                      "unsigned int", "remap" + s.second.getName(), VarLocation::DEVICE, postSize, mem);
+
+                    // If required, allocate column-major presynaptic indices
+                    if(backend.isPostsynapticRemapPreIndRequired()) {
+                        backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                         "unsigned int", "remapPreInd" + s.second.getName(), VarLocation::DEVICE, postSize, mem);
+                    }
                 }
 
                 // Generate push and pull functions for sparse connectivity
@@ -1313,15 +1411,45 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
         const bool proceduralWeights = (s.second.getMatrixType() & SynapseMatrixWeight::PROCEDURAL);
         std::vector<std::string> synapseGroupStatePushPullFunctions;
         if (!s.second.isWeightSharingSlave() && (individualWeights || proceduralWeights || kernelWeights)) {
+            // If synapse dynamics are lazily evaluated
+            std::string lazyPullPreamble;
+            std::string lazyPushPreamble;
+            if(backend.isLazySynapseDynamicsSupported() && s.second.isLazySynapseDynamicsRequired()) {
+                // Allocate times each synapse was last brought up to date
+                const size_t size = (size_t)s.second.getSrcNeuronGroup()->getNumNeurons() * (size_t)backend.getSynapticMatrixRowStride(s.second);
+                backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                 model.getTimePrecision(), "lazyT" + s.second.getName(), VarLocation::DEVICE, size * batchSize, mem);
+
+                // Pushed state is the state at the current time so mark all synapses as up to date
+                // **NOTE** this means state should be pulled before it is modified and pushed
+                lazyPushPreamble = "std::fill_n(lazyT" + s.second.getName() + ", " + std::to_string(size * batchSize) + ", t);\n";
+
+                // Find this group within merged synapse dynamics groups so variables can be brought up to date before they are pulled
+                for(const auto &m : modelMerged.getMergedSynapseDynamicsGroups()) {
+                    const auto &groups = m.getGroups();
+                    const auto g = std::find_if(groups.cbegin(), groups.cend(),
+                                                [&s](const SynapseGroupInternal &sg){ return (&sg == &s.second); });
+                    if(g != groups.cend()) {
+                        lazyPullPreamble = "updateLazySynapseDynamics" + std::to_string(m.getIndex()) + "(" + std::to_string(std::distance(groups.cbegin(), g)) + ");\n";
+                    }
+                }
+            }
+
             const auto wuVars = wu->getVars();
             for(size_t i = 0; i < wuVars.size(); i++) {
+                // Skip variables which have been eliminated or folded into code
+                if(!s.second.isWUVarArrayRequired(i)) {
+                    continue;
+                }
+
                 const auto *varInitSnippet = s.second.getWUVarInitialisers()[i].getSnippet();
                 const bool autoInitialized = !varInitSnippet->getCode().empty();
                 if(individualWeights) {
                     const size_t size = (size_t)s.second.getSrcNeuronGroup()->getNumNeurons() * (size_t)backend.getSynapticMatrixRowStride(s.second);
                     genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                 runnerPushFunc, runnerPullFunc, wuVars[i].type, wuVars[i].name + s.second.getName(), s.second.getWUVarLocation(i),
-                                autoInitialized, size * getNumVarCopies(wuVars[i].access, batchSize), mem, synapseGroupStatePushPullFunctions);
+                                autoInitialized, size * getNumVarCopies(wuVars[i].access, batchSize), mem, synapseGroupStatePushPullFunctions,
+                                lazyPullPreamble, lazyPushPreamble);
                 }
                 else if(kernelWeights) {
                      // Calculate size of kernel
@@ -1360,6 +1488,11 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
             if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) {
                 const auto psmVars = psm->getVars();
                 for(size_t i = 0; i < psmVars.size(); i++) {
+                    // Skip variables which have been eliminated or folded into code
+                    if(!s.second.isPSVarArrayRequired(i)) {
+                        continue;
+                    }
+
                     const bool autoInitialized = !s.second.getPSVarInitialisers()[i].getSnippet()->getCode().empty();
                     genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, s.second.getPSVarLocation(i),
                                         backend.getPreferences().automaticCopy, psmVars[i].name + s.second.getName(), synapseGroupStatePushPullFunctions,
@@ -1433,6 +1566,13 @@ MemAlloc CodeGenerator::generateRunner(const filesystem::path &outputPath, const
                                 true, s.second.getWUExtraGlobalParamLocation(i));
         }
 
+        genDynamicParams(model, definitionsVar, definitionsFunc, runnerVarDecl, runnerExtraGlobalParamFunc,
+                         psm->getParamNames(), s.second.getPSParams(), s.second.getName(),
+                         [&s](size_t p) { return s.second.isPSParamDynamic(p); });
+        genDynamicParams(model, definitionsVar, definitionsFunc, runnerVarDecl, runnerExtraGlobalParamFunc,
+                         wu->getParamNames(), s.second.getWUParams(), s.second.getName(),
+                         [&s](size_t p) { return s.second.isWUParamDynamic(p); });
+
         // If group isn't a weight sharing slave 
         if(!s.second.isWeightSharingSlave()) {
             const auto sparseConnExtraGlobalParams = s.second.getConnectivityInitialiser().getSnippet()->getExtraGlobalParams();
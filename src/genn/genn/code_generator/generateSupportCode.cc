@@ -5,6 +5,7 @@
 #include <string>
 
 // GeNN code generator includes
+#include "code_generator/changedFileStream.h"
 #include "code_generator/codeGenUtils.h"
 #include "code_generator/codeStream.h"
 #include "code_generator/modelSpecMerged.h"
@@ -15,7 +16,7 @@
 void CodeGenerator::generateSupportCode(const filesystem::path &outputPath, const ModelSpecMerged &modelMerged, 
                                         const std::string &suffix)
 {
-    std::ofstream supportCodeStream((outputPath / ("supportCode" + suffix + ".h")).str());
+    ChangedFileStream supportCodeStream((outputPath / ("supportCode" + suffix + ".h")).str());
     CodeStream supportCode(supportCodeStream);
 
     supportCode << "#pragma once" << std::endl;
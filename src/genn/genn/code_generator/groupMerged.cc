@@ -99,7 +99,8 @@ NeuronPrevSpikeTimeUpdateGroupMerged::NeuronPrevSpikeTimeUpdateGroupMerged(size_
 //----------------------------------------------------------------------------
 bool NeuronGroupMergedBase::isParamHeterogeneous(size_t index) const
 {
-    return isParamValueHeterogeneous(index, [](const NeuronGroupInternal &ng) { return ng.getParams(); });
+    return (getArchetype().isParamDynamic(index) 
+            || isParamValueHeterogeneous(index, [](const NeuronGroupInternal &ng) { return ng.getParams(); }));
 }
 //----------------------------------------------------------------------------
 bool NeuronGroupMergedBase::isDerivedParamHeterogeneous(size_t index) const
@@ -121,11 +122,19 @@ bool NeuronGroupMergedBase::isVarInitDerivedParamHeterogeneous(size_t varIndex,
                                       [varIndex](const NeuronGroupInternal &sg){ return sg.getVarInitialisers().at(varIndex).getDerivedParams(); }));
 }
 //----------------------------------------------------------------------------
+bool NeuronGroupMergedBase::isConstantVarHeterogeneous(size_t varIndex) const
+{
+    return (getArchetype().isVarConstantFolded(varIndex) &&
+            isParamValueHeterogeneous(0,
+                                      [varIndex](const NeuronGroupInternal &ng) { return ng.getVarInitialisers().at(varIndex).getParams(); }));
+}
+//----------------------------------------------------------------------------
 bool NeuronGroupMergedBase::isCurrentSourceParamHeterogeneous(size_t childIndex, size_t paramIndex) const
 {
     return (isCurrentSourceParamReferenced(childIndex, paramIndex) &&
-            isChildParamValueHeterogeneous(childIndex, paramIndex, m_SortedCurrentSources,
-                                           [](const CurrentSourceInternal *cs) { return cs->getParams(); }));
+            (getSortedArchetypeCurrentSources().at(childIndex)->isParamDynamic(paramIndex)
+             || isChildParamValueHeterogeneous(childIndex, paramIndex, m_SortedCurrentSources,
+                                               [](const CurrentSourceInternal *cs) { return cs->getParams(); })));
 }
 //----------------------------------------------------------------------------
 bool NeuronGroupMergedBase::isCurrentSourceDerivedParamHeterogeneous(size_t childIndex, size_t paramIndex) const
@@ -150,11 +159,19 @@ bool NeuronGroupMergedBase::isCurrentSourceVarInitDerivedParamHeterogeneous(size
                                            [varIndex](const CurrentSourceInternal *cs) { return cs->getVarInitialisers().at(varIndex).getDerivedParams(); }));
 }
 //----------------------------------------------------------------------------
+bool NeuronGroupMergedBase::isCurrentSourceConstantVarHeterogeneous(size_t childIndex, size_t varIndex) const
+{
+    return (getSortedArchetypeCurrentSources().at(childIndex)->isVarConstantFolded(varIndex) &&
+            isChildParamValueHeterogeneous(childIndex, 0, m_SortedCurrentSources,
+                                           [varIndex](const CurrentSourceInternal *cs) { return cs->getVarInitialisers().at(varIndex).getParams(); }));
+}
+//----------------------------------------------------------------------------
 bool NeuronGroupMergedBase::isPSMParamHeterogeneous(size_t childIndex, size_t paramIndex) const
 {
     return (isPSMParamReferenced(childIndex, paramIndex) &&
-            isChildParamValueHeterogeneous(childIndex, paramIndex, m_SortedMergedInSyns,
-                                           [](const SynapseGroupInternal *inSyn) { return inSyn->getPSParams(); }));
+            (getSortedArchetypeMergedInSyns().at(childIndex)->isPSParamDynamic(paramIndex)
+             || isChildParamValueHeterogeneous(childIndex, paramIndex, m_SortedMergedInSyns,
+                                               [](const SynapseGroupInternal *inSyn) { return inSyn->getPSParams(); })));
 }
 //----------------------------------------------------------------------------
 bool NeuronGroupMergedBase::isPSMDerivedParamHeterogeneous(size_t childIndex, size_t paramIndex) const
@@ -172,6 +189,13 @@ bool NeuronGroupMergedBase::isPSMGlobalVarHeterogeneous(size_t childIndex, size_
 
 }
 //----------------------------------------------------------------------------
+bool NeuronGroupMergedBase::isPSMConstantVarHeterogeneous(size_t childIndex, size_t varIndex) const
+{
+    return (getSortedArchetypeMergedInSyns().at(childIndex)->isPSVarConstantFolded(varIndex) &&
+            isChildParamValueHeterogeneous(childIndex, 0, m_SortedMergedInSyns,
+                                           [varIndex](const SynapseGroupInternal *inSyn) { return inSyn->getPSVarInitialisers().at(varIndex).getParams(); }));
+}
+//----------------------------------------------------------------------------
 bool NeuronGroupMergedBase::isPSMVarInitParamHeterogeneous(size_t childIndex, size_t varIndex, size_t paramIndex) const
 {
     return (isPSMVarInitParamReferenced(childIndex, varIndex, paramIndex) &&
@@ -244,15 +268,27 @@ NeuronGroupMergedBase::NeuronGroupMergedBase(size_t index, const std::string &pr
     const auto &varInit = getArchetype().getVarInitialisers();
     assert(vars.size() == varInit.size());
     for(size_t v = 0; v < vars.size(); v++) {
-        // If we're not initialising or if there is initialization code for this variable
+        // If variable is implemented as an array
         const auto var = vars[v];
-        if(!init || !varInit[v].getSnippet()->getCode().empty()) {
-            addPointerField(var.type, var.name, backend.getDeviceVarPrefix() + var.name);
-        }
+        if(getArchetype().isVarArrayRequired(v)) {
+            // If we're not initialising or if there is initialization code for this variable
+            if(!init || !varInit[v].getSnippet()->getCode().empty()) {
+                addPointerField(var.type, var.name, backend.getDeviceVarPrefix() + var.name);
+            }
 
-        // If we're initializing, add any var init EGPs to structure
-        if(init) {
-            addEGPs(varInit[v].getSnippet()->getExtraGlobalParams(), backend.getDeviceVarPrefix(), var.name);
+            // If we're initializing, add any var init EGPs to structure
+            if(init) {
+                addEGPs(varInit[v].getSnippet()->getExtraGlobalParams(), backend.getDeviceVarPrefix(), var.name);
+            }
+        }
+        // Otherwise, if variable has been folded into code, we're updating and it should be implemented heterogeneously, add value
+        // **NOTE** like global variable values, these aren't useful during initialization
+        else if(!init && isConstantVarHeterogeneous(v)) {
+            addScalarField(var.name,
+                           [v](const NeuronGroupInternal &ng, size_t)
+                           {
+                               return Utils::writePreciseString(ng.getVarInitialisers().at(v).getParams().at(0));
+                           });
         }
     }
 
@@ -275,7 +311,9 @@ NeuronGroupMergedBase::NeuronGroupMergedBase(size_t index, const std::string &pr
         addHeterogeneousParams<NeuronGroupMergedBase>(
             getArchetype().getNeuronModel()->getParamNames(), "",
             [](const NeuronGroupInternal &ng) { return ng.getParams(); },
-            &NeuronGroupMergedBase::isParamHeterogeneous);
+            &NeuronGroupMergedBase::isParamHeterogeneous,
+            [](const NeuronGroupInternal &ng, size_t p) { return ng.isParamDynamic(p); },
+            [](const NeuronGroupInternal &ng) { return ng.getName(); });
 
         // Add heterogeneous neuron model derived parameters
         addHeterogeneousDerivedParams<NeuronGroupMergedBase>(
@@ -304,6 +342,20 @@ NeuronGroupMergedBase::NeuronGroupMergedBase(size_t index, const std::string &pr
             // If PSM has individual variables
             const auto var = vars[v];
             if(sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) {
+                // If variable has been eliminated or folded into code
+                if(!sg->isPSVarArrayRequired(v)) {
+                    // If we're updating and folded value should be implemented heterogeneously, add value
+                    if(!init && isPSMConstantVarHeterogeneous(i, v)) {
+                        addScalarField(var.name + "InSyn" + std::to_string(i),
+                                       [this, i, v](const NeuronGroupInternal &, size_t groupIndex)
+                                       {
+                                           const double val = m_SortedMergedInSyns.at(groupIndex).at(i)->getPSVarInitialisers().at(v).getParams().at(0);
+                                           return Utils::writePreciseString(val);
+                                       });
+                    }
+                    continue;
+                }
+
                 // Add pointers to state variable
                 if(!init || !varInit[v].getSnippet()->getCode().empty()) {
                     addMergedInSynPointerField(var.type, var.name + "InSyn", i, backend.getDeviceVarPrefix() + var.name);
@@ -343,7 +395,8 @@ NeuronGroupMergedBase::NeuronGroupMergedBase(size_t index, const std::string &pr
             const auto paramNames = sg->getPSModel()->getParamNames();
             addHeterogeneousChildParams(paramNames, m_SortedMergedInSyns, i, "InSyn",
                                         &NeuronGroupMergedBase::isPSMParamHeterogeneous,
-                                        &SynapseGroupInternal::getPSParams);
+                                        &SynapseGroupInternal::getPSParams,
+                                        &SynapseGroupInternal::isPSParamDynamic);
 
             // Add any heterogeneous postsynaptic mode derived parameters
             const auto derivedParams = sg->getPSModel()->getDerivedParams();
@@ -374,8 +427,22 @@ NeuronGroupMergedBase::NeuronGroupMergedBase(size_t index, const std::string &pr
         const auto vars = cs->getCurrentSourceModel()->getVars();
         const auto &varInit = cs->getVarInitialisers();
         for(size_t v = 0; v < vars.size(); v++) {
-            // Add pointers to state variable
+            // If variable has been eliminated or folded into code
             const auto var = vars[v];
+            if(!cs->isVarArrayRequired(v)) {
+                // If we're updating and folded value should be implemented heterogeneously, add value
+                if(!init && isCurrentSourceConstantVarHeterogeneous(i, v)) {
+                    addScalarField(var.name + "CS" + std::to_string(i),
+                                   [this, i, v](const NeuronGroupInternal &, size_t groupIndex)
+                                   {
+                                       const double val = m_SortedCurrentSources.at(groupIndex).at(i)->getVarInitialisers().at(v).getParams().at(0);
+                                       return Utils::writePreciseString(val);
+                                   });
+                }
+                continue;
+            }
+
+            // Add pointers to state variable
             if(!init || !varInit[v].getSnippet()->getCode().empty()) {
                 assert(!Utils::isTypePointer(var.type));
                 addField(var.type + "*", var.name + "CS" + std::to_string(i),
@@ -405,7 +472,8 @@ NeuronGroupMergedBase::NeuronGroupMergedBase(size_t index, const std::string &pr
             const auto paramNames = cs->getCurrentSourceModel()->getParamNames();
             addHeterogeneousChildParams(paramNames, m_SortedCurrentSources, i, "CS",
                                         &NeuronGroupMergedBase::isCurrentSourceParamHeterogeneous,
-                                        &CurrentSourceInternal::getParams);
+                                        &CurrentSourceInternal::getParams,
+                                        &CurrentSourceInternal::isParamDynamic);
 
             // Add any heterogeneous current source derived parameters
             const auto derivedParams = cs->getCurrentSourceModel()->getDerivedParams();
@@ -469,9 +537,19 @@ void NeuronGroupMergedBase::updateBaseHash(bool init, boost::uuids::detail::sha1
         // Loop through child current sources
         for(size_t i = 0; i < getSortedArchetypeCurrentSources().size(); i++) {
             updateChildParamHash(m_SortedCurrentSources, i, &NeuronGroupMergedBase::isCurrentSourceParamReferenced, 
-                                 &CurrentSourceInternal::getParams, hash);
+                                 &CurrentSourceInternal::getHashableParams, hash);
             updateChildDerivedParamHash(m_SortedCurrentSources, i, &NeuronGroupMergedBase::isCurrentSourceDerivedParamReferenced, 
                                         &CurrentSourceInternal::getDerivedParams, hash);
+
+            // Update hash with the values of any variables folded into code
+            const auto *cs = getSortedArchetypeCurrentSources().at(i);
+            for(size_t v = 0; v < cs->getVarInitialisers().size(); v++) {
+                if(cs->isVarConstantFolded(v)) {
+                    for(const auto &c : m_SortedCurrentSources) {
+                        Utils::updateHash(c.at(i)->getVarInitialisers().at(v).getParams().at(0), hash);
+                    }
+                }
+            }
         }
 
         // Loop through child merged insyns
@@ -479,7 +557,7 @@ void NeuronGroupMergedBase::updateBaseHash(bool init, boost::uuids::detail::sha1
             const auto *sg = getSortedArchetypeMergedInSyns().at(i);
 
             updateChildParamHash(m_SortedMergedInSyns, i, &NeuronGroupMergedBase::isPSMParamReferenced, 
-                                 &SynapseGroupInternal::getPSParams, hash);
+                                 &SynapseGroupInternal::getHashablePSParams, hash);
             updateChildDerivedParamHash(m_SortedMergedInSyns, i, &NeuronGroupMergedBase::isPSMDerivedParamReferenced, 
                                         &SynapseGroupInternal::getPSDerivedParams, hash);
 
@@ -487,6 +565,16 @@ void NeuronGroupMergedBase::updateBaseHash(bool init, boost::uuids::detail::sha1
                 updateChildParamHash(m_SortedMergedInSyns, i, &NeuronGroupMergedBase::isPSMGlobalVarReferenced,
                                      &SynapseGroupInternal::getPSConstInitVals, hash);
             }
+            // Otherwise, update hash with the values of any variables folded into code
+            else {
+                for(size_t v = 0; v < sg->getPSVarInitialisers().size(); v++) {
+                    if(sg->isPSVarConstantFolded(v)) {
+                        for(const auto &c : m_SortedMergedInSyns) {
+                            Utils::updateHash(c.at(i)->getPSVarInitialisers().at(v).getParams().at(0), hash);
+                        }
+                    }
+                }
+            }
         }
     }
 }
@@ -700,7 +788,8 @@ bool SynapseConnectivityHostInitGroupMerged::isSparseConnectivityInitDerivedPara
 bool SynapseGroupMergedBase::isWUParamHeterogeneous(size_t paramIndex) const
 {
     return (isWUParamReferenced(paramIndex) && 
-            isParamValueHeterogeneous(paramIndex, [](const SynapseGroupInternal &sg) { return sg.getWUParams(); }));
+            (getArchetype().isWUParamDynamic(paramIndex)
+             || isParamValueHeterogeneous(paramIndex, [](const SynapseGroupInternal &sg) { return sg.getWUParams(); })));
 }
 //----------------------------------------------------------------------------
 bool SynapseGroupMergedBase::isWUDerivedParamHeterogeneous(size_t paramIndex) const
@@ -715,6 +804,12 @@ bool SynapseGroupMergedBase::isWUGlobalVarHeterogeneous(size_t varIndex) const
             isParamValueHeterogeneous(varIndex, [](const SynapseGroupInternal &sg) { return sg.getWUConstInitVals(); }));
 }
 //----------------------------------------------------------------------------
+bool SynapseGroupMergedBase::isWUConstantVarHeterogeneous(size_t varIndex) const
+{
+    return (getArchetype().isWUVarConstantFolded(varIndex) &&
+            isParamValueHeterogeneous(0, [varIndex](const SynapseGroupInternal &sg) { return sg.getWUVarInitialisers().at(varIndex).getParams(); }));
+}
+//----------------------------------------------------------------------------
 bool SynapseGroupMergedBase::isWUVarInitParamHeterogeneous(size_t varIndex, size_t paramIndex) const
 {
     return (isWUVarInitParamReferenced(varIndex, paramIndex) &&
@@ -754,7 +849,8 @@ bool SynapseGroupMergedBase::isToeplitzConnectivityInitDerivedParamHeterogeneous
 bool SynapseGroupMergedBase::isSrcNeuronParamHeterogeneous(size_t paramIndex) const
 {
     return (isSrcNeuronParamReferenced(paramIndex) &&
-            isParamValueHeterogeneous(paramIndex, [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getParams(); }));
+            (getArchetype().getSrcNeuronGroup()->isParamDynamic(paramIndex)
+             || isParamValueHeterogeneous(paramIndex, [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getParams(); })));
 }
 //----------------------------------------------------------------------------
 bool SynapseGroupMergedBase::isSrcNeuronDerivedParamHeterogeneous(size_t paramIndex) const
@@ -766,7 +862,8 @@ bool SynapseGroupMergedBase::isSrcNeuronDerivedParamHeterogeneous(size_t paramIn
 bool SynapseGroupMergedBase::isTrgNeuronParamHeterogeneous(size_t paramIndex) const
 {
     return (isTrgNeuronParamReferenced(paramIndex) &&
-            isParamValueHeterogeneous(paramIndex, [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getParams(); }));
+            (getArchetype().getTrgNeuronGroup()->isParamDynamic(paramIndex)
+             || isParamValueHeterogeneous(paramIndex, [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getParams(); })));
 }
 //----------------------------------------------------------------------------
 bool SynapseGroupMergedBase::isTrgNeuronDerivedParamHeterogeneous(size_t paramIndex) const
@@ -927,7 +1024,9 @@ SynapseGroupMergedBase::SynapseGroupMergedBase(size_t index, const std::string &
         addHeterogeneousParams<SynapseGroupMergedBase>(
             getArchetype().getSrcNeuronGroup()->getNeuronModel()->getParamNames(), "Pre",
             [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getParams(); },
-            &SynapseGroupMergedBase::isSrcNeuronParamHeterogeneous);
+            &SynapseGroupMergedBase::isSrcNeuronParamHeterogeneous,
+            [](const SynapseGroupInternal &sg, size_t p) { return sg.getSrcNeuronGroup()->isParamDynamic(p); },
+            [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getName(); });
 
         // Add heterogeneous presynaptic neuron model derived parameters
         addHeterogeneousDerivedParams<SynapseGroupMergedBase>(
@@ -939,7 +1038,9 @@ SynapseGroupMergedBase::SynapseGroupMergedBase(size_t index, const std::string &
         addHeterogeneousParams<SynapseGroupMergedBase>(
             getArchetype().getTrgNeuronGroup()->getNeuronModel()->getParamNames(), "Post",
             [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getParams(); },
-            &SynapseGroupMergedBase::isTrgNeuronParamHeterogeneous);
+            &SynapseGroupMergedBase::isTrgNeuronParamHeterogeneous,
+            [](const SynapseGroupInternal &sg, size_t p) { return sg.getTrgNeuronGroup()->isParamDynamic(p); },
+            [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getName(); });
 
         // Add heterogeneous postsynaptic neuron model derived parameters
         addHeterogeneousDerivedParams<SynapseGroupMergedBase>(
@@ -1015,7 +1116,9 @@ SynapseGroupMergedBase::SynapseGroupMergedBase(size_t index, const std::string &
         addHeterogeneousParams<SynapseGroupMergedBase>(
             wum->getParamNames(), "",
             [](const SynapseGroupInternal &sg) { return sg.getWUParams(); },
-            &SynapseGroupMergedBase::isWUParamHeterogeneous);
+            &SynapseGroupMergedBase::isWUParamHeterogeneous,
+            [](const SynapseGroupInternal &sg, size_t p) { return sg.isWUParamDynamic(p); },
+            [](const SynapseGroupInternal &sg) { return sg.getName(); });
 
         // Add heterogeneous weight update model derived parameters
         addHeterogeneousDerivedParams<SynapseGroupMergedBase>(
@@ -1050,12 +1153,20 @@ SynapseGroupMergedBase::SynapseGroupMergedBase(size_t index, const std::string &
         {
             addWeightSharingPointerField("unsigned int", "colLength", backend.getDeviceVarPrefix() + "colLength");
             addWeightSharingPointerField("unsigned int", "remap", backend.getDeviceVarPrefix() + "remap");
+            if(backend.isPostsynapticRemapPreIndRequired()) {
+                addWeightSharingPointerField("unsigned int", "remapPreInd", backend.getDeviceVarPrefix() + "remapPreInd");
+            }
         }
     }
     else if(getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
         addWeightSharingPointerField("uint32_t", "gp", backend.getDeviceVarPrefix() + "gp");
     }
 
+    // If synapse dynamics are lazily evaluated, add times each synapse was last brought up to date
+    if(backend.isLazySynapseDynamicsSupported() && getArchetype().isLazySynapseDynamicsRequired() && role != Role::ConnectivityInit) {
+        addPointerField(timePrecision, "lazyT", backend.getDeviceVarPrefix() + "lazyT");
+    }
+
     // If we're updating a group with procedural connectivity or initialising connectivity
     if((getArchetype().getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL) || (role == Role::ConnectivityInit)) {
         // Add heterogeneous sparse connectivity initialiser model parameters
@@ -1150,9 +1261,22 @@ SynapseGroupMergedBase::SynapseGroupMergedBase(size_t index, const std::string &
 
         // Loop through variables
         for(size_t v = 0; v < vars.size(); v++) {
+            // If individual variable has been eliminated or folded into code
+            const auto var = vars[v];
+            if(individualWeights && !getArchetype().isWUVarArrayRequired(v)) {
+                // If we're updating and folded value should be implemented heterogeneously, add value
+                if(updateRole && isWUConstantVarHeterogeneous(v)) {
+                    addScalarField(var.name,
+                                   [v](const SynapseGroupInternal &sg, size_t)
+                                   {
+                                       return Utils::writePreciseString(sg.getWUVarInitialisers().at(v).getParams().at(0));
+                                   });
+                }
+                continue;
+            }
+
             // Variable initialisation is required if we're performing connectivity init and var init snippet requires a kernel or
             // We're performing some other sort of initialisation, the snippet DOESN'T require a kernel but has SOME code
-            const auto var = vars[v];
             const auto *snippet = varInit.at(v).getSnippet();
             const bool varInitRequired = ((connectInitRole && snippet->requiresKernel()) 
                                           || (varInitRole && individualWeights && !snippet->requiresKernel() && !snippet->getCode().empty())
@@ -1209,13 +1333,13 @@ boost::uuids::detail::sha1::digest_type SynapseGroupMergedBase::getHashDigest(Ro
     
     if(updateRole) {
         // Update hash with weight update model parameters and derived parameters
-        updateHash([](const SynapseGroupInternal &g) { return g.getWUParams(); }, hash);
+        updateHash([](const SynapseGroupInternal &g) { return g.getHashableWUParams(); }, hash);
         updateHash([](const SynapseGroupInternal &g) { return g.getWUDerivedParams(); }, hash);
 
         // Update hash with presynaptic neuron population parameters and derived parameters
         updateParamHash<SynapseGroupMergedBase>(
             &SynapseGroupMergedBase::isSrcNeuronParamReferenced, 
-            [](const SynapseGroupInternal &g) { return g.getSrcNeuronGroup()->getParams(); }, hash);
+            [](const SynapseGroupInternal &g) { return g.getSrcNeuronGroup()->getHashableParams(); }, hash);
         
         updateParamHash<SynapseGroupMergedBase>(
             &SynapseGroupMergedBase::isSrcNeuronDerivedParamReferenced, 
@@ -1224,11 +1348,18 @@ boost::uuids::detail::sha1::digest_type SynapseGroupMergedBase::getHashDigest(Ro
         // Update hash with postsynaptic neuron population parameters and derived parameters
         updateParamHash<SynapseGroupMergedBase>(
             &SynapseGroupMergedBase::isTrgNeuronParamReferenced, 
-            [](const SynapseGroupInternal &g) { return g.getTrgNeuronGroup()->getParams(); }, hash);
+            [](const SynapseGroupInternal &g) { return g.getTrgNeuronGroup()->getHashableParams(); }, hash);
         
         updateParamHash<SynapseGroupMergedBase>(
             &SynapseGroupMergedBase::isTrgNeuronDerivedParamReferenced, 
             [](const SynapseGroupInternal &g) { return g.getTrgNeuronGroup()->getDerivedParams(); }, hash);
+        // Update hash with which pre and postsynaptic neuron population parameters are dynamic
+        for(size_t p = 0; p < getArchetype().getSrcNeuronGroup()->getParams().size(); p++) {
+            Utils::updateHash(getArchetype().getSrcNeuronGroup()->isParamDynamic(p), hash);
+        }
+        for(size_t p = 0; p < getArchetype().getTrgNeuronGroup()->getParams().size(); p++) {
+            Utils::updateHash(getArchetype().getTrgNeuronGroup()->isParamDynamic(p), hash);
+        }
     }
 
 
@@ -1273,6 +1404,15 @@ boost::uuids::detail::sha1::digest_type SynapseGroupMergedBase::getHashDigest(Ro
         const bool individualWeights = (getArchetype().getMatrixType() & SynapseMatrixWeight::INDIVIDUAL);
         const bool kernelWeights = (getArchetype().getMatrixType() & SynapseMatrixWeight::INDIVIDUAL);
 
+        // If we're updating, update hash with the values of any individual variables folded into code
+        if(individualWeights && updateRole) {
+            for(size_t v = 0; v < getArchetype().getWUVarInitialisers().size(); v++) {
+                if(getArchetype().isWUVarConstantFolded(v)) {
+                    updateHash([v](const SynapseGroupInternal &g) { return g.getWUVarInitialisers().at(v).getParams().at(0); }, hash);
+                }
+            }
+        }
+
         // If synapse group has a kernel and we're either updating with procedural  
         // weights or initialising individual weights, update hash with kernel size
         if(!getArchetype().getKernelSize().empty() && 
@@ -49,20 +49,27 @@ void genScalarFill(CodeStream &os, const std::string &fieldName, const std::stri
         }
     }
 }
+//--------------------------------------------------------------------------
+bool isVarInitRNGRequired(const Models::VarInit &varInit)
+{
+    // Initialisation code requires an RNG if it calls any random functions or uses $(rng) directly
+    const std::string code = varInit.getSnippet()->getCode();
+    return (Utils::isRNGRequired(code) || code.find("$(rng)") != std::string::npos);
+}
 //------------------------------------------------------------------------
-template<typename Q, typename P, typename D>
+template<typename Q, typename R, typename P, typename D>
 void genInitNeuronVarCode(CodeStream &os, const BackendBase &backend, const Substitutions &popSubs,
                           const Models::Base::VarVec &vars, const std::vector<Models::VarInit> &varInitialisers, 
                           const std::string &fieldSuffix, const std::string &countMember, 
                           size_t numDelaySlots, const size_t groupIndex, const std::string &ftype, unsigned int batchSize,
-                          Q isVarQueueRequired, P isParamHeterogeneousFn, D isDerivedParamHeterogeneousFn)
+                          Q isVarQueueRequired, R isVarArrayRequired, P isParamHeterogeneousFn, D isDerivedParamHeterogeneousFn)
 {
     const std::string count = "group->" + countMember;
     for (size_t k = 0; k < vars.size(); k++) {
         const auto &varInit = varInitialisers.at(k);
 
-        // If this variable has any initialisation code
-        if (!varInit.getSnippet()->getCode().empty()) {
+        // If this variable is implemented as an array and has any initialisation code
+        if (isVarArrayRequired(k) && !varInit.getSnippet()->getCode().empty()) {
             CodeStream::Scope b(os);
 
             Substitutions varSubs(&popSubs);
@@ -100,7 +107,7 @@ void genInitNeuronVarCode(CodeStream &os, const BackendBase &backend, const Subs
             // Otherwise
             else {
                 backend.genVariableInit(
-                    os, count, "id", varSubs,
+                    os, count, "id", varSubs, isVarInitRNGRequired(varInit),
                     [&vars, &varInit, &fieldSuffix, &ftype, batchSize, groupIndex, k, count, numDelaySlots, isVarQueueRequired]
                     (CodeStream &os, Substitutions &varInitSubs)
                     {
@@ -122,34 +129,36 @@ void genInitNeuronVarCode(CodeStream &os, const BackendBase &backend, const Subs
     }
 }
 //------------------------------------------------------------------------
-template<typename P, typename D>
+template<typename R, typename P, typename D>
 void genInitNeuronVarCode(CodeStream &os, const BackendBase &backend, const Substitutions &popSubs,
                           const Models::Base::VarVec &vars, const std::vector<Models::VarInit> &varInitialisers, 
                           const std::string &fieldSuffix, const std::string &countMember, const size_t groupIndex, 
-                          const std::string &ftype, unsigned int batchSize, P isParamHeterogeneousFn, D isDerivedParamHeterogeneousFn)
+                          const std::string &ftype, unsigned int batchSize, R isVarArrayRequired,
+                          P isParamHeterogeneousFn, D isDerivedParamHeterogeneousFn)
 {
     genInitNeuronVarCode(os, backend, popSubs, vars, varInitialisers, fieldSuffix, countMember, 0, groupIndex, ftype, batchSize,
                          [](size_t){ return false; }, 
+                         isVarArrayRequired,
                          isParamHeterogeneousFn,
                          isDerivedParamHeterogeneousFn);
 }
 //------------------------------------------------------------------------
 // Initialise one row of weight update model variables
-template<typename P, typename D, typename G>
+template<typename R, typename P, typename D, typename G>
 void genInitWUVarCode(CodeStream &os, const Substitutions &popSubs, 
                       const Models::Base::VarVec &vars, const std::vector<Models::VarInit> &varInitialisers, 
                       const std::string &stride, const size_t groupIndex, const std::string &ftype, unsigned int batchSize,
-                      P isParamHeterogeneousFn, D isDerivedParamHeterogeneousFn, G genSynapseVariableRowInitFn)
+                      R isVarArrayRequired, P isParamHeterogeneousFn, D isDerivedParamHeterogeneousFn, G genSynapseVariableRowInitFn)
 {
     for (size_t k = 0; k < vars.size(); k++) {
         const auto &varInit = varInitialisers.at(k);
 
-        // If this variable has any initialisation code and doesn't require a kernel
-        if(!varInit.getSnippet()->getCode().empty() && !varInit.getSnippet()->requiresKernel()) {
+        // If this variable is implemented as an array, has any initialisation code and doesn't require a kernel
+        if(isVarArrayRequired(k) && !varInit.getSnippet()->getCode().empty() && !varInit.getSnippet()->requiresKernel()) {
             CodeStream::Scope b(os);
 
             // Generate target-specific code to initialise variable
-            genSynapseVariableRowInitFn(os, popSubs,
+            genSynapseVariableRowInitFn(os, popSubs, isVarInitRNGRequired(varInit),
                 [&vars, &varInit, &ftype, &stride, batchSize, k, groupIndex, isParamHeterogeneousFn, isDerivedParamHeterogeneousFn]
                 (CodeStream &os, Substitutions &varSubs)
                 {
@@ -338,6 +347,7 @@ void NeuronInitGroupMerged::generateInit(const BackendBase &backend, CodeStream
     genInitNeuronVarCode(os, backend, popSubs, getArchetype().getNeuronModel()->getVars(), getArchetype().getVarInitialisers(), 
                          "", "numNeurons", getArchetype().getNumDelaySlots(), getIndex(), model.getPrecision(), model.getBatchSize(),
                          [this](size_t i){ return getArchetype().isVarQueueRequired(i); },
+                         [this](size_t i){ return getArchetype().isVarArrayRequired(i); },
                          [this](size_t v, size_t p) { return isVarInitParamHeterogeneous(v, p); },
                          [this](size_t v, size_t p) { return isVarInitDerivedParamHeterogeneous(v, p); });
 
@@ -348,7 +358,7 @@ void NeuronInitGroupMerged::generateInit(const BackendBase &backend, CodeStream
         const auto *sg = getSortedArchetypeMergedInSyns().at(i);
 
         // Zero InSyn
-        backend.genVariableInit(os, "group->numNeurons", "id", popSubs,
+        backend.genVariableInit(os, "group->numNeurons", "id", popSubs, false,
             [&model, i] (CodeStream &os, Substitutions &varSubs)
             {
                 genVariableFill(os, "inSynInSyn" + std::to_string(i), model.scalarExpr(0.0), 
@@ -359,7 +369,7 @@ void NeuronInitGroupMerged::generateInit(const BackendBase &backend, CodeStream
         // If dendritic delays are required
         if(sg->isDendriticDelayRequired()) {
             // Zero dendritic delay buffer
-            backend.genVariableInit(os, "group->numNeurons", "id", popSubs,
+            backend.genVariableInit(os, "group->numNeurons", "id", popSubs, false,
                 [&model, sg, i](CodeStream &os, Substitutions &varSubs)
                 {
                     genVariableFill(os, "denDelayInSyn" + std::to_string(i), model.scalarExpr(0.0),
@@ -379,6 +389,7 @@ void NeuronInitGroupMerged::generateInit(const BackendBase &backend, CodeStream
         if(sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) {
             genInitNeuronVarCode(os, backend, popSubs, sg->getPSModel()->getVars(), sg->getPSVarInitialisers(),
                                  "InSyn" + std::to_string(i), "numNeurons", i, model.getPrecision(),  model.getBatchSize(),
+                                 [sg](size_t v) { return sg->isPSVarArrayRequired(v); },
                                  [i, this](size_t v, size_t p) { return isPSMVarInitParamHeterogeneous(i, v, p); },
                                  [i, this](size_t v, size_t p) { return isPSMVarInitDerivedParamHeterogeneous(i, v, p); });
         }
@@ -392,6 +403,7 @@ void NeuronInitGroupMerged::generateInit(const BackendBase &backend, CodeStream
                              "WUPost" + std::to_string(i), "numNeurons", sg->getTrgNeuronGroup()->getNumDelaySlots(),
                              i, model.getPrecision(),  model.getBatchSize(),
                              [&sg](size_t){ return (sg->getBackPropDelaySteps() != NO_DELAY); },
+                             [](size_t){ return true; },
                              [i, this](size_t v, size_t p) { return isInSynWUMVarInitParamHeterogeneous(i, v, p); },
                              [i, this](size_t v, size_t p) { return isInSynWUMVarInitDerivedParamHeterogeneous(i, v, p); });
     }
@@ -404,6 +416,7 @@ void NeuronInitGroupMerged::generateInit(const BackendBase &backend, CodeStream
                              "WUPre" + std::to_string(i), "numNeurons", sg->getSrcNeuronGroup()->getNumDelaySlots(),
                              i, model.getPrecision(),  model.getBatchSize(),
                              [&sg](size_t){ return (sg->getDelaySteps() != NO_DELAY); },
+                             [](size_t){ return true; },
                              [i, this](size_t v, size_t p) { return isOutSynWUMVarInitParamHeterogeneous(i, v, p); },
                              [i, this](size_t v, size_t p) { return isOutSynWUMVarInitDerivedParamHeterogeneous(i, v, p); });
     }
@@ -411,7 +424,7 @@ void NeuronInitGroupMerged::generateInit(const BackendBase &backend, CodeStream
     // Loop through outgoing synaptic populations with presynaptic output
     for(size_t i = 0; i < getSortedArchetypeMergedPreOutputOutSyns().size(); i++) {
         // Zero revInSynOutSyn
-        backend.genVariableInit(os, "group->numNeurons", "id", popSubs,
+        backend.genVariableInit(os, "group->numNeurons", "id", popSubs, false,
                                 [&model, i] (CodeStream &os, Substitutions &varSubs)
                                 {
                                     genVariableFill(os, "revInSynOutSyn" + std::to_string(i), model.scalarExpr(0.0),
@@ -426,6 +439,7 @@ void NeuronInitGroupMerged::generateInit(const BackendBase &backend, CodeStream
 
         genInitNeuronVarCode(os, backend, popSubs, cs->getCurrentSourceModel()->getVars(), cs->getVarInitialisers(),
                              "CS" + std::to_string(i), "numNeurons", i, model.getPrecision(),  model.getBatchSize(),
+                             [cs](size_t v) { return cs->isVarArrayRequired(v); },
                              [i, this](size_t v, size_t p) { return isCurrentSourceVarInitParamHeterogeneous(i, v, p); },
                              [i, this](size_t v, size_t p) { return isCurrentSourceVarInitDerivedParamHeterogeneous(i, v, p); });
     }
@@ -536,7 +550,7 @@ void NeuronInitGroupMerged::genInitSpikes(CodeStream &os, const BackendBase &bac
     const bool initRequired = spikeEvent ? getArchetype().isSpikeEventRequired() : true;
     if(initRequired) {
         // Generate variable initialisation code
-        backend.genVariableInit(os, "group->numNeurons", "id", popSubs,
+        backend.genVariableInit(os, "group->numNeurons", "id", popSubs, false,
             [batchSize, spikeEvent, this] (CodeStream &os, Substitutions &varSubs)
             {
                 // Get variable name
@@ -558,7 +572,7 @@ void NeuronInitGroupMerged::genInitSpikeTime(CodeStream &os, const BackendBase &
                                              const std::string &varName, unsigned int batchSize) const
 {
     // Generate variable initialisation code
-    backend.genVariableInit(os, "group->numNeurons", "id", popSubs,
+    backend.genVariableInit(os, "group->numNeurons", "id", popSubs, false,
         [batchSize, varName, this] (CodeStream &os, Substitutions &varSubs)
         {
             genVariableFill(os, varName, "-TIME_MAX", varSubs["id"], "group->numNeurons", VarAccessDuplication::DUPLICATE, 
@@ -603,15 +617,16 @@ void SynapseInitGroupMerged::generateInit(const BackendBase &backend, CodeStream
     genInitWUVarCode(os, popSubs, getArchetype().getWUModel()->getVars(),
                      getArchetype().getWUVarInitialisers(), stride, getIndex(),
                      modelMerged.getModel().getPrecision(), modelMerged.getModel().getBatchSize(),
+                     [this](size_t v) { return getArchetype().isWUVarArrayRequired(v); },
                      [this](size_t v, size_t p) { return isWUVarInitParamHeterogeneous(v, p); },
                      [this](size_t v, size_t p) { return isWUVarInitDerivedParamHeterogeneous(v, p); },
-                     [&backend, kernel, this](CodeStream &os, const Substitutions &kernelSubs, BackendBase::Handler handler)
+                     [&backend, kernel, this](CodeStream &os, const Substitutions &kernelSubs, bool rngRequired, BackendBase::Handler handler)
                      {
                          if (kernel) {
                              backend.genKernelSynapseVariableInit(os, *this, kernelSubs, handler);
                          }
                          else {
-                             backend.genDenseSynapseVariableRowInit(os, kernelSubs, handler);
+                             backend.genDenseSynapseVariableRowInit(os, kernelSubs, rngRequired, handler);
                          }
                      });
 
@@ -631,9 +646,10 @@ void SynapseSparseInitGroupMerged::generateInit(const BackendBase &backend, Code
     genInitWUVarCode(os, popSubs, getArchetype().getWUModel()->getVars(),
                      getArchetype().getWUVarInitialisers(), "group->numSrcNeurons * group->rowStride", getIndex(),
                      modelMerged.getModel().getPrecision(), modelMerged.getModel().getBatchSize(),
+                     [this](size_t v) { return getArchetype().isWUVarArrayRequired(v); },
                      [this](size_t v, size_t p) { return isWUVarInitParamHeterogeneous(v, p); },
                      [this](size_t v, size_t p) { return isWUVarInitDerivedParamHeterogeneous(v, p); },
-                     [&backend](CodeStream &os, const Substitutions &kernelSubs, BackendBase::Handler handler)
+                     [&backend](CodeStream &os, const Substitutions &kernelSubs, bool, BackendBase::Handler handler)
                      {
                          backend.genSparseSynapseVariableRowInit(os, kernelSubs, handler); 
                      });
@@ -767,6 +783,7 @@ void CustomUpdateInitGroupMerged::generateInit(const BackendBase &backend, CodeS
     // Initialise custom update variables
     genInitNeuronVarCode(os, backend, popSubs, getArchetype().getCustomUpdateModel()->getVars(), getArchetype().getVarInitialisers(),
                         "", "size", getIndex(), modelMerged.getModel().getPrecision(), getArchetype().isBatched() ? modelMerged.getModel().getBatchSize() : 1,
+                        [](size_t){ return true; },
                         [this](size_t v, size_t p) { return isVarInitParamHeterogeneous(v, p); },
                         [this](size_t v, size_t p) { return isVarInitDerivedParamHeterogeneous(v, p); });
 }
@@ -861,15 +878,16 @@ void CustomWUUpdateInitGroupMerged::generateInit(const BackendBase &backend, Cod
     genInitWUVarCode(os, popSubs, getArchetype().getCustomUpdateModel()->getVars(),
                     getArchetype().getVarInitialisers(), stride, getIndex(),
                     modelMerged.getModel().getPrecision(), getArchetype().isBatched() ? modelMerged.getModel().getBatchSize() : 1,
+                    [](size_t){ return true; },
                     [this](size_t v, size_t p) { return isVarInitParamHeterogeneous(v, p); },
                     [this](size_t v, size_t p) { return isVarInitDerivedParamHeterogeneous(v, p); },
-                    [&backend, kernel, this](CodeStream &os, const Substitutions &kernelSubs, BackendBase::Handler handler)
+                    [&backend, kernel, this](CodeStream &os, const Substitutions &kernelSubs, bool rngRequired, BackendBase::Handler handler)
                     {
                         if (kernel) {
                             backend.genKernelCustomUpdateVariableInit(os, *this, kernelSubs, handler);
                         }
                         else {
-                            backend.genDenseSynapseVariableRowInit(os, kernelSubs, handler);
+                            backend.genDenseSynapseVariableRowInit(os, kernelSubs, rngRequired, handler);
                         }
     
                     });
@@ -941,9 +959,10 @@ void CustomWUUpdateSparseInitGroupMerged::generateInit(const BackendBase &backen
     genInitWUVarCode(os, popSubs, getArchetype().getCustomUpdateModel()->getVars(),
                      getArchetype().getVarInitialisers(), "group->numSrcNeurons * group->rowStride", getIndex(),
                      modelMerged.getModel().getPrecision(), getArchetype().isBatched() ? modelMerged.getModel().getBatchSize() : 1,
+                     [](size_t){ return true; },
                      [this](size_t v, size_t p) { return isVarInitParamHeterogeneous(v, p); },
                      [this](size_t v, size_t p) { return isVarInitDerivedParamHeterogeneous(v, p); },
-                     [&backend](CodeStream &os, const Substitutions &kernelSubs, BackendBase::Handler handler)
+                     [&backend](CodeStream &os, const Substitutions &kernelSubs, bool, BackendBase::Handler handler)
                      {
                          return backend.genSparseSynapseVariableRowInit(os, kernelSubs, handler); 
                      });
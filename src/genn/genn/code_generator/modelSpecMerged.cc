@@ -49,7 +49,7 @@ ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model, const BackendBa
 
     LOGD_CODE_GEN << "Merging synapse dynamics update groups:";
     createMergedGroupsHash(model, backend, model.getSynapseGroups(), m_MergedSynapseDynamicsGroups,
-                           [](const SynapseGroupInternal &sg){ return !sg.getWUModel()->getSynapseDynamicsCode().empty(); },
+                           [](const SynapseGroupInternal &sg){ return (!sg.getWUModel()->getSynapseDynamicsCode().empty() || sg.isLazySynapseDynamicsRequired()); },
                            &SynapseGroupInternal::getWUHashDigest);
 
     LOGD_CODE_GEN << "Merging neuron initialization groups:";
@@ -59,11 +59,12 @@ ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model, const BackendBa
                            
     LOGD_CODE_GEN << "Merging synapse initialization groups:";
     createMergedGroupsHash(model, backend, model.getSynapseGroups(), m_MergedSynapseInitGroups,
-                           [](const SynapseGroupInternal &sg)
+                           [&backend](const SynapseGroupInternal &sg)
                            {
                                return (((sg.getMatrixType() & SynapseMatrixConnectivity::DENSE)
                                         || (sg.getMatrixType() & SynapseMatrixWeight::KERNEL))
-                                        && sg.isWUVarInitRequired());
+                                        && (sg.isWUVarInitRequired()
+                                            || (backend.isLazySynapseDynamicsSupported() && sg.isLazySynapseDynamicsRequired())));
                            },
                            &SynapseGroupInternal::getWUInitHashDigest);
 
@@ -93,7 +94,8 @@ ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model, const BackendBa
                            {
                                return ((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) && 
                                        (sg.isWUVarInitRequired()
-                                        || (backend.isPostsynapticRemapRequired() && !sg.getWUModel()->getLearnPostCode().empty())));
+                                        || (backend.isPostsynapticRemapRequired() && !sg.getWUModel()->getLearnPostCode().empty())
+                                        || (backend.isLazySynapseDynamicsSupported() && sg.isLazySynapseDynamicsRequired())));
                            },
                            &SynapseGroupInternal::getWUInitHashDigest);
 
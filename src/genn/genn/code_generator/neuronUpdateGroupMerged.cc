@@ -116,8 +116,9 @@ NeuronUpdateGroupMerged::NeuronUpdateGroupMerged(size_t index, const std::string
 bool NeuronUpdateGroupMerged::isInSynWUMParamHeterogeneous(size_t childIndex, size_t paramIndex) const
 {
     return (isInSynWUMParamReferenced(childIndex, paramIndex) &&
-            isChildParamValueHeterogeneous(childIndex, paramIndex, m_SortedInSynWithPostCode,
-                                          [](const SynapseGroupInternal *s) { return s->getWUParams(); }));
+            (m_SortedInSynWithPostCode.front().at(childIndex)->isWUParamDynamic(paramIndex)
+             || isChildParamValueHeterogeneous(childIndex, paramIndex, m_SortedInSynWithPostCode,
+                                               [](const SynapseGroupInternal *s) { return s->getWUParams(); })));
 }
 //----------------------------------------------------------------------------
 bool NeuronUpdateGroupMerged::isInSynWUMDerivedParamHeterogeneous(size_t childIndex, size_t paramIndex) const
@@ -130,8 +131,9 @@ bool NeuronUpdateGroupMerged::isInSynWUMDerivedParamHeterogeneous(size_t childIn
 bool NeuronUpdateGroupMerged::isOutSynWUMParamHeterogeneous(size_t childIndex, size_t paramIndex) const
 {
     return (isOutSynWUMParamReferenced(childIndex, paramIndex) &&
-            isChildParamValueHeterogeneous(childIndex, paramIndex, m_SortedOutSynWithPreCode,
-                                          [](const SynapseGroupInternal *s) { return s->getWUParams(); }));
+            (m_SortedOutSynWithPreCode.front().at(childIndex)->isWUParamDynamic(paramIndex)
+             || isChildParamValueHeterogeneous(childIndex, paramIndex, m_SortedOutSynWithPreCode,
+                                               [](const SynapseGroupInternal *s) { return s->getWUParams(); })));
 }
 //----------------------------------------------------------------------------
 bool NeuronUpdateGroupMerged::isOutSynWUMDerivedParamHeterogeneous(size_t childIndex, size_t paramIndex) const
@@ -152,13 +154,21 @@ boost::uuids::detail::sha1::digest_type NeuronUpdateGroupMerged::getHashDigest()
     Utils::updateHash(getArchetype().getHashDigest(), hash);
 
     // Update hash with each group's parameters and derived parameters
-    updateHash([](const NeuronGroupInternal &g) { return g.getParams(); }, hash);
+    updateHash([](const NeuronGroupInternal &g) { return g.getHashableParams(); }, hash);
     updateHash([](const NeuronGroupInternal &g) { return g.getDerivedParams(); }, hash);
+
+    // Update hash with the values of any variables folded into code
+    const auto vars = getArchetype().getNeuronModel()->getVars();
+    for(size_t v = 0; v < vars.size(); v++) {
+        if(getArchetype().isVarConstantFolded(v)) {
+            updateHash([v](const NeuronGroupInternal &g) { return g.getVarInitialisers().at(v).getParams().at(0); }, hash);
+        }
+    }
         
     // Loop through child incoming synapse groups with postsynaptic update code
     for(size_t i = 0; i < getSortedArchetypeInSynWithPostCode().size(); i++) {
         updateChildParamHash<NeuronUpdateGroupMerged>(m_SortedInSynWithPostCode, i, &NeuronUpdateGroupMerged::isInSynWUMParamReferenced, 
-                                                      &SynapseGroupInternal::getWUParams, hash);
+                                                      &SynapseGroupInternal::getHashableWUParams, hash);
         updateChildDerivedParamHash<NeuronUpdateGroupMerged>(m_SortedInSynWithPostCode, i, &NeuronUpdateGroupMerged::isInSynWUMDerivedParamReferenced, 
                                                              &SynapseGroupInternal::getWUDerivedParams, hash);
     }
@@ -166,7 +176,7 @@ boost::uuids::detail::sha1::digest_type NeuronUpdateGroupMerged::getHashDigest()
     // Loop through child outgoing synapse groups with presynaptic update code
     for(size_t i = 0; i < getSortedArchetypeOutSynWithPreCode().size(); i++) {
         updateChildParamHash<NeuronUpdateGroupMerged>(m_SortedOutSynWithPreCode, i, &NeuronUpdateGroupMerged::isOutSynWUMParamReferenced, 
-                                                      &SynapseGroupInternal::getWUParams, hash);
+                                                      &SynapseGroupInternal::getHashableWUParams, hash);
         updateChildDerivedParamHash<NeuronUpdateGroupMerged>( m_SortedOutSynWithPreCode, i, &NeuronUpdateGroupMerged::isOutSynWUMDerivedParamReferenced, 
                                                              &SynapseGroupInternal::getWUDerivedParams, hash);
     }
@@ -183,7 +193,14 @@ void NeuronUpdateGroupMerged::generateNeuronUpdate(const BackendBase &backend, C
     const NeuronModels::Base *nm = getArchetype().getNeuronModel();
 
     // Generate code to copy neuron state into local variable
-    for(const auto &v : nm->getVars()) {
+    const auto vars = nm->getVars();
+    for(size_t i = 0; i < vars.size(); i++) {
+        // Skip variables which have been eliminated or folded into code
+        const auto &v = vars[i];
+        if(!getArchetype().isVarArrayRequired(i)) {
+            continue;
+        }
+
         if(v.access & VarAccessMode::READ_ONLY) {
             os << "const ";
         }
@@ -278,14 +295,21 @@ void NeuronUpdateGroupMerged::generateNeuronUpdate(const BackendBase &backend, C
         }
 
         // If synapse group has individual postsynaptic variables, also pull these in a coalesced access
+        const auto psmVars = psm->getVars();
         if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) {
             // **TODO** base behaviour from Models::Base
-            for (const auto &v : psm->getVars()) {
-                if(v.access & VarAccessMode::READ_ONLY) {
+            for (size_t v = 0; v < psmVars.size(); v++) {
+                // Skip variables which have been eliminated or folded into code
+                const auto &var = psmVars[v];
+                if(!sg->isPSVarArrayRequired(v)) {
+                    continue;
+                }
+
+                if(var.access & VarAccessMode::READ_ONLY) {
                     os << "const ";
                 }
-                os << v.type << " lps" << v.name << " = group->" << v.name << "InSyn" << i << "[";
-                os << getVarIndex(batchSize, getVarAccessDuplication(v.access), neuronSubs["id"]) << "];" << std::endl;
+                os << var.type << " lps" << var.name << " = group->" << var.name << "InSyn" << i << "[";
+                os << getVarIndex(batchSize, getVarAccessDuplication(var.access), neuronSubs["id"]) << "];" << std::endl;
             }
         }
 
@@ -296,7 +320,22 @@ void NeuronUpdateGroupMerged::generateNeuronUpdate(const BackendBase &backend, C
         inSynSubs.addVarSubstitution("Isyn", sg->getPSTargetVar(), true);
 
         if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) {
-            inSynSubs.addVarNameSubstitution(psm->getVars(), "", "lps");
+            for(size_t v = 0; v < psmVars.size(); v++) {
+                // If variable has been folded into code, substitute its (potentially heterogeneous) constant value
+                if(sg->isPSVarConstantFolded(v)) {
+                    if(isPSMConstantVarHeterogeneous(i, v)) {
+                        inSynSubs.addVarSubstitution(psmVars[v].name, "group->" + psmVars[v].name + "InSyn" + std::to_string(i));
+                    }
+                    else {
+                        const double value = sg->getPSVarInitialisers().at(v).getParams().at(0);
+                        inSynSubs.addVarSubstitution(psmVars[v].name, "(" + Utils::writePreciseString(value) + ")");
+                    }
+                }
+                // Otherwise, if it's implemented as an array, substitute local copy
+                else if(sg->isPSVarArrayRequired(v)) {
+                    inSynSubs.addVarSubstitution(psmVars[v].name, "lps" + psmVars[v].name);
+                }
+            }
         }
         else {
             inSynSubs.addVarValueSubstitution(psm->getVars(), sg->getPSConstInitVals(),
@@ -343,10 +382,11 @@ void NeuronUpdateGroupMerged::generateNeuronUpdate(const BackendBase &backend, C
         os << getVarIndex(batchSize, VarAccessDuplication::DUPLICATE, inSynSubs["id"]) << "] = linSyn;" << std::endl;
 
         // Copy any non-readonly postsynaptic model variables back to global state variables dd_V etc
-        for (const auto &v : psm->getVars()) {
-            if(v.access & VarAccessMode::READ_WRITE) {
-                os << "group->" << v.name << "InSyn" << i << "[";
-                os << getVarIndex(batchSize, getVarAccessDuplication(v.access), inSynSubs["id"]) << "]" << " = lps" << v.name << ";" << std::endl;
+        for (size_t v = 0; v < psmVars.size(); v++) {
+            const auto &var = psmVars[v];
+            if(sg->isPSVarArrayRequired(v) && (var.access & VarAccessMode::READ_WRITE)) {
+                os << "group->" << var.name << "InSyn" << i << "[";
+                os << getVarIndex(batchSize, getVarAccessDuplication(var.access), inSynSubs["id"]) << "]" << " = lps" << var.name << ";" << std::endl;
             }
         }
     }
@@ -373,17 +413,39 @@ void NeuronUpdateGroupMerged::generateNeuronUpdate(const BackendBase &backend, C
         const auto *csm = cs->getCurrentSourceModel();
 
         // Read current source variables into registers
-        for(const auto &v : csm->getVars()) {
-            if(v.access & VarAccessMode::READ_ONLY) {
+        const auto csVars = csm->getVars();
+        for(size_t v = 0; v < csVars.size(); v++) {
+            // Skip variables which have been eliminated or folded into code
+            const auto &var = csVars[v];
+            if(!cs->isVarArrayRequired(v)) {
+                continue;
+            }
+
+            if(var.access & VarAccessMode::READ_ONLY) {
                 os << "const ";
             }
-            os << v.type << " lcs" << v.name << " = " << "group->" << v.name << "CS" << i << "[";
-            os << getVarIndex(batchSize, getVarAccessDuplication(v.access), popSubs["id"]) << "];" << std::endl;
+            os << var.type << " lcs" << var.name << " = " << "group->" << var.name << "CS" << i << "[";
+            os << getVarIndex(batchSize, getVarAccessDuplication(var.access), popSubs["id"]) << "];" << std::endl;
         }
 
         Substitutions currSourceSubs(&popSubs);
         currSourceSubs.addFuncSubstitution("injectCurrent", 1, "Isyn += $(0)");
-        currSourceSubs.addVarNameSubstitution(csm->getVars(), "", "lcs");
+        for(size_t v = 0; v < csVars.size(); v++) {
+            // If variable has been folded into code, substitute its (potentially heterogeneous) constant value
+            if(cs->isVarConstantFolded(v)) {
+                if(isCurrentSourceConstantVarHeterogeneous(i, v)) {
+                    currSourceSubs.addVarSubstitution(csVars[v].name, "group->" + csVars[v].name + "CS" + std::to_string(i));
+                }
+                else {
+                    const double value = cs->getVarInitialisers().at(v).getParams().at(0);
+                    currSourceSubs.addVarSubstitution(csVars[v].name, "(" + Utils::writePreciseString(value) + ")");
+                }
+            }
+            // Otherwise, if it's implemented as an array, substitute local copy
+            else if(cs->isVarArrayRequired(v)) {
+                currSourceSubs.addVarSubstitution(csVars[v].name, "lcs" + csVars[v].name);
+            }
+        }
         currSourceSubs.addParamValueSubstitution(csm->getParamNames(), cs->getParams(),
                                                     [i, this](size_t p) { return isCurrentSourceParamHeterogeneous(i, p);  },
                                                     "", "group->", "CS" + std::to_string(i));
@@ -398,10 +460,11 @@ void NeuronUpdateGroupMerged::generateNeuronUpdate(const BackendBase &backend, C
         os << iCode << std::endl;
 
         // Write read/write variables back to global memory
-        for(const auto &v : csm->getVars()) {
-            if(v.access & VarAccessMode::READ_WRITE) {
-                os << "group->" << v.name << "CS" << i << "[";
-                os << getVarIndex(batchSize, getVarAccessDuplication(v.access), currSourceSubs["id"]) << "] = lcs" << v.name << ";" << std::endl;
+        for(size_t v = 0; v < csVars.size(); v++) {
+            const auto &var = csVars[v];
+            if(cs->isVarArrayRequired(v) && (var.access & VarAccessMode::READ_WRITE)) {
+                os << "group->" << var.name << "CS" << i << "[";
+                os << getVarIndex(batchSize, getVarAccessDuplication(var.access), currSourceSubs["id"]) << "] = lcs" << var.name << ";" << std::endl;
             }
         }
     }
@@ -629,12 +692,13 @@ void NeuronUpdateGroupMerged::generateNeuronUpdate(const BackendBase &backend, C
     }
 
     // Loop through neuron state variables
-    for(const auto &v : nm->getVars()) {
+    for(size_t i = 0; i < vars.size(); i++) {
         // If state variables is read/writes - meaning that it may have been updated - or it is delayed -
         // meaning that it needs to be copied into next delay slot whatever - copy neuron state variables
         // back to global state variables dd_V etc  
+        const auto &v = vars[i];
         const bool delayed = (getArchetype().isVarQueueRequired(v.name) && getArchetype().isDelayRequired());
-        if((v.access & VarAccessMode::READ_WRITE) || delayed) {
+        if(getArchetype().isVarArrayRequired(i) && ((v.access & VarAccessMode::READ_WRITE) || delayed)) {
             os << "group->" << v.name << "[";
             os << getWriteVarIndex(delayed, batchSize, getVarAccessDuplication(v.access), popSubs["id"]) << "] = l" << v.name << ";" << std::endl;
         }
@@ -738,7 +802,8 @@ void NeuronUpdateGroupMerged::generateWUVar(const BackendBase &backend,  const s
 
         // Add any heterogeneous parameters
         addHeterogeneousChildParams<NeuronUpdateGroupMerged>(sg->getWUModel()->getParamNames(), sortedSyn, i, fieldPrefixStem,
-                                                             isParamHeterogeneous, &SynapseGroupInternal::getWUParams);
+                                                             isParamHeterogeneous, &SynapseGroupInternal::getWUParams,
+                                                             &SynapseGroupInternal::isWUParamDynamic);
 
         // Add any heterogeneous derived parameters
         addHeterogeneousChildDerivedParams<NeuronUpdateGroupMerged>(sg->getWUModel()->getDerivedParams(), sortedSyn, i, fieldPrefixStem,
@@ -784,7 +849,23 @@ bool NeuronUpdateGroupMerged::isOutSynWUMDerivedParamReferenced(size_t childInde
 void NeuronUpdateGroupMerged::addNeuronModelSubstitutions(Substitutions &substitution, const std::string &sourceSuffix, const std::string &destSuffix) const
 {
     const NeuronModels::Base *nm = getArchetype().getNeuronModel();
-    substitution.addVarNameSubstitution(nm->getVars(), sourceSuffix, "l", destSuffix);
+    const auto vars = nm->getVars();
+    for(size_t i = 0; i < vars.size(); i++) {
+        // If variable has been folded into code, substitute its (potentially heterogeneous) constant value
+        if(getArchetype().isVarConstantFolded(i)) {
+            if(isConstantVarHeterogeneous(i)) {
+                substitution.addVarSubstitution(vars[i].name + sourceSuffix, "group->" + vars[i].name);
+            }
+            else {
+                const double value = getArchetype().getVarInitialisers().at(i).getParams().at(0);
+                substitution.addVarSubstitution(vars[i].name + sourceSuffix, "(" + Utils::writePreciseString(value) + ")");
+            }
+        }
+        // Otherwise, if it's implemented as an array, substitute local copy
+        else if(getArchetype().isVarArrayRequired(i)) {
+            substitution.addVarSubstitution(vars[i].name + sourceSuffix, "l" + vars[i].name + destSuffix);
+        }
+    }
     substitution.addParamValueSubstitution(nm->getParamNames(), getArchetype().getParams(), 
                                            [this](size_t i) { return isParamHeterogeneous(i);  },
                                            sourceSuffix, "group->");
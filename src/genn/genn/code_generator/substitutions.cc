@@ -43,25 +43,14 @@ void CodeGenerator::Substitutions::addFuncSubstitution(const std::string &source
 //--------------------------------------------------------------------------
 bool CodeGenerator::Substitutions::hasVarSubstitution(const std::string &source) const
 {
-    if (m_VarSubstitutions.find(source) != m_VarSubstitutions.end()) {
-        return true;
-    }
-    else if (m_Parent) {
-        return m_Parent->hasVarSubstitution(source);
-    }
-    else {
-        return false;
-    }
+    return (findVarSubstitution(source) != nullptr);
 }
 //--------------------------------------------------------------------------
 const std::string &CodeGenerator::Substitutions::getVarSubstitution(const std::string &source) const
 {
-    auto var = m_VarSubstitutions.find(source);
-    if(var != m_VarSubstitutions.end()) {
-        return var->second;
-    }
-    else if(m_Parent) {
-        return m_Parent->getVarSubstitution(source);
+    const std::string *var = findVarSubstitution(source);
+    if(var) {
+        return *var;
     }
     else {
         throw std::runtime_error("Nothing to substitute for '" + source + "'");
@@ -70,10 +59,11 @@ const std::string &CodeGenerator::Substitutions::getVarSubstitution(const std::s
 //--------------------------------------------------------------------------
 void CodeGenerator::Substitutions::apply(std::string &code) const
 {
-    // Apply function and variable substitutions
-    // **NOTE** functions may contain variables so evaluate ALL functions first
-    applyFuncs(code);
-    applyVars(code);
+    // Resolve all function and variable references in a single pass
+    std::string output;
+    output.reserve(code.size());
+    applyToOutput(code, output, 0);
+    code = output;
 }
 //--------------------------------------------------------------------------
 void CodeGenerator::Substitutions::applyCheckUnreplaced(std::string &code, const std::string &context) const
@@ -82,29 +72,158 @@ void CodeGenerator::Substitutions::applyCheckUnreplaced(std::string &code, const
     checkUnreplacedVariables(code, context);
 }
 //--------------------------------------------------------------------------
-void CodeGenerator::Substitutions::applyFuncs(std::string &code) const
+const std::pair<unsigned int, std::string> *CodeGenerator::Substitutions::findFuncSubstitution(const std::string &source, bool hasArguments) const
 {
-    // Apply function substitutions
-    for(const auto &f : m_FuncSubstitutions) {
-        functionSubstitute(code, f.first, f.second.first, f.second.second);
+    // **NOTE** functions with and without arguments are referenced
+    // differently so ignore ones which don't match reference
+    auto func = m_FuncSubstitutions.find(source);
+    if(func != m_FuncSubstitutions.end() && ((func->second.first > 0) == hasArguments)) {
+        return &func->second;
     }
-
-    // If we have a parent, apply their function substitutions too
-    if(m_Parent) {
-        m_Parent->applyFuncs(code);
+    else if(m_Parent) {
+        return m_Parent->findFuncSubstitution(source, hasArguments);
+    }
+    else {
+        return nullptr;
+    }
+}
+//--------------------------------------------------------------------------
+const std::string *CodeGenerator::Substitutions::findVarSubstitution(const std::string &source, const Substitutions **scope) const
+{
+    auto var = m_VarSubstitutions.find(source);
+    if(var != m_VarSubstitutions.end()) {
+        if(scope) {
+            *scope = this;
+        }
+        return &var->second;
+    }
+    else if(m_Parent) {
+        return m_Parent->findVarSubstitution(source, scope);
+    }
+    else {
+        return nullptr;
     }
 }
 //--------------------------------------------------------------------------
-void CodeGenerator::Substitutions::applyVars(std::string &code) const
+void CodeGenerator::Substitutions::applyToOutput(const std::string &code, std::string &output, unsigned int depth) const
 {
-    // Apply variable substitutions
-    for(const auto &v : m_VarSubstitutions) {
-        LOGD_CODE_GEN << "Substituting '$(" << v.first << ")' for '" << v.second << "'";
-        substitute(code, "$(" + v.first + ")", v.second);
+    // Substitutions which reference themselves (directly or indirectly) would never terminate
+    if(depth > 100) {
+        throw std::runtime_error("Recursive substitution found in '" + code + "'");
     }
 
-    // If we have a parent, apply their variable substitutions too
-    if(m_Parent) {
-        m_Parent->applyVars(code);
+    size_t copied = 0;
+    for(size_t found = code.find("$("); found != std::string::npos; found = code.find("$(", copied)) {
+        // Copy code up to reference
+        output.append(code, copied, found - copied);
+
+        // Find end of name being referenced and, if it isn't
+        // followed by an argument list or closing bracket, skip
+        const size_t nameStart = found + 2;
+        const size_t nameEnd = code.find_first_of("$(),", nameStart);
+        if(nameEnd == std::string::npos || (code[nameEnd] != ')' && code[nameEnd] != ',')) {
+            output.append("$(");
+            copied = nameStart;
+            continue;
+        }
+        const std::string name = code.substr(nameStart, nameEnd - nameStart);
+
+        // If reference is a variable or function without arguments
+        // **NOTE** functions may share names with variables and take precedence
+        // **NOTE** references within variable substitutions are resolved from the substitutions
+        // they were added to whereas those within functions are resolved from this scope
+        std::string replacement;
+        const Substitutions *scope = this;
+        size_t end;
+        if(code[nameEnd] == ')') {
+            const auto *func = findFuncSubstitution(name, false);
+            const std::string *var = func ? nullptr : findVarSubstitution(name, &scope);
+            if(func) {
+                replacement = func->second;
+            }
+            else if(var) {
+                LOGD_CODE_GEN << "Substituting '$(" << name << ")' for '" << *var << "'";
+                replacement = *var;
+            }
+            else {
+                output.append("$(");
+                copied = nameStart;
+                continue;
+            }
+            end = nameEnd + 1;
+        }
+        // Otherwise, if it's a call to a function with arguments
+        else {
+            const auto *func = findFuncSubstitution(name, true);
+            if(!func) {
+                output.append("$(");
+                copied = nameStart;
+                continue;
+            }
+
+            // Loop through subsequent characters of code, splitting arguments on commas at function bracket depth
+            std::vector<std::string> params;
+            std::string currentParam;
+            unsigned int bracketDepth = 0;
+            for(end = nameEnd + 1; end < code.size(); end++) {
+                const char c = code[end];
+                if(c == ',' && bracketDepth == 0) {
+                    params.push_back(currentParam);
+                    currentParam.clear();
+                    continue;
+                }
+                else if(c == '(') {
+                    bracketDepth++;
+                }
+                else if(c == ')') {
+                    if(bracketDepth == 0) {
+                        params.push_back(currentParam);
+                        break;
+                    }
+                    bracketDepth--;
+                }
+
+                // If this isn't a space at function bracket depth, add to parameter string
+                if(bracketDepth > 0 || !::isspace(c)) {
+                    currentParam += c;
+                }
+            }
+
+            if(end == code.size()) {
+                throw std::runtime_error("Unterminated call to function '" + name + "' in '" + code + "'");
+            }
+            if(params.size() != func->first) {
+                throw std::runtime_error("Function '" + name + "' called with " + std::to_string(params.size())
+                                         + " arguments but it takes " + std::to_string(func->first));
+            }
+            end++;
+
+            // Substitute parsed parameters into function template
+            const std::string &funcTemplate = func->second;
+            size_t templateCopied = 0;
+            for(size_t p = funcTemplate.find("$("); p != std::string::npos; p = funcTemplate.find("$(", p + 2)) {
+                const size_t paramEnd = funcTemplate.find(')', p + 2);
+                if(paramEnd == std::string::npos) {
+                    break;
+                }
+
+                const std::string paramIndex = funcTemplate.substr(p + 2, paramEnd - p - 2);
+                if(!paramIndex.empty() && paramIndex.find_first_not_of("0123456789") == std::string::npos
+                   && std::stoul(paramIndex) < params.size())
+                {
+                    replacement.append(funcTemplate, templateCopied, p - templateCopied);
+                    replacement.append(params[std::stoul(paramIndex)]);
+                    templateCopied = paramEnd + 1;
+                }
+            }
+            replacement.append(funcTemplate, templateCopied, std::string::npos);
+        }
+
+        // Resolve any references within replacement and continue after reference
+        scope->applyToOutput(replacement, output, depth + 1);
+        copied = end;
     }
-}
\ No newline at end of file
+
+    // Copy remaining code
+    output.append(code, copied, std::string::npos);
+}
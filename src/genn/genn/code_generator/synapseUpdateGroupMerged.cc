@@ -59,11 +59,24 @@ void applySynapseSubstitutions(CodeStream &os, std::string code, const std::stri
 
     // If weights are individual, substitute variables for values stored in global memory
     if (sg.getArchetype().getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-        synapseSubs.addVarNameSubstitution(wu->getVars(), "", "group->",
-                                           [&sg, &synapseSubs, batchSize](VarAccess a) 
-                                           { 
-                                               return "[" + sg.getSynVarIndex(batchSize, getVarAccessDuplication(a), synapseSubs["id_syn"]) + "]";
-                                           });
+        const auto vars = wu->getVars();
+        for(size_t k = 0; k < vars.size(); k++) {
+            // If variable has been folded into code, substitute its (potentially heterogeneous) constant value
+            if(sg.getArchetype().isWUVarConstantFolded(k)) {
+                if(sg.isWUConstantVarHeterogeneous(k)) {
+                    synapseSubs.addVarSubstitution(vars[k].name, "group->" + vars[k].name);
+                }
+                else {
+                    const double value = sg.getArchetype().getWUVarInitialisers().at(k).getParams().at(0);
+                    synapseSubs.addVarSubstitution(vars[k].name, "(" + Utils::writePreciseString(value) + ")");
+                }
+            }
+            // Otherwise, if it's implemented as an array, substitute variable stored in global memory
+            else if(sg.getArchetype().isWUVarArrayRequired(k)) {
+                synapseSubs.addVarSubstitution(vars[k].name, 
+                                               "group->" + vars[k].name + "[" + sg.getSynVarIndex(batchSize, getVarAccessDuplication(vars[k].access), synapseSubs["id_syn"]) + "]");
+            }
+        }
     }
     // Otherwise, if weights are procedual
     else if (sg.getArchetype().getMatrixType() & SynapseMatrixWeight::PROCEDURAL) {
@@ -170,6 +183,38 @@ void applySynapseSubstitutions(CodeStream &os, std::string code, const std::stri
     code = ensureFtype(code, model.getPrecision());
     os << code;
 }
+//----------------------------------------------------------------------------
+void applyLazySynapseDynamics(CodeStream &os, const std::string &targetTime, const SynapseGroupMergedBase &sg, 
+                              const Substitutions &baseSubs, const ModelSpecMerged &modelMerged, const BackendBase &backend)
+{
+    // If synapse dynamics aren't lazily evaluated, there's nothing to do
+    if(!backend.isLazySynapseDynamicsSupported() || !sg.getArchetype().isLazySynapseDynamicsRequired()) {
+        return;
+    }
+
+    CodeStream::Scope b(os);
+    const auto *wum = sg.getArchetype().getWUModel();
+    if (!wum->getSynapseDynamicsSuppportCode().empty() && backend.supportsNamespace()) {
+        os << "using namespace " << modelMerged.getSynapseDynamicsSupportCodeNamespace(wum->getSynapseDynamicsSuppportCode()) <<  ";" << std::endl;
+    }
+
+    // Calculate time elapsed since synapse was last brought up to date
+    // **NOTE** lazyT is duplicated across batches like synaptic state variables
+    const std::string lazyT = "group->lazyT[" + sg.getSynVarIndex(modelMerged.getModel().getBatchSize(), VarAccessDuplication::DUPLICATE, baseSubs["id_syn"]) + "]";
+    os << "const " << modelMerged.getModel().getTimePrecision() << " lazyElapsed = " << targetTime << " - " << lazyT << ";" << std::endl;
+    os << "if(lazyElapsed > 0)";
+    {
+        CodeStream::Scope b(os);
+
+        // Advance synapse state by elapsed time and record when it was brought up to date
+        Substitutions lazySubs(&baseSubs);
+        lazySubs.addVarSubstitution("elapsed", "lazyElapsed");
+        applySynapseSubstitutions(os, wum->getLazySynapseDynamicsCode(), "lazySynapseDynamics",
+                                  sg, lazySubs, modelMerged, backend.supportsNamespace());
+        os << std::endl;
+        os << lazyT << " = " << targetTime << ";" << std::endl;
+    }
+}
 }   // Anonymous namespace
 
 //----------------------------------------------------------------------------
@@ -220,12 +265,18 @@ void PresynapticUpdateGroupMerged::generateSpikeEventThreshold(const BackendBase
 //----------------------------------------------------------------------------
 void PresynapticUpdateGroupMerged::generateSpikeEventUpdate(const BackendBase &backend, CodeStream &os, const ModelSpecMerged &modelMerged, Substitutions &popSubs) const
 {
+    // Bring synapse up to date with dynamics this timestep before it is updated
+    applyLazySynapseDynamics(os, popSubs["t"] + " + DT", *this, popSubs, modelMerged, backend);
+
     applySynapseSubstitutions(os, getArchetype().getWUModel()->getEventCode(), "eventCode",
                               *this, popSubs, modelMerged, backend.supportsNamespace());
 }
 //----------------------------------------------------------------------------
 void PresynapticUpdateGroupMerged::generateSpikeUpdate(const BackendBase &backend, CodeStream &os, const ModelSpecMerged &modelMerged, Substitutions &popSubs) const
 {
+    // Bring synapse up to date with dynamics this timestep before it is updated
+    applyLazySynapseDynamics(os, popSubs["t"] + " + DT", *this, popSubs, modelMerged, backend);
+
     applySynapseSubstitutions(os, getArchetype().getWUModel()->getSimCode(), "simCode",
                               *this, popSubs, modelMerged, backend.supportsNamespace());
 }
@@ -295,6 +346,9 @@ void PostsynapticUpdateGroupMerged::generateSynapseUpdate(const BackendBase &bac
         os << "using namespace " << modelMerged.getPostsynapticUpdateSupportCodeNamespace(wum->getLearnPostSupportCode()) <<  ";" << std::endl;
     }
 
+    // Bring synapse up to date with dynamics this timestep before it is updated
+    applyLazySynapseDynamics(os, popSubs["t"] + " + DT", *this, popSubs, modelMerged, backend);
+
     applySynapseSubstitutions(os, wum->getLearnPostCode(), "learnPostCode",
                               *this, popSubs, modelMerged, backend.supportsNamespace());
 }
@@ -311,6 +365,22 @@ void SynapseDynamicsGroupMerged::generateSynapseUpdate(const BackendBase &backen
         os << "using namespace " << modelMerged.getSynapseDynamicsSupportCodeNamespace(wum->getSynapseDynamicsSuppportCode()) <<  ";" << std::endl;
     }
 
-    applySynapseSubstitutions(os, wum->getSynapseDynamicsCode(), "synapseDynamics",
-                              *this, popSubs, modelMerged, backend.supportsNamespace());
+    // If synapse dynamics are lazy
+    if(getArchetype().isLazySynapseDynamicsRequired()) {
+        // If backend supports it, bring synapse up to date with dynamics at $(t)
+        if(backend.isLazySynapseDynamicsSupported()) {
+            applyLazySynapseDynamics(os, popSubs["t"], *this, popSubs, modelMerged, backend);
+        }
+        // Otherwise, advance synapse by one timestep
+        else {
+            Substitutions lazySubs(&popSubs);
+            lazySubs.addVarSubstitution("elapsed", "DT");
+            applySynapseSubstitutions(os, wum->getLazySynapseDynamicsCode(), "lazySynapseDynamics",
+                                      *this, lazySubs, modelMerged, backend.supportsNamespace());
+        }
+    }
+    else {
+        applySynapseSubstitutions(os, wum->getSynapseDynamicsCode(), "synapseDynamics",
+                                  *this, popSubs, modelMerged, backend.supportsNamespace());
+    }
 }
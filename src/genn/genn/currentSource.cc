@@ -15,6 +15,11 @@ void CurrentSource::setVarLocation(const std::string &varName, VarLocation loc)
     m_VarLocation[getCurrentSourceModel()->getVarIndex(varName)] = loc;
 }
 //----------------------------------------------------------------------------
+void CurrentSource::setVarRetained(const std::string &varName, bool retained)
+{
+    m_VarRetained.at(getCurrentSourceModel()->getVarIndex(varName)) = retained;
+}
+//----------------------------------------------------------------------------
 void CurrentSource::setExtraGlobalParamLocation(const std::string &paramName, VarLocation loc)
 {
     const size_t extraGlobalParamIndex = getCurrentSourceModel()->getExtraGlobalParamIndex(paramName);
@@ -24,11 +29,21 @@ void CurrentSource::setExtraGlobalParamLocation(const std::string &paramName, Va
     m_ExtraGlobalParamLocation[extraGlobalParamIndex] = loc;
 }
 //----------------------------------------------------------------------------
+void CurrentSource::setParamDynamic(const std::string &paramName, bool dynamic)
+{
+    m_DynamicParams.at(getCurrentSourceModel()->getParamIndex(paramName)) = dynamic;
+}
+//----------------------------------------------------------------------------
 VarLocation CurrentSource::getVarLocation(const std::string &varName) const
 {
     return m_VarLocation[getCurrentSourceModel()->getVarIndex(varName)];
 }
 //----------------------------------------------------------------------------
+bool CurrentSource::isVarArrayRequired(const std::string &varName) const
+{
+    return m_VarArrayRequired.at(getCurrentSourceModel()->getVarIndex(varName));
+}
+//----------------------------------------------------------------------------
 VarLocation CurrentSource::getExtraGlobalParamLocation(const std::string &varName) const
 {
     return m_ExtraGlobalParamLocation[getCurrentSourceModel()->getExtraGlobalParamIndex(varName)];
@@ -39,7 +54,8 @@ CurrentSource::CurrentSource(const std::string &name, const CurrentSourceModels:
                              const NeuronGroupInternal *trgNeuronGroup, VarLocation defaultVarLocation,
                              VarLocation defaultExtraGlobalParamLocation)
 :   m_Name(name), m_CurrentSourceModel(currentSourceModel), m_Params(params), m_VarInitialisers(varInitialisers),
-    m_TrgNeuronGroup(trgNeuronGroup), m_VarLocation(varInitialisers.size(), defaultVarLocation),
+    m_TrgNeuronGroup(trgNeuronGroup), m_DynamicParams(params.size(), false), m_VarRetained(varInitialisers.size(), false),
+    m_VarArrayRequired(varInitialisers.size(), true), m_VarConstantFolded(varInitialisers.size(), false), m_VarLocation(varInitialisers.size(), defaultVarLocation),
     m_ExtraGlobalParamLocation(currentSourceModel->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation)
 {
     // Validate names
@@ -59,12 +75,32 @@ void CurrentSource::initDerivedParams(double dt)
         m_DerivedParams.push_back(d.func(getParams(), dt));
     }
 
+    // Check derived parameters don't depend on dynamic parameters
+    Utils::validateDynamicParams(derivedParams, getCurrentSourceModel()->getParamNames(), getParams(), m_DynamicParams,
+                                 dt, "current source '" + getName() + "'");
+
     // Initialise derived parameters for variable initialisers
     for(auto &v : m_VarInitialisers) {
         v.initDerivedParams(dt);
     }
 }
 //----------------------------------------------------------------------------
+void CurrentSource::eliminateVars(const std::set<std::string> &customUpdateVarRefs)
+{
+    // Variables which have been retained or are referenced by a custom update must be implemented as arrays
+    const auto vars = getCurrentSourceModel()->getVars();
+    std::vector<bool> retained(m_VarRetained);
+    for(size_t i = 0; i < vars.size(); i++) {
+        if(customUpdateVarRefs.find(vars[i].name) != customUpdateVarRefs.cend()) {
+            retained[i] = true;
+        }
+    }
+
+    // Eliminate or fold remaining variables based on injection code
+    Models::eliminateVars(vars, getVarInitialisers(), {getCurrentSourceModel()->getInjectionCode()}, retained,
+                          "current source '" + getName() + "'", m_VarArrayRequired, m_VarConstantFolded);
+}
+//----------------------------------------------------------------------------
 bool CurrentSource::isSimRNGRequired() const
 {
     // Returns true if any parts of the current source code require an RNG
@@ -94,13 +130,19 @@ bool CurrentSource::isZeroCopyEnabled() const
 //----------------------------------------------------------------------------
 boost::uuids::detail::sha1::digest_type CurrentSource::getHashDigest() const
 {
-    return getCurrentSourceModel()->getHashDigest();
+    boost::uuids::detail::sha1 hash;
+    Utils::updateHash(getCurrentSourceModel()->getHashDigest(), hash);
+    Utils::updateHash(m_DynamicParams, hash);
+    Utils::updateHash(m_VarArrayRequired, hash);
+    Utils::updateHash(m_VarConstantFolded, hash);
+    return hash.get_digest();
 }
 //----------------------------------------------------------------------------
 boost::uuids::detail::sha1::digest_type CurrentSource::getInitHashDigest() const
 {
     boost::uuids::detail::sha1 hash;
     Utils::updateHash(getCurrentSourceModel()->getVars(), hash);
+    Utils::updateHash(m_VarArrayRequired, hash);
 
     // Include variable initialiser hashes
     for(const auto &w : getVarInitialisers()) {
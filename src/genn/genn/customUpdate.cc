@@ -18,6 +18,11 @@ void CustomUpdateBase::setVarLocation(const std::string &varName, VarLocation lo
     m_VarLocation[getCustomUpdateModel()->getVarIndex(varName)] = loc;
 }
 //----------------------------------------------------------------------------
+void CustomUpdateBase::setParamDynamic(const std::string &paramName, bool dynamic)
+{
+    m_DynamicParams.at(getCustomUpdateModel()->getParamIndex(paramName)) = dynamic;
+}
+//----------------------------------------------------------------------------
 VarLocation CustomUpdateBase::getVarLocation(const std::string &varName) const
 {
     return m_VarLocation[getCustomUpdateModel()->getVarIndex(varName)];
@@ -41,6 +46,10 @@ void CustomUpdateBase::initDerivedParams(double dt)
         m_DerivedParams.push_back(d.func(getParams(), dt));
     }
 
+    // Check derived parameters don't depend on dynamic parameters
+    Utils::validateDynamicParams(derivedParams, getCustomUpdateModel()->getParamNames(), getParams(), m_DynamicParams,
+                                 dt, "custom update '" + getName() + "'");
+
     // Initialise derived parameters for variable initialisers
     for(auto &v : m_VarInitialisers) {
         v.initDerivedParams(dt);
@@ -69,6 +78,7 @@ void CustomUpdateBase::updateHash(boost::uuids::detail::sha1 &hash) const
     Utils::updateHash(getCustomUpdateModel()->getHashDigest(), hash);
     Utils::updateHash(getUpdateGroupName(), hash);
     Utils::updateHash(isBatched(), hash);
+    Utils::updateHash(m_DynamicParams, hash);
 }
 //----------------------------------------------------------------------------
 void CustomUpdateBase::updateInitHash(boost::uuids::detail::sha1 &hash) const
@@ -244,6 +254,18 @@ void CustomUpdateWU::finalize(unsigned int batchSize)
 {
     // Check variable reference types
     checkVarReferenceBatching(m_VarReferences, batchSize);
+
+    // Give error if any variable references (or their transposes) belong to synapse groups with lazy synapse dynamics
+    // **NOTE** custom updates don't bring lazily-evaluated synapses up to date before accessing them
+    if(std::any_of(m_VarReferences.cbegin(), m_VarReferences.cend(),
+                   [](const Models::WUVarReference &v)
+                   {
+                       return (v.getSynapseGroup()->isLazySynapseDynamicsRequired()
+                               || (v.getTransposeSynapseGroup() != nullptr && v.getTransposeSynapseGroup()->isLazySynapseDynamicsRequired()));
+                   }))
+    {
+        throw std::runtime_error("Custom weight update '" + getName() + "' cannot reference variables of synapse groups with lazy synapse dynamics.");
+    }
 }
 //----------------------------------------------------------------------------
 bool CustomUpdateWU::isTransposeOperation() const
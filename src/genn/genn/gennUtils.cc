@@ -2,6 +2,10 @@
 
 // Standard C++ includes
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 // Standard C includes
 #include <cctype>
@@ -145,4 +149,71 @@ void validateParamNames(const std::vector<std::string> &paramNames)
         validateVarName(p, "Parameter");
     }
 }
+//--------------------------------------------------------------------------
+std::vector<double> zeroDynamicParams(const std::vector<double> &params, const std::vector<bool> &dynamicParams)
+{
+    std::vector<double> hashParams(params);
+    for(size_t p = 0; p < hashParams.size(); p++) {
+        if(dynamicParams[p]) {
+            hashParams[p] = 0.0;
+        }
+    }
+    return hashParams;
+}
+//--------------------------------------------------------------------------
+void parallelFor(size_t count, unsigned int numThreads, std::function<void(size_t)> function)
+{
+    // Use one thread per hardware thread by default and never more threads than indices
+    if(numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    numThreads = (unsigned int)std::min<size_t>(numThreads, count);
+
+    // If only one thread is required, call function serially
+    if(numThreads <= 1) {
+        for(size_t i = 0; i < count; i++) {
+            function(i);
+        }
+        return;
+    }
+
+    // Worker which repeatedly takes the next unprocessed index until none remain
+    std::atomic<size_t> nextIndex{0};
+    std::mutex exceptionMutex;
+    std::exception_ptr exception;
+    auto worker =
+        [count, &exception, &exceptionMutex, &function, &nextIndex]()
+        {
+            for(size_t i = nextIndex++; i < count; i = nextIndex++) {
+                try
+                {
+                    function(i);
+                }
+                catch(...) {
+                    // Store first exception and stop other workers taking further indices
+                    std::lock_guard<std::mutex> lock(exceptionMutex);
+                    if(!exception) {
+                        exception = std::current_exception();
+                    }
+                    nextIndex = count;
+                }
+            }
+        };
+
+    // Launch additional threads, process indices on this thread and wait for others to finish
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for(unsigned int t = 1; t < numThreads; t++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for(auto &t : threads) {
+        t.join();
+    }
+
+    // Rethrow any exception on calling thread
+    if(exception) {
+        std::rethrow_exception(exception);
+    }
+}
 }   // namespace utils
@@ -30,6 +30,25 @@
 #include "code_generator/codeGenUtils.h"
 #include "code_generator/substitutions.h"
 
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+template<typename D>
+void updateDynamicParamHash(const std::string &groupName, const std::vector<double> &params, 
+                            D isDynamicFn, boost::uuids::detail::sha1 &hash)
+{
+    for(size_t p = 0; p < params.size(); p++) {
+        if(isDynamicFn(p)) {
+            Utils::updateHash(groupName, hash);
+            Utils::updateHash(p, hash);
+            Utils::updateHash(params[p], hash);
+        }
+    }
+}
+}   // Anonymous namespace
+
 // ------------------------------------------------------------------------
 // ModelSpec
 // ------------------------------------------------------------------------
@@ -38,7 +57,7 @@ ModelSpec::ModelSpec()
 :   m_TimePrecision(TimePrecision::DEFAULT), m_DT(0.5), m_TimingEnabled(false), m_Seed(0),
     m_DefaultVarLocation(VarLocation::HOST_DEVICE), m_DefaultExtraGlobalParamLocation(VarLocation::HOST_DEVICE),
     m_DefaultSparseConnectivityLocation(VarLocation::HOST_DEVICE), m_DefaultNarrowSparseIndEnabled(false),
-    m_ShouldFusePostsynapticModels(false), m_ShouldFusePrePostWeightUpdateModels(false), m_BatchSize(1)
+    m_ShouldFusePostsynapticModels(false), m_ShouldFusePrePostWeightUpdateModels(false), m_ShouldEliminateVars(false), m_BatchSize(1)
 {
     setPrecision(GENN_FLOAT);
 }
@@ -191,6 +210,69 @@ void ModelSpec::finalize()
         n.second.fusePrePostSynapses(m_ShouldFusePostsynapticModels, m_ShouldFusePrePostWeightUpdateModels);
     }
 
+    // If variable elimination is enabled
+    if(m_ShouldEliminateVars) {
+        for(auto &n : m_LocalNeuronGroups) {
+            // Build set of this neuron group's variables which are referenced by custom updates
+            // **NOTE** variable references only identify their target by name so this is conservative
+            std::set<std::string> customUpdateVarRefs;
+            for(const auto &c : m_CustomUpdates) {
+                for(const auto &v : c.second.getVarReferences()) {
+                    if(v.getTargetName() == n.first) {
+                        customUpdateVarRefs.insert(v.getVar().name);
+                    }
+                }
+            }
+
+            // Eliminate unused variables
+            n.second.eliminateVars(customUpdateVarRefs);
+        }
+
+        for(auto &c : m_LocalCurrentSources) {
+            // Build set of this current source's variables which are referenced by custom updates
+            std::set<std::string> customUpdateVarRefs;
+            for(const auto &cu : m_CustomUpdates) {
+                for(const auto &v : cu.second.getVarReferences()) {
+                    if(v.getTargetName() == c.first) {
+                        customUpdateVarRefs.insert(v.getVar().name);
+                    }
+                }
+            }
+
+            // Eliminate unused variables
+            c.second.eliminateVars(customUpdateVarRefs);
+        }
+
+        for(auto &s : m_LocalSynapseGroups) {
+            // Build set of this synapse group's postsynaptic model variables which are referenced by custom updates
+            std::set<std::string> psCustomUpdateVarRefs;
+            for(const auto &cu : m_CustomUpdates) {
+                for(const auto &v : cu.second.getVarReferences()) {
+                    if(v.getTargetName() == s.first) {
+                        psCustomUpdateVarRefs.insert(v.getVar().name);
+                    }
+                }
+            }
+
+            // Build set of this synapse group's weight update model variables which are referenced by custom WU updates
+            // **NOTE** this includes variables written by transpose updates
+            std::set<std::string> wuCustomUpdateVarRefs;
+            for(const auto &cu : m_CustomWUUpdates) {
+                for(const auto &v : cu.second.getVarReferences()) {
+                    if(v.getSynapseGroup() == &s.second && v.getTargetName() == s.first) {
+                        wuCustomUpdateVarRefs.insert(v.getVar().name);
+                    }
+                    if(v.getTransposeSynapseGroup() == &s.second) {
+                        wuCustomUpdateVarRefs.insert(v.getTransposeVar().name);
+                    }
+                }
+            }
+
+            // Eliminate unused variables
+            s.second.eliminateVars(wuCustomUpdateVarRefs, psCustomUpdateVarRefs);
+        }
+    }
+
     // Loop through neuron populations and their outgoing synapse populations
     for(auto &n : m_LocalNeuronGroups) {
         for(auto *sg : n.second.getOutSyn()) {
@@ -203,8 +285,18 @@ void ModelSpec::finalize()
                 // **NOTE** this is really gross but I can't really see an alternative - merging decisions are based on the spike event conditions set
                 // **NOTE** we do not substitute EGP names here as they aren't known and don't effect merging
                 // **NOTE** this prevents heterogeneous parameters being allowed in event threshold conditions but I can't see any way around this
+                // **NOTE** for the same reason, dynamic parameters can't be used in event threshold conditions
+                const auto wuParamNames = wu->getParamNames();
+                for(size_t i = 0; i < wuParamNames.size(); i++) {
+                    if(sg->isWUParamDynamic(i) 
+                       && wu->getEventThresholdConditionCode().find("$(" + wuParamNames[i] + ")") != std::string::npos) 
+                    {
+                        throw std::runtime_error("Dynamic weight update model parameter '" + wuParamNames[i] + "' of synapse group '" 
+                                                 + sg->getName() + "' cannot be used in event threshold condition code");
+                    }
+                }
                 Substitutions thresholdSubs;
-                thresholdSubs.addParamValueSubstitution(wu->getParamNames(), sg->getWUParams());
+                thresholdSubs.addParamValueSubstitution(wuParamNames, sg->getWUParams());
                 thresholdSubs.addVarValueSubstitution(wu->getDerivedParams(), sg->getWUDerivedParams());
                 
                 std::string eCode = wu->getEventThresholdConditionCode();
@@ -292,6 +384,31 @@ boost::uuids::detail::sha1::digest_type ModelSpec::getHashDigest() const
     Utils::updateHash(getBatchSize(), hash);
     Utils::updateHash(getSeed(), hash);
 
+    // Concatenate values of dynamic parameters
+    // **NOTE** these are excluded from merged group hashes but their initial values are still written to runner
+    for(const auto &n : m_LocalNeuronGroups) {
+        updateDynamicParamHash(n.first, n.second.getParams(), 
+                               [&n](size_t p) { return n.second.isParamDynamic(p); }, hash);
+    }
+    for(const auto &s : m_LocalSynapseGroups) {
+        updateDynamicParamHash(s.first, s.second.getWUParams(), 
+                               [&s](size_t p) { return s.second.isWUParamDynamic(p); }, hash);
+        updateDynamicParamHash(s.first, s.second.getPSParams(), 
+                               [&s](size_t p) { return s.second.isPSParamDynamic(p); }, hash);
+    }
+    for(const auto &c : m_LocalCurrentSources) {
+        updateDynamicParamHash(c.first, c.second.getParams(), 
+                               [&c](size_t p) { return c.second.isParamDynamic(p); }, hash);
+    }
+    for(const auto &c : m_CustomUpdates) {
+        updateDynamicParamHash(c.first, c.second.getParams(), 
+                               [&c](size_t p) { return c.second.isParamDynamic(p); }, hash);
+    }
+    for(const auto &c : m_CustomWUUpdates) {
+        updateDynamicParamHash(c.first, c.second.getParams(), 
+                               [&c](size_t p) { return c.second.isParamDynamic(p); }, hash);
+    }
+
     return hash.get_digest();
 }
 
@@ -3,6 +3,7 @@
 // GeNN includes
 #include "customUpdateInternal.h"
 #include "currentSourceInternal.h"
+#include "logging.h"
 #include "neuronGroupInternal.h"
 #include "synapseGroupInternal.h"
 
@@ -202,3 +203,33 @@ void Models::updateHash(const WUVarReference &v, boost::uuids::detail::sha1 &has
         Utils::updateHash(v.getTransposeVarIndex(), hash);
     }
 }
+//----------------------------------------------------------------------------
+void Models::eliminateVars(const Base::VarVec &vars, const std::vector<VarInit> &varInitialisers,
+                           const std::vector<std::string> &codeStrings, const std::vector<bool> &retained,
+                           const std::string &description, std::vector<bool> &varArrayRequired,
+                           std::vector<bool> &varConstantFolded)
+{
+    for(size_t i = 0; i < vars.size(); i++) {
+        // If variable has been retained, it must be implemented as an array so skip
+        if(retained[i]) {
+            continue;
+        }
+
+        // If variable isn't referenced at all, eliminate it
+        const std::string varName = "$(" + vars[i].name + ")";
+        if(std::none_of(codeStrings.cbegin(), codeStrings.cend(),
+                        [&varName](const std::string &c) { return (c.find(varName) != std::string::npos); }))
+        {
+            LOGD_GENN << "Eliminating unreferenced variable '" << vars[i].name << "' of " << description;
+            varArrayRequired[i] = false;
+        }
+        // Otherwise, if it's read-only and initialised to a constant, fold it like a parameter
+        else if((vars[i].access & VarAccessMode::READ_ONLY)
+                && dynamic_cast<const InitVarSnippet::Constant*>(varInitialisers[i].getSnippet()) != nullptr)
+        {
+            LOGD_GENN << "Folding constant variable '" << vars[i].name << "' of " << description;
+            varArrayRequired[i] = false;
+            varConstantFolded[i] = true;
+        }
+    }
+}
@@ -96,6 +96,24 @@ void fuseSynapseGroups(const std::vector<SynapseGroupInternal*> &unmergedSyn, bo
         }
     }
 }
+// ------------------------------------------------------------------------
+void addWUCodeStrings(const WeightUpdateModels::Base *wum, std::vector<std::string> &codeStrings)
+{
+    codeStrings.insert(codeStrings.end(),
+                       {wum->getSimCode(), wum->getEventCode(), wum->getLearnPostCode(),
+                        wum->getSynapseDynamicsCode(), wum->getLazySynapseDynamicsCode(),
+                        wum->getEventThresholdConditionCode(), wum->getPreSpikeCode(), wum->getPostSpikeCode(),
+                        wum->getPreDynamicsCode(), wum->getPostDynamicsCode()});
+}
+// ------------------------------------------------------------------------
+bool isVarReferenced(const std::vector<std::string> &codeStrings, const std::string &varName)
+{
+    return std::any_of(codeStrings.cbegin(), codeStrings.cend(),
+                       [&varName](const std::string &c)
+                       {
+                           return (c.find("$(" + varName + ")") != std::string::npos);
+                       });
+}
 }   // Anonymous namespace
 
 // ------------------------------------------------------------------------
@@ -106,6 +124,16 @@ void NeuronGroup::setVarLocation(const std::string &varName, VarLocation loc)
     m_VarLocation.at(getNeuronModel()->getVarIndex(varName)) = loc;
 }
 //----------------------------------------------------------------------------
+void NeuronGroup::setVarRetained(const std::string &varName, bool retained)
+{
+    m_VarRetained.at(getNeuronModel()->getVarIndex(varName)) = retained;
+}
+//----------------------------------------------------------------------------
+void NeuronGroup::setParamDynamic(const std::string &paramName, bool dynamic)
+{
+    m_DynamicParams.at(getNeuronModel()->getParamIndex(paramName)) = dynamic;
+}
+//----------------------------------------------------------------------------
 void NeuronGroup::setExtraGlobalParamLocation(const std::string &paramName, VarLocation loc)
 {
     const size_t extraGlobalParamIndex = getNeuronModel()->getExtraGlobalParamIndex(paramName);
@@ -120,6 +148,11 @@ VarLocation NeuronGroup::getVarLocation(const std::string &varName) const
     return m_VarLocation.at(getNeuronModel()->getVarIndex(varName));
 }
 //----------------------------------------------------------------------------
+bool NeuronGroup::isVarArrayRequired(const std::string &varName) const
+{
+    return m_VarArrayRequired.at(getNeuronModel()->getVarIndex(varName));
+}
+//----------------------------------------------------------------------------
 VarLocation NeuronGroup::getExtraGlobalParamLocation(const std::string &paramName) const
 {
     return m_ExtraGlobalParamLocation.at(getNeuronModel()->getExtraGlobalParamIndex(paramName));
@@ -306,7 +339,8 @@ NeuronGroup::NeuronGroup(const std::string &name, int numNeurons, const NeuronMo
                          const std::vector<double> &params, const std::vector<Models::VarInit> &varInitialisers,
                          VarLocation defaultVarLocation, VarLocation defaultExtraGlobalParamLocation)
 :   m_Name(name), m_NumNeurons(numNeurons), m_NeuronModel(neuronModel), m_Params(params), m_VarInitialisers(varInitialisers),
-    m_NumDelaySlots(1), m_VarQueueRequired(varInitialisers.size(), false), m_SpikeLocation(defaultVarLocation), m_SpikeEventLocation(defaultVarLocation),
+    m_NumDelaySlots(1), m_DynamicParams(params.size(), false), m_VarQueueRequired(varInitialisers.size(), false), m_VarRetained(varInitialisers.size(), false),
+    m_VarArrayRequired(varInitialisers.size(), true), m_VarConstantFolded(varInitialisers.size(), false), m_SpikeLocation(defaultVarLocation), m_SpikeEventLocation(defaultVarLocation),
     m_SpikeTimeLocation(defaultVarLocation), m_PrevSpikeTimeLocation(defaultVarLocation), m_SpikeEventTimeLocation(defaultVarLocation), m_PrevSpikeEventTimeLocation(defaultVarLocation),
     m_VarLocation(varInitialisers.size(), defaultVarLocation), m_ExtraGlobalParamLocation(neuronModel->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation),
     m_SpikeRecordingEnabled(false), m_SpikeEventRecordingEnabled(false)
@@ -334,6 +368,46 @@ void NeuronGroup::updatePostVarQueues(const std::string &code)
     updateVarQueues(code, "_post");
 }
 //----------------------------------------------------------------------------
+void NeuronGroup::eliminateVars(const std::set<std::string> &customUpdateVarRefs)
+{
+    // Build vector of code strings in which neuron variables are accessed via registers during the neuron update
+    const auto *nm = getNeuronModel();
+    std::vector<std::string> neuronCode{nm->getSimCode(), nm->getThresholdConditionCode(), nm->getResetCode()};
+    for(const auto &a : nm->getAdditionalInputVars()) {
+        neuronCode.push_back(a.value);
+    }
+    for(const auto *sg : getInSyn()) {
+        neuronCode.push_back(sg->getPSModel()->getApplyInputCode());
+        neuronCode.push_back(sg->getPSModel()->getDecayCode());
+    }
+
+    // Build vectors of weight update code strings in which neuron variables are accessed directly from memory
+    std::vector<std::string> preCode;
+    for(const auto *sg : getOutSyn()) {
+        addWUCodeStrings(sg->getWUModel(), preCode);
+    }
+    std::vector<std::string> postCode;
+    for(const auto *sg : getInSyn()) {
+        addWUCodeStrings(sg->getWUModel(), postCode);
+    }
+
+    // Variables which have been retained, are referenced by a custom update or
+    // accessed by synaptic code must be implemented as arrays
+    const auto vars = nm->getVars();
+    std::vector<bool> retained(m_VarRetained);
+    for(size_t i = 0; i < vars.size(); i++) {
+        if((customUpdateVarRefs.find(vars[i].name) != customUpdateVarRefs.cend())
+           || isVarReferenced(preCode, vars[i].name + "_pre") || isVarReferenced(postCode, vars[i].name + "_post"))
+        {
+            retained[i] = true;
+        }
+    }
+
+    // Eliminate or fold remaining variables based on neuron code
+    Models::eliminateVars(vars, getVarInitialisers(), neuronCode, retained, "neuron group '" + getName() + "'",
+                          m_VarArrayRequired, m_VarConstantFolded);
+}
+//----------------------------------------------------------------------------
 void NeuronGroup::initDerivedParams(double dt)
 {
     auto derivedParams = getNeuronModel()->getDerivedParams();
@@ -346,6 +420,10 @@ void NeuronGroup::initDerivedParams(double dt)
         m_DerivedParams.push_back(d.func(m_Params, dt));
     }
 
+    // Check derived parameters don't depend on dynamic parameters
+    Utils::validateDynamicParams(derivedParams, getNeuronModel()->getParamNames(), m_Params, m_DynamicParams,
+                                 dt, "neuron group '" + getName() + "'");
+
     // Initialise derived parameters for variable initialisers
     for(auto &v : m_VarInitialisers) {
         v.initDerivedParams(dt);
@@ -495,6 +573,9 @@ boost::uuids::detail::sha1::digest_type NeuronGroup::getHashDigest() const
     Utils::updateHash(isSpikeEventRecordingEnabled(), hash);
     Utils::updateHash(getNumDelaySlots(), hash);
     Utils::updateHash(m_VarQueueRequired, hash);
+    Utils::updateHash(m_DynamicParams, hash);
+    Utils::updateHash(m_VarArrayRequired, hash);
+    Utils::updateHash(m_VarConstantFolded, hash);
 
     // Update hash with hash list built from current sources
     updateHashList(getCurrentSources(), hash, &CurrentSourceInternal::getHashDigest);
@@ -523,6 +604,7 @@ boost::uuids::detail::sha1::digest_type NeuronGroup::getInitHashDigest() const
     Utils::updateHash(isSimRNGRequired(), hash);
     Utils::updateHash(getNumDelaySlots(), hash);
     Utils::updateHash(m_VarQueueRequired, hash);
+    Utils::updateHash(m_VarArrayRequired, hash);
     Utils::updateHash(getNeuronModel()->getVars(), hash);
 
     // Include variable initialiser hashes
@@ -76,6 +76,31 @@ void SynapseGroup::setPSVarLocation(const std::string &varName, VarLocation loc)
     m_PSVarLocation[getPSModel()->getVarIndex(varName)] = loc;
 }
 //----------------------------------------------------------------------------
+void SynapseGroup::setWUVarRetained(const std::string &varName, bool retained)
+{
+    if(isWeightSharingSlave()) {
+        throw std::runtime_error("setWUVarRetained: Synapse group is a weight sharing slave. Weight update vars can only be retained on the master.");
+    }
+    else {
+        m_WUVarRetained.at(getWUModel()->getVarIndex(varName)) = retained;
+    }
+}
+//----------------------------------------------------------------------------
+void SynapseGroup::setPSVarRetained(const std::string &varName, bool retained)
+{
+    m_PSVarRetained.at(getPSModel()->getVarIndex(varName)) = retained;
+}
+//----------------------------------------------------------------------------
+void SynapseGroup::setWUParamDynamic(const std::string &paramName, bool dynamic)
+{
+    m_WUDynamicParams.at(getWUModel()->getParamIndex(paramName)) = dynamic;
+}
+//----------------------------------------------------------------------------
+void SynapseGroup::setPSParamDynamic(const std::string &paramName, bool dynamic)
+{
+    m_PSDynamicParams.at(getPSModel()->getParamIndex(paramName)) = dynamic;
+}
+//----------------------------------------------------------------------------
 void SynapseGroup::setPSTargetVar(const std::string &varName)
 {
     // If varname is either 'ISyn' or name of target neuron group additional input variable, store
@@ -220,6 +245,16 @@ void SynapseGroup::setNumThreadsPerSpike(unsigned int numThreadsPerSpike)
     }
 }
 //----------------------------------------------------------------------------
+void SynapseGroup::setPostTileSize(unsigned int postTileSize)
+{
+    if ((getMatrixType() & SynapseMatrixConnectivity::DENSE) || (getMatrixType() & SynapseMatrixConnectivity::BITMASK)) {
+        m_PostTileSize = postTileSize;
+    }
+    else {
+        throw std::runtime_error("setPostTileSize: This function can only be used on synapse groups with dense or bitmask connectivity.");
+    }
+}
+//----------------------------------------------------------------------------
 void SynapseGroup::setBackPropDelaySteps(unsigned int timesteps)
 {
     m_BackPropDelaySteps = timesteps;
@@ -382,6 +417,27 @@ VarLocation SynapseGroup::getPSVarLocation(const std::string &var) const
     return m_PSVarLocation[getPSModel()->getVarIndex(var)];
 }
 //----------------------------------------------------------------------------
+bool SynapseGroup::isWUVarArrayRequired(const std::string &var) const
+{
+    return isWUVarArrayRequired(getWUModel()->getVarIndex(var));
+}
+//----------------------------------------------------------------------------
+bool SynapseGroup::isWUVarArrayRequired(size_t index) const
+{
+    // **NOTE** weight sharing slaves use their master's variables
+    if(isWeightSharingSlave()) {
+        return getWeightSharingMaster()->isWUVarArrayRequired(index);
+    }
+    else {
+        return m_WUVarArrayRequired.at(index);
+    }
+}
+//----------------------------------------------------------------------------
+bool SynapseGroup::isPSVarArrayRequired(const std::string &var) const
+{
+    return m_PSVarArrayRequired.at(getPSModel()->getVarIndex(var));
+}
+//----------------------------------------------------------------------------
 VarLocation SynapseGroup::getPSExtraGlobalParamLocation(const std::string &paramName) const
 {
     return m_PSExtraGlobalParamLocation[getPSModel()->getExtraGlobalParamIndex(paramName)];
@@ -504,16 +560,23 @@ bool SynapseGroup::isHostInitRNGRequired() const
     return (m_SparseConnectivityInitialiser.getSnippet()->getHostInitCode().find("$(rng)") != std::string::npos);
 }
 //----------------------------------------------------------------------------
+bool SynapseGroup::isLazySynapseDynamicsRequired() const
+{
+    return !getWUModel()->getLazySynapseDynamicsCode().empty();
+}
+//----------------------------------------------------------------------------
 bool SynapseGroup::isWUVarInitRequired() const
 {
     // If this synapse group has per-synapse or kernel state variables and isn't a
     // weight sharing slave, return true if any of them have initialisation code which doesn't require a kernel
     if (!isWeightSharingSlave() && ((getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) || (getMatrixType() & SynapseMatrixWeight::KERNEL))) {
-        return std::any_of(m_WUVarInitialisers.cbegin(), m_WUVarInitialisers.cend(),
-                           [](const Models::VarInit &init)
-                           { 
-                               return !init.getSnippet()->getCode().empty() && !init.getSnippet()->requiresKernel(); 
-                           });
+        for(size_t i = 0; i < m_WUVarInitialisers.size(); i++) {
+            const auto *snippet = m_WUVarInitialisers[i].getSnippet();
+            if(isWUVarArrayRequired(i) && !snippet->getCode().empty() && !snippet->requiresKernel()) {
+                return true;
+            }
+        }
+        return false;
     }
     else {
         return false;
@@ -538,12 +601,15 @@ SynapseGroup::SynapseGroup(const std::string &name, SynapseMatrixType matrixType
                            const InitToeplitzConnectivitySnippet::Init &toeplitzInitialiser,
                            VarLocation defaultVarLocation, VarLocation defaultExtraGlobalParamLocation,
                            VarLocation defaultSparseConnectivityLocation, bool defaultNarrowSparseIndEnabled)
-    :   m_Name(name), m_SpanType(SpanType::POSTSYNAPTIC), m_NumThreadsPerSpike(1), m_DelaySteps(delaySteps), m_BackPropDelaySteps(0),
+    :   m_Name(name), m_SpanType(SpanType::POSTSYNAPTIC), m_NumThreadsPerSpike(1), m_PostTileSize(0), m_DelaySteps(delaySteps), m_BackPropDelaySteps(0),
         m_MaxDendriticDelayTimesteps(1), m_MatrixType(matrixType),  m_SrcNeuronGroup(srcNeuronGroup), m_TrgNeuronGroup(trgNeuronGroup), m_WeightSharingMaster(weightSharingMaster),
         m_EventThresholdReTestRequired(false), m_NarrowSparseIndEnabled(defaultNarrowSparseIndEnabled),
         m_InSynLocation(defaultVarLocation),  m_DendriticDelayLocation(defaultVarLocation),
         m_WUModel(wu), m_WUParams(wuParams), m_WUVarInitialisers(wuVarInitialisers), m_WUPreVarInitialisers(wuPreVarInitialisers), m_WUPostVarInitialisers(wuPostVarInitialisers),
         m_PSModel(ps), m_PSParams(psParams), m_PSVarInitialisers(psVarInitialisers),
+        m_WUDynamicParams(wuParams.size(), false), m_PSDynamicParams(psParams.size(), false),
+        m_WUVarRetained(wuVarInitialisers.size(), false), m_WUVarArrayRequired(wuVarInitialisers.size(), true), m_WUVarConstantFolded(wuVarInitialisers.size(), false),
+        m_PSVarRetained(psVarInitialisers.size(), false), m_PSVarArrayRequired(psVarInitialisers.size(), true), m_PSVarConstantFolded(psVarInitialisers.size(), false),
         m_WUVarLocation(wuVarInitialisers.size(), defaultVarLocation), m_WUPreVarLocation(wuPreVarInitialisers.size(), defaultVarLocation),
         m_WUPostVarLocation(wuPostVarInitialisers.size(), defaultVarLocation), m_WUExtraGlobalParamLocation(wu->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation),
         m_PSVarLocation(psVarInitialisers.size(), defaultVarLocation), m_PSExtraGlobalParamLocation(ps->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation),
@@ -591,6 +657,18 @@ SynapseGroup::SynapseGroup(const std::string &name, SynapseMatrixType matrixType
         }
     }
     
+    // If weight update model has lazy synapse dynamics, give an error unless synapse group has its own individual DENSE or SPARSE weights
+    if(isLazySynapseDynamicsRequired()) {
+        if(!(m_MatrixType & SynapseMatrixWeight::INDIVIDUAL)
+           || !((m_MatrixType & SynapseMatrixConnectivity::DENSE) || (m_MatrixType & SynapseMatrixConnectivity::SPARSE)))
+        {
+            throw std::runtime_error("Lazy synapse dynamics can only be used for synapse groups with individual weights and DENSE or SPARSE connectivity");
+        }
+        if(isWeightSharingSlave()) {
+            throw std::runtime_error("Lazy synapse dynamics cannot be used for weight sharing slave synapse groups");
+        }
+    }
+
     // If synapse group has Toeplitz connectivity
     if(m_MatrixType & SynapseMatrixConnectivity::TOEPLITZ) {
         // Give an error if there is sparse connectivity initialiser code
@@ -714,6 +792,24 @@ void SynapseGroup::initDerivedParams(double dt)
         m_PSDerivedParams.push_back(d.func(m_PSParams, dt));
     }
 
+    // Check derived parameters don't depend on dynamic parameters
+    Utils::validateDynamicParams(wuDerivedParams, getWUModel()->getParamNames(), m_WUParams, m_WUDynamicParams,
+                                 dt, "weight update model of synapse group '" + getName() + "'");
+    Utils::validateDynamicParams(psDerivedParams, getPSModel()->getParamNames(), m_PSParams, m_PSDynamicParams,
+                                 dt, "postsynaptic model of synapse group '" + getName() + "'");
+
+    // Dynamic parameters are set using runtime variables named after the parameter and synapse 
+    // group so give error if dynamic weight update and postsynaptic model parameters share a name
+    const auto wuParamNames = getWUModel()->getParamNames();
+    const auto psParamNames = getPSModel()->getParamNames();
+    for(size_t i = 0; i < wuParamNames.size(); i++) {
+        for(size_t j = 0; j < psParamNames.size(); j++) {
+            if(m_WUDynamicParams[i] && m_PSDynamicParams[j] && wuParamNames[i] == psParamNames[j]) {
+                throw std::runtime_error("Synapse group '" + getName() + "' has dynamic weight update and postsynaptic model parameters both called '" + wuParamNames[i] + "'");
+            }
+        }
+    }
+
     // Initialise derived parameters for WU variable initialisers
     for(auto &v : m_WUVarInitialisers) {
         v.initDerivedParams(dt);
@@ -739,13 +835,71 @@ void SynapseGroup::initDerivedParams(double dt)
     m_ToeplitzConnectivityInitialiser.initDerivedParams(dt);
 }
 //----------------------------------------------------------------------------
+void SynapseGroup::eliminateVars(const std::set<std::string> &wuCustomUpdateVarRefs, const std::set<std::string> &psCustomUpdateVarRefs)
+{
+    // If this group has its own individual per-synapse variables
+    // **NOTE** weight sharing slaves use their master's variables so inherit its choices
+    if((getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) && !isWeightSharingSlave()) {
+        // Variables which have been retained, are referenced by a custom update or are
+        // initialised alongside the sparse connectivity must be implemented as arrays
+        const auto *wum = getWUModel();
+        const auto vars = wum->getVars();
+        std::vector<bool> retained(m_WUVarRetained);
+        for(size_t i = 0; i < vars.size(); i++) {
+            if((wuCustomUpdateVarRefs.find(vars[i].name) != wuCustomUpdateVarRefs.cend())
+               || getWUVarInitialisers()[i].getSnippet()->requiresKernel())
+            {
+                retained[i] = true;
+            }
+        }
+
+        // Eliminate or fold remaining variables based on synaptic code
+        Models::eliminateVars(vars, getWUVarInitialisers(),
+                              {wum->getSimCode(), wum->getEventCode(), wum->getLearnPostCode(),
+                               wum->getSynapseDynamicsCode(), wum->getLazySynapseDynamicsCode()},
+                              retained, "synapse group '" + getName() + "'", m_WUVarArrayRequired, m_WUVarConstantFolded);
+    }
+
+    // If this group has individual postsynaptic model variables
+    // **NOTE** postsynaptic models with variables are never fused so these always belong to this group
+    if(getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) {
+        // Variables which have been retained or are referenced by a custom update must be implemented as arrays
+        const auto *psm = getPSModel();
+        const auto vars = psm->getVars();
+        std::vector<bool> retained(m_PSVarRetained);
+        for(size_t i = 0; i < vars.size(); i++) {
+            if(psCustomUpdateVarRefs.find(vars[i].name) != psCustomUpdateVarRefs.cend()) {
+                retained[i] = true;
+            }
+        }
+
+        // Eliminate or fold remaining variables based on postsynaptic code
+        Models::eliminateVars(vars, getPSVarInitialisers(), {psm->getApplyInputCode(), psm->getDecayCode()},
+                              retained, "postsynaptic model of synapse group '" + getName() + "'",
+                              m_PSVarArrayRequired, m_PSVarConstantFolded);
+    }
+}
+//----------------------------------------------------------------------------
+bool SynapseGroup::isWUVarConstantFolded(size_t index) const
+{
+    // **NOTE** weight sharing slaves use their master's variables
+    if(isWeightSharingSlave()) {
+        return getWeightSharingMaster()->isWUVarConstantFolded(index);
+    }
+    else {
+        return m_WUVarConstantFolded.at(index);
+    }
+}
+//----------------------------------------------------------------------------
 bool SynapseGroup::canPSBeFused() const
 {
     // Return true if there are no variables or extra global parameters
     // **NOTE** many models with variables would work fine, but  
     // nothing stops initialisers being used to configure PS models 
     // to behave totally different, similarly with EGPs
-    return (getPSVarInitialisers().empty() && getPSModel()->getExtraGlobalParams().empty());
+    // **NOTE** postsynaptic models with dynamic parameters also can't be fused as their values can diverge at runtime
+    return (getPSVarInitialisers().empty() && getPSModel()->getExtraGlobalParams().empty()
+            && std::none_of(m_PSDynamicParams.cbegin(), m_PSDynamicParams.cend(), [](bool d) { return d; }));
 }
 //----------------------------------------------------------------------------
 bool SynapseGroup::canWUMPreUpdateBeFused() const
@@ -774,6 +928,17 @@ bool SynapseGroup::canWUMPreUpdateBeFused() const
             return false;
         }
     }
+
+    // If any dynamic parameters are referenced in presynaptic spike or dynamics code, return false
+    const auto wuParamNames = getWUModel()->getParamNames();
+    for(size_t i = 0; i < wuParamNames.size(); i++) {
+        const std::string paramName = "$(" + wuParamNames[i] + ")";
+        if(isWUParamDynamic(i) && ((preSpikeCode.find(paramName) != std::string::npos)
+                                   || (preDynamicsCode.find(paramName) != std::string::npos)))
+        {
+            return false;
+        }
+    }
     return true;
 }
 //----------------------------------------------------------------------------
@@ -803,6 +968,17 @@ bool SynapseGroup::canWUMPostUpdateBeFused() const
             return false;
         }
     }
+
+    // If any dynamic parameters are referenced in postsynaptic spike or dynamics code, return false
+    const auto wuParamNames = getWUModel()->getParamNames();
+    for(size_t i = 0; i < wuParamNames.size(); i++) {
+        const std::string paramName = "$(" + wuParamNames[i] + ")";
+        if(isWUParamDynamic(i) && ((postSpikeCode.find(paramName) != std::string::npos)
+                                   || (postDynamicsCode.find(paramName) != std::string::npos)))
+        {
+            return false;
+        }
+    }
     return true;
 }
 //----------------------------------------------------------------------------
@@ -821,12 +997,24 @@ boost::uuids::detail::sha1::digest_type SynapseGroup::getWUHashDigest() const
     Utils::updateHash(getMaxDendriticDelayTimesteps(), hash);
     Utils::updateHash(getSparseIndType(), hash);
     Utils::updateHash(getNumThreadsPerSpike(), hash);
+    Utils::updateHash(getPostTileSize(), hash);
     Utils::updateHash(isEventThresholdReTestRequired(), hash);
     Utils::updateHash(getSpanType(), hash);
     Utils::updateHash(isPSModelFused(), hash);
     Utils::updateHash(getSrcNeuronGroup()->getNumDelaySlots(), hash);
     Utils::updateHash(getTrgNeuronGroup()->getNumDelaySlots(), hash);
     Utils::updateHash(getMatrixType(), hash);
+    Utils::updateHash(m_WUDynamicParams, hash);
+
+    // Include which variables have been eliminated or folded into code
+    for(size_t i = 0; i < getWUVarInitialisers().size(); i++) {
+        Utils::updateHash(isWUVarArrayRequired(i), hash);
+        Utils::updateHash(isWUVarConstantFolded(i), hash);
+    }
+
+    // Include which source and target neuron parameters are dynamic as weight update code can reference them
+    Utils::updateHash(getSrcNeuronGroup()->getDynamicParams(), hash);
+    Utils::updateHash(getTrgNeuronGroup()->getDynamicParams(), hash);
 
     // If weights are procedural, include variable initialiser hashes
     if(getMatrixType() & SynapseMatrixWeight::PROCEDURAL) {
@@ -852,6 +1040,8 @@ boost::uuids::detail::sha1::digest_type SynapseGroup::getWUPreHashDigest() const
     boost::uuids::detail::sha1 hash;
     Utils::updateHash(getWUModel()->getHashDigest(), hash);
     Utils::updateHash((getDelaySteps() != 0), hash);
+    Utils::updateHash(m_WUDynamicParams, hash);
+    Utils::updateHash(getSrcNeuronGroup()->getDynamicParams(), hash);
     return hash.get_digest();
 }
 //----------------------------------------------------------------------------
@@ -860,6 +1050,8 @@ boost::uuids::detail::sha1::digest_type SynapseGroup::getWUPostHashDigest() cons
     boost::uuids::detail::sha1 hash;
     Utils::updateHash(getWUModel()->getHashDigest(), hash);
     Utils::updateHash((getBackPropDelaySteps() != 0), hash);
+    Utils::updateHash(m_WUDynamicParams, hash);
+    Utils::updateHash(getTrgNeuronGroup()->getDynamicParams(), hash);
     return hash.get_digest();
 }
 //----------------------------------------------------------------------------
@@ -870,6 +1062,9 @@ boost::uuids::detail::sha1::digest_type SynapseGroup::getPSHashDigest() const
     Utils::updateHash(getMaxDendriticDelayTimesteps(), hash);
     Utils::updateHash((getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM), hash);
     Utils::updateHash(getPSTargetVar(), hash);
+    Utils::updateHash(m_PSDynamicParams, hash);
+    Utils::updateHash(m_PSVarArrayRequired, hash);
+    Utils::updateHash(m_PSVarConstantFolded, hash);
     return hash.get_digest();
 }
 //----------------------------------------------------------------------------
@@ -994,10 +1189,12 @@ boost::uuids::detail::sha1::digest_type SynapseGroup::getWUInitHashDigest() cons
 
     Utils::updateHash(getWUModel()->getSynapseDynamicsCode().empty(), hash);
     Utils::updateHash(getWUModel()->getLearnPostCode().empty(), hash);
+    Utils::updateHash(isLazySynapseDynamicsRequired(), hash);
 
-    // Include variable initialiser hashes
-    for(const auto &w : getWUVarInitialisers()) {
-        Utils::updateHash(w.getHashDigest(), hash);
+    // Include variable initialiser hashes and which variables are implemented as arrays
+    for(size_t i = 0; i < getWUVarInitialisers().size(); i++) {
+        Utils::updateHash(getWUVarInitialisers()[i].getHashDigest(), hash);
+        Utils::updateHash(isWUVarArrayRequired(i), hash);
     }
     return hash.get_digest();
 }
@@ -1031,6 +1228,7 @@ boost::uuids::detail::sha1::digest_type SynapseGroup::getPSInitHashDigest() cons
     boost::uuids::detail::sha1 hash;
     Utils::updateHash(getMaxDendriticDelayTimesteps(), hash);
     Utils::updateHash(getPSModel()->getVars(), hash);
+    Utils::updateHash(m_PSVarArrayRequired, hash);
 
     // Include postsynaptic model variable initialiser hashes
     for(const auto &p : getPSVarInitialisers()) {
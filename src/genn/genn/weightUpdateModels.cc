@@ -18,6 +18,7 @@ boost::uuids::detail::sha1::digest_type WeightUpdateModels::Base::getHashDigest(
     Utils::updateHash(getEventCode(), hash);
     Utils::updateHash(getLearnPostCode(), hash);
     Utils::updateHash(getSynapseDynamicsCode(), hash);
+    Utils::updateHash(getLazySynapseDynamicsCode(), hash);
     Utils::updateHash(getEventThresholdConditionCode(), hash);
     Utils::updateHash(getSimSupportCode(), hash);
     Utils::updateHash(getLearnPostSupportCode(), hash);
@@ -65,4 +66,9 @@ void WeightUpdateModels::Base::validate() const
     {
         throw std::runtime_error("Weight update models cannot include variables with SHARED_NEURON access modes - they are only supported on pre, postsynaptic or neuron variables");
     }
+
+    // If model has both synapse dynamics and lazy synapse dynamics, give an error
+    if(!getSynapseDynamicsCode().empty() && !getLazySynapseDynamicsCode().empty()) {
+        throw std::runtime_error("Weight update models cannot have both synapse dynamics and lazy synapse dynamics code");
+    }
 }
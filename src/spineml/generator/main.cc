@@ -39,6 +39,7 @@
 #include "modelSpecInternal.h"
 
 // GeNN code generator includes
+#include "code_generator/changedFileStream.h"
 #include "code_generator/generateMakefile.h"
 #include "code_generator/generateModules.h"
 #include "code_generator/generateMSBuild.h"
@@ -629,7 +630,7 @@ int main(int argc, char *argv[])
         // Create MSBuild project to compile and link all generated modules
         // **NOTE** scope requiredso it gets closed before being built
         {
-            std::ofstream makefile((codePath / "runner.vcxproj").str());
+            CodeGenerator::ChangedFileStream makefile((codePath / "runner.vcxproj").str());
             CodeGenerator::generateMSBuild(makefile, model, backend, "", moduleNames);
         }
 
@@ -639,7 +640,7 @@ int main(int argc, char *argv[])
         // Create makefile to compile and link all generated modules
         // **NOTE** scope requiredso it gets closed before being built
         {
-            std::ofstream makefile((codePath / "Makefile").str());
+            CodeGenerator::ChangedFileStream makefile((codePath / "Makefile").str());
             CodeGenerator::generateMakefile(makefile, backend, moduleNames);
         }
 
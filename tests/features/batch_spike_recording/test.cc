@@ -0,0 +1,86 @@
+//--------------------------------------------------------------------------
+/*! \file batch_spike_recording/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "batch_spike_recording_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //------------------------------------------------------------------------
+    virtual void Init() override
+    {
+        // Allocate spike recording buffers
+        allocateRecordingBuffers(100);
+
+        // Allocate enough memory for 2 spikes per neuron in first batch and 1 in second
+        allocatespikeTimesPop(300);
+
+        // Loop through neurons
+        for(unsigned int n = 0; n < 100; n++) {
+            // Configure neuron in first batch to spike twice during simulation
+            const float timestep1 = (float)n;
+            const float timestep2 = (float)(99 - n);
+            startSpikePop[n] = (n * 2) + 0;
+            spikeTimesPop[(n * 2) + 0] = std::min(timestep1, timestep2);
+            spikeTimesPop[(n * 2) + 1] = std::max(timestep1, timestep2);
+            endSpikePop[n] = (n * 2) + 2;
+
+            // Configure neuron in second batch to spike once during simulation
+            startSpikePop[100 + n] = 200 + n;
+            spikeTimesPop[200 + n] = timestep2;
+            endSpikePop[100 + n] = 200 + n + 1;
+        }
+
+        // Upload spike times
+        pushspikeTimesPopToDevice(300);
+    }
+};
+
+TEST_F(SimTest, BatchSpikeRecording)
+{
+    // Simulate 100 timesteps
+    while(iT < 100) {
+        StepGeNN();
+    }
+
+    // Copy recording data from device
+    pullRecordingBuffersFromDevice();
+
+    // Loop through timesteps
+    for(unsigned int t = 0; t < 100; t++) {
+        // Calculate indices of neurons which should spike this timestep
+        const unsigned int n1 = t;
+        const unsigned int n2 = 99 - t;
+        
+        // Build bitsets for each batch
+        uint32_t correct0[4] = {0, 0, 0, 0};
+        correct0[n1 / 32] |= (1 << (n1 % 32));
+        correct0[n2 / 32] |= (1 << (n2 % 32));
+
+        uint32_t correct1[4] = {0, 0, 0, 0};
+        correct1[n2 / 32] |= (1 << (n2 % 32));
+        
+        // Check that these match actual recording
+        EXPECT_TRUE(std::equal(&correct0[0], &correct0[4], &recordSpkPop[(8 * t) + 0]));
+        EXPECT_TRUE(std::equal(&correct1[0], &correct1[4], &recordSpkPop[(8 * t) + 4]));
+    }
+}
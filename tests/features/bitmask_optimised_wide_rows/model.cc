@@ -0,0 +1,96 @@
+//--------------------------------------------------------------------------
+/*! \file bitmask_optimised_wide_rows/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Pattern
+//----------------------------------------------------------------------------
+//! Connects to all of the first 128 postsynaptic neurons and then every third one
+class Pattern : public InitSparseConnectivitySnippet::Base
+{
+public:
+    DECLARE_SNIPPET(Pattern, 0);
+
+    SET_ROW_BUILD_CODE(
+        "if(j < $(num_post)) {\n"
+        "   if(j < 128 || (($(id_pre) + j) % 3) == 0)\n"
+        "   {\n"
+        "       $(addSynapse, j);\n"
+        "   }\n"
+        "}\n"
+        "else {\n"
+        "   $(endRow);\n"
+        "}\n"
+        "j++;\n");
+    SET_ROW_BUILD_STATE_VARS({{"j", "unsigned int", 0}});
+};
+IMPLEMENT_SNIPPET(Pattern);
+
+//----------------------------------------------------------------------------
+// Pre
+//----------------------------------------------------------------------------
+//! Neuron which spikes every timestep
+class Pre : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Pre, 0, 1);
+
+    SET_SIM_CODE("$(V) += 1.0;\n");
+    SET_THRESHOLD_CONDITION_CODE("$(V) >= 1.0");
+    SET_RESET_CODE("$(V) = 0.0;\n");
+
+    SET_VARS({{"V", "scalar"}});
+};
+IMPLEMENT_MODEL(Pre);
+
+//----------------------------------------------------------------------------
+// Post
+//----------------------------------------------------------------------------
+class Post : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Post, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+IMPLEMENT_MODEL(Post);
+
+void modelDefinition(ModelSpec &model)
+{
+#ifdef CL_HPP_TARGET_OPENCL_VERSION
+    if(std::getenv("OPENCL_DEVICE") != nullptr) {
+        GENN_PREFERENCES.deviceSelectMethod = DeviceSelect::MANUAL;
+        GENN_PREFERENCES.manualDeviceID = std::atoi(std::getenv("OPENCL_DEVICE"));
+    }
+    if(std::getenv("OPENCL_PLATFORM") != nullptr) {
+        GENN_PREFERENCES.manualPlatformID = std::atoi(std::getenv("OPENCL_PLATFORM"));
+    }
+#endif
+    GENN_PREFERENCES.enableBitmaskOptimisations = true;
+
+    model.setDT(1.0);
+    model.setName("bitmask_optimised_wide_rows");
+
+    // Static synapse parameters
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(1.0);    // 0 - Wij (nA)
+
+    model.addNeuronPopulation<Pre>("Pre", 10, {}, Pre::VarValues(0.0));
+    model.addNeuronPopulation<Post>("Post", 150, {}, Post::VarValues(0.0));
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::BITMASK_GLOBALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<Pattern>({}));
+
+    model.setPrecision(GENN_FLOAT);
+}
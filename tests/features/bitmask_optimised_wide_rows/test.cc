@@ -0,0 +1,52 @@
+//--------------------------------------------------------------------------
+/*! \file bitmask_optimised_wide_rows/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "bitmask_optimised_wide_rows_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, BitmaskOptimisedWideRows)
+{
+    // Calculate how many presynaptic neurons connect to each postsynaptic neuron
+    unsigned int numConnections[150];
+    for(unsigned int j = 0; j < 150; j++) {
+        numConnections[j] = 0;
+        for(unsigned int i = 0; i < 10; i++) {
+            if(j < 128 || ((i + j) % 3) == 0) {
+                numConnections[j]++;
+            }
+        }
+    }
+
+    for(unsigned int t = 0; t < 10; t++) {
+        StepGeNN();
+
+        // Every presynaptic neuron spikes every timestep so, once input has arrived, 
+        // each postsynaptic neuron should receive one unit of input per connection
+        if(t > 1) {
+            pullxPostFromDevice();
+            for(unsigned int j = 0; j < 150; j++) {
+                ASSERT_EQ(xPost[j], (scalar)numConnections[j]);
+            }
+        }
+    }
+}
@@ -0,0 +1,89 @@
+//--------------------------------------------------------------------------
+/*! \file dynamic_params/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 1, 1);
+
+    SET_SIM_CODE("$(x) += $(a) + $(Isyn);\n");
+
+    SET_PARAM_NAMES({"a"});
+    SET_VARS({{"x", "scalar"}});
+};
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// CS
+//----------------------------------------------------------------------------
+class CS : public CurrentSourceModels::Base
+{
+public:
+    DECLARE_MODEL(CS, 1, 0);
+
+    SET_INJECTION_CODE("$(injectCurrent, $(amp));\n");
+
+    SET_PARAM_NAMES({"amp"});
+};
+IMPLEMENT_MODEL(CS);
+
+//----------------------------------------------------------------------------
+// WeightUpdate
+//----------------------------------------------------------------------------
+class WeightUpdate : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(WeightUpdate, 1, 0, 0, 0);
+
+    SET_SYNAPSE_DYNAMICS_CODE("$(addToInSyn, $(w));\n");
+
+    SET_PARAM_NAMES({"w"});
+};
+IMPLEMENT_MODEL(WeightUpdate);
+
+void modelDefinition(ModelSpec &model)
+{
+#ifdef CL_HPP_TARGET_OPENCL_VERSION
+    if(std::getenv("OPENCL_DEVICE") != nullptr) {
+        GENN_PREFERENCES.deviceSelectMethod = DeviceSelect::MANUAL;
+        GENN_PREFERENCES.manualDeviceID = std::atoi(std::getenv("OPENCL_DEVICE"));
+    }
+    if(std::getenv("OPENCL_PLATFORM") != nullptr) {
+        GENN_PREFERENCES.manualPlatformID = std::atoi(std::getenv("OPENCL_PLATFORM"));
+    }
+#endif
+    model.setDT(1.0);
+    model.setName("dynamic_params");
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("pre", 1, {}, {});
+
+    // Two populations with the same model, one with a dynamic parameter
+    // **NOTE** which parameters are dynamic is hashed so these end up in separate merged groups
+    auto *pop1 = model.addNeuronPopulation<Neuron>("pop1", 10, Neuron::ParamValues(1.0), Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("pop2", 10, Neuron::ParamValues(2.0), Neuron::VarValues(0.0));
+    pop1->setParamDynamic("a");
+
+    // Current source with dynamic amplitude
+    auto *cs = model.addCurrentSource<CS>("cs", "pop1", CS::ParamValues(0.0), {});
+    cs->setParamDynamic("amp");
+
+    // Synapse group with dynamic weight
+    auto *syn = model.addSynapsePopulation<WeightUpdate, PostsynapticModels::DeltaCurr>(
+        "syn", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "pre", "pop2",
+        WeightUpdate::ParamValues(0.0), {},
+        {}, {});
+    syn->setWUParamDynamic("w");
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,49 @@
+//--------------------------------------------------------------------------
+/*! \file dynamic_params/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C include
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "dynamic_params_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+TEST_F(SimulationTest, DynamicParams)
+{
+    // Simulate with parameter values model was built with
+    for(int i = 0; i < 10; i++) {
+        StepGeNN();
+    }
+    pullxpop1FromDevice();
+    pullxpop2FromDevice();
+    for(int j = 0; j < 10; j++) {
+        ASSERT_FLOAT_EQ(xpop1[j], 10.0f);
+        ASSERT_FLOAT_EQ(xpop2[j], 20.0f);
+    }
+
+    // Change dynamic parameters
+    setapop1(3.0f);
+    setampcs(0.5f);
+    setwsyn(1.0f);
+
+    // Simulate again - synapse dynamics add w to pop2's input every timestep
+    for(int i = 0; i < 10; i++) {
+        StepGeNN();
+    }
+    pullxpop1FromDevice();
+    pullxpop2FromDevice();
+    for(int j = 0; j < 10; j++) {
+        ASSERT_FLOAT_EQ(xpop1[j], 45.0f);
+        ASSERT_FLOAT_EQ(xpop2[j], 50.0f);
+    }
+}
@@ -0,0 +1,86 @@
+//--------------------------------------------------------------------------
+/*! \file lazy_synapse_dynamics/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// EagerDecay
+//----------------------------------------------------------------------------
+class EagerDecay : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(EagerDecay, 1, 1, 0, 0);
+
+    SET_PARAM_NAMES({"tau"});
+    SET_VARS({{"g", "scalar"}});
+
+    SET_SIM_CODE("$(g) += 1.0;\n");
+    SET_LEARN_POST_CODE("$(g) -= 0.5;\n");
+    SET_SYNAPSE_DYNAMICS_CODE("$(g) *= exp(-DT / $(tau));\n");
+};
+IMPLEMENT_MODEL(EagerDecay);
+
+//----------------------------------------------------------------------------
+// LazyDecay
+//----------------------------------------------------------------------------
+class LazyDecay : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(LazyDecay, 1, 1, 0, 0);
+
+    SET_PARAM_NAMES({"tau"});
+    SET_VARS({{"g", "scalar"}});
+
+    SET_SIM_CODE("$(g) += 1.0;\n");
+    SET_LEARN_POST_CODE("$(g) -= 0.5;\n");
+    SET_LAZY_SYNAPSE_DYNAMICS_CODE("$(g) *= exp(-$(elapsed) / $(tau));\n");
+};
+IMPLEMENT_MODEL(LazyDecay);
+
+void modelDefinition(ModelSpec &model)
+{
+#ifdef CL_HPP_TARGET_OPENCL_VERSION
+    if(std::getenv("OPENCL_DEVICE") != nullptr) {
+        GENN_PREFERENCES.deviceSelectMethod = DeviceSelect::MANUAL;
+        GENN_PREFERENCES.manualDeviceID = std::atoi(std::getenv("OPENCL_DEVICE"));
+    }
+    if(std::getenv("OPENCL_PLATFORM") != nullptr) {
+        GENN_PREFERENCES.manualPlatformID = std::atoi(std::getenv("OPENCL_PLATFORM"));
+    }
+#endif
+    model.setSeed(1234);
+    model.setDT(1.0);
+    model.setName("lazy_synapse_dynamics");
+
+    NeuronModels::PoissonNew::ParamValues preParams(20.0);  // 0 - rate [hz]
+    NeuronModels::PoissonNew::ParamValues postParams(10.0); // 0 - rate [hz]
+    NeuronModels::PoissonNew::VarValues poissonInit(0.0);   // 0 - time to spike [ms]
+    model.addNeuronPopulation<NeuronModels::PoissonNew>("Pre", 20, preParams, poissonInit);
+    model.addNeuronPopulation<NeuronModels::PoissonNew>("Post", 20, postParams, poissonInit);
+
+    // Eager and lazy synapse groups with identical dense and sparse connectivity
+    EagerDecay::ParamValues params(20.0);   // 0 - tau [ms]
+    EagerDecay::VarValues init(0.0);        // 0 - g
+    model.addSynapsePopulation<EagerDecay, PostsynapticModels::DeltaCurr>(
+        "EagerDense", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        params, init, {}, {});
+    model.addSynapsePopulation<LazyDecay, PostsynapticModels::DeltaCurr>(
+        "LazyDense", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        params, init, {}, {});
+    model.addSynapsePopulation<EagerDecay, PostsynapticModels::DeltaCurr>(
+        "EagerSparse", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        params, init, {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+    model.addSynapsePopulation<LazyDecay, PostsynapticModels::DeltaCurr>(
+        "LazySparse", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        params, init, {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,67 @@
+//--------------------------------------------------------------------------
+/*! \file lazy_synapse_dynamics/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "lazy_synapse_dynamics_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, LazySynapseDynamics)
+{
+    // Weights only change when synapses are touched by a pre or postsynaptic spike so,
+    // without lazy synapse dynamics bringing the rest up to date when they are pulled, they would diverge
+    // **NOTE** stepTime is called directly as StepGeNN pulls all state and would bring all lazy synapses up to date every timestep
+    for(unsigned int i = 0; i < 200; i++) {
+        stepTime();
+
+        // Overwrite weights without pulling them first
+        // **NOTE** pushed weights are the state at the current time so lazy synapses must not decay them from when they were last touched
+        if(i == 109) {
+            std::fill_n(gEagerDense, 20 * 20, 1.0);
+            std::fill_n(gLazyDense, 20 * 20, 1.0);
+            std::fill_n(gEagerSparse, 20 * maxRowLengthEagerSparse, 1.0);
+            std::fill_n(gLazySparse, 20 * maxRowLengthLazySparse, 1.0);
+            pushEagerDenseStateToDevice();
+            pushLazyDenseStateToDevice();
+            pushEagerSparseStateToDevice();
+            pushLazySparseStateToDevice();
+        }
+
+        // Periodically compare weights
+        if((i % 20) == 19) {
+            pullEagerDenseStateFromDevice();
+            pullLazyDenseStateFromDevice();
+            pullEagerSparseStateFromDevice();
+            pullLazySparseStateFromDevice();
+
+            for(unsigned int j = 0; j < (20 * 20); j++) {
+                ASSERT_NEAR(gEagerDense[j], gLazyDense[j], 1e-4);
+            }
+            for(unsigned int j = 0; j < 20; j++) {
+                ASSERT_NEAR(gEagerSparse[j * maxRowLengthEagerSparse], gLazySparse[j * maxRowLengthLazySparse], 1e-4);
+            }
+        }
+    }
+
+    // Check weights have actually been updated
+    EXPECT_TRUE(std::any_of(&gLazyDense[0], &gLazyDense[20 * 20], [](scalar g){ return g != 0.0; }));
+}
@@ -0,0 +1,122 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_var_elimination/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 5);
+
+    SET_SIM_CODE("$(V) += $(a) * $(b);\n");
+
+    SET_VARS({{"V", "scalar"}, {"a", "scalar", VarAccess::READ_ONLY}, {"b", "scalar", VarAccess::READ_ONLY},
+              {"unused", "scalar"}, {"retained", "scalar"}});
+};
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// Accumulator
+//----------------------------------------------------------------------------
+class Accumulator : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Accumulator, 0, 1);
+
+    SET_SIM_CODE("$(V) += $(Isyn);\n");
+
+    SET_VARS({{"V", "scalar"}});
+};
+IMPLEMENT_MODEL(Accumulator);
+
+//----------------------------------------------------------------------------
+// Current
+//----------------------------------------------------------------------------
+class Current : public CurrentSourceModels::Base
+{
+public:
+    DECLARE_MODEL(Current, 0, 2);
+
+    SET_INJECTION_CODE("$(injectCurrent, $(amp));\n");
+
+    SET_VARS({{"amp", "scalar", VarAccess::READ_ONLY}, {"unused", "scalar"}});
+};
+IMPLEMENT_MODEL(Current);
+
+//----------------------------------------------------------------------------
+// WeightUpdate
+//----------------------------------------------------------------------------
+class WeightUpdate : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(WeightUpdate, 0, 2, 0, 0);
+
+    SET_SYNAPSE_DYNAMICS_CODE("$(addToInSyn, $(g));\n");
+
+    SET_VARS({{"g", "scalar", VarAccess::READ_ONLY}, {"unused", "scalar"}});
+};
+IMPLEMENT_MODEL(WeightUpdate);
+
+//----------------------------------------------------------------------------
+// Postsynaptic
+//----------------------------------------------------------------------------
+class Postsynaptic : public PostsynapticModels::Base
+{
+public:
+    DECLARE_MODEL(Postsynaptic, 0, 2);
+
+    SET_APPLY_INPUT_CODE("$(Isyn) += $(inSyn) * $(scale);\n");
+    SET_DECAY_CODE("$(inSyn) = 0.0;\n");
+
+    SET_VARS({{"scale", "scalar", VarAccess::READ_ONLY}, {"unused", "scalar"}});
+};
+IMPLEMENT_MODEL(Postsynaptic);
+
+void modelDefinition(ModelSpec &model)
+{
+#ifdef CL_HPP_TARGET_OPENCL_VERSION
+    if(std::getenv("OPENCL_DEVICE") != nullptr) {
+        GENN_PREFERENCES.deviceSelectMethod = DeviceSelect::MANUAL;
+        GENN_PREFERENCES.manualDeviceID = std::atoi(std::getenv("OPENCL_DEVICE"));
+    }
+    if(std::getenv("OPENCL_PLATFORM") != nullptr) {
+        GENN_PREFERENCES.manualPlatformID = std::atoi(std::getenv("OPENCL_PLATFORM"));
+    }
+#endif
+    model.setDT(1.0);
+    model.setName("neuron_var_elimination");
+    model.setEliminateVars(true);
+
+    // Populations are merged so folded values of 'a' are heterogeneous but 'b' is homogeneous
+    NeuronGroup *pop0 = model.addNeuronPopulation<Neuron>("Pop0", 10, {}, Neuron::VarValues(0.0, 1.0, 2.0, 0.0, 5.0));
+    NeuronGroup *pop1 = model.addNeuronPopulation<Neuron>("Pop1", 10, {}, Neuron::VarValues(0.0, 3.0, 2.0, 0.0, 7.0));
+    pop0->setVarRetained("retained", true);
+    pop1->setVarRetained("retained", true);
+
+    // Populations, current sources and synapse groups are merged so folded values
+    // of 'amp' and 'g' are heterogeneous but 'scale' is homogeneous
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 1, {}, {});
+    model.addNeuronPopulation<Accumulator>("Pop2", 10, {}, Accumulator::VarValues(0.0));
+    model.addNeuronPopulation<Accumulator>("Pop3", 10, {}, Accumulator::VarValues(0.0));
+    model.addCurrentSource<Current>("CS2", "Pop2", {}, Current::VarValues(1.0, 0.0));
+    model.addCurrentSource<Current>("CS3", "Pop3", {}, Current::VarValues(2.0, 0.0));
+    model.addSynapsePopulation<WeightUpdate, Postsynaptic>(
+        "Syn2", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "Pop2",
+        {}, WeightUpdate::VarValues(0.5, 0.0),
+        {}, Postsynaptic::VarValues(2.0, 0.0));
+    model.addSynapsePopulation<WeightUpdate, Postsynaptic>(
+        "Syn3", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "Pop3",
+        {}, WeightUpdate::VarValues(0.25, 0.0),
+        {}, Postsynaptic::VarValues(2.0, 0.0));
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,75 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_var_elimination/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "neuron_var_elimination_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+// **NOTE** if any of these variables hadn't been eliminated or
+// folded into code, these would conflict with definitions.h
+int aPop0 = 0;
+int bPop0 = 0;
+int unusedPop0 = 0;
+int aPop1 = 0;
+int bPop1 = 0;
+int unusedPop1 = 0;
+int ampCS2 = 0;
+int unusedCS2 = 0;
+int ampCS3 = 0;
+int unusedCS3 = 0;
+int gSyn2 = 0;
+int unusedSyn2 = 0;
+int scaleSyn2 = 0;
+int gSyn3 = 0;
+int unusedSyn3 = 0;
+int scaleSyn3 = 0;
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, NeuronVarElimination)
+{
+    // Retained variables should still be accessible
+    pullretainedPop0FromDevice();
+    pullretainedPop1FromDevice();
+    for(unsigned int i = 0; i < 10; i++) {
+        ASSERT_EQ(retainedPop0[i], 5.0f);
+        ASSERT_EQ(retainedPop1[i], 7.0f);
+    }
+
+    for(unsigned int t = 0; t < 10; t++) {
+        StepGeNN();
+
+        // Each timestep, V should increase by a * b
+        pullVPop0FromDevice();
+        pullVPop1FromDevice();
+        for(unsigned int i = 0; i < 10; i++) {
+            ASSERT_EQ(VPop0[i], 2.0f * (scalar)(t + 1));
+            ASSERT_EQ(VPop1[i], 6.0f * (scalar)(t + 1));
+        }
+
+        // Each timestep, V should increase by amp + (g * scale)
+        pullVPop2FromDevice();
+        pullVPop3FromDevice();
+        for(unsigned int i = 0; i < 10; i++) {
+            ASSERT_EQ(VPop2[i], 2.0f * (scalar)(t + 1));
+            ASSERT_EQ(VPop3[i], 2.5f * (scalar)(t + 1));
+        }
+    }
+}
@@ -0,0 +1,72 @@
+//--------------------------------------------------------------------------
+/*! \file pre_ind_in_post_learn_sparse/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(V) += 1.0;\n");
+
+    SET_THRESHOLD_CONDITION_CODE("$(V) >= 1.0");
+
+    SET_VARS({{"V", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 2);
+
+    SET_VARS({{"pre", "unsigned int"}, {"post", "unsigned int"}});
+
+    SET_LEARN_POST_CODE(
+        "$(pre) = $(id_pre);\n"
+        "$(post) = $(id_post);\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+void modelDefinition(ModelSpec &model)
+{
+    // Store presynaptic indices column-major for postsynaptic learning
+    GENN_PREFERENCES.postsynapticPreInd = true;
+
+    model.setSeed(1234);
+    model.setDT(0.1);
+    model.setName("pre_ind_in_post_learn_sparse");
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 100, {}, {});
+    model.addNeuronPopulation<Neuron>("Post", 50, {}, Neuron::VarValues(0.0));
+
+    // Both a ragged and a fully-connected group so rows have varying and equal lengths
+    InitSparseConnectivitySnippet::FixedProbability::ParamValues fixedProb(0.1); // 0 - prob
+    InitSparseConnectivitySnippet::FixedProbability::ParamValues fullProb(1.0); // 0 - prob
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Ragged", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, WeightUpdateModel::VarValues(0, 0),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProb));
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Full", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, WeightUpdateModel::VarValues(0, 0),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fullProb));
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,56 @@
+//--------------------------------------------------------------------------
+/*! \file pre_ind_in_post_learn_sparse/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "pre_ind_in_post_learn_sparse_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, PreIndInPostLearnSparse)
+{
+    // Every postsynaptic neuron spikes in the first timestep so, after two steps, every synapse has learnt
+    StepGeNN();
+    StepGeNN();
+
+    pullRaggedConnectivityFromDevice();
+    pullRaggedStateFromDevice();
+    pullFullConnectivityFromDevice();
+    pullFullStateFromDevice();
+
+    // Check each synapse has learnt the indices of the neurons it connects
+    unsigned int numRaggedSynapses = 0;
+    for(unsigned int i = 0; i < 100; i++) {
+        for(unsigned int s = 0; s < rowLengthRagged[i]; s++) {
+            const unsigned int idx = (i * maxRowLengthRagged) + s;
+            EXPECT_EQ(preRagged[idx], i);
+            EXPECT_EQ(postRagged[idx], indRagged[idx]);
+            numRaggedSynapses++;
+        }
+
+        for(unsigned int s = 0; s < rowLengthFull[i]; s++) {
+            const unsigned int idx = (i * maxRowLengthFull) + s;
+            EXPECT_EQ(preFull[idx], i);
+            EXPECT_EQ(postFull[idx], indFull[idx]);
+        }
+        EXPECT_EQ(rowLengthFull[i], 50u);
+    }
+    EXPECT_GT(numRaggedSynapses, 0u);
+}
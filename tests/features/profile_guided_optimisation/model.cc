@@ -0,0 +1,90 @@
+//--------------------------------------------------------------------------
+/*! \file profile_guided_optimisation/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 2);
+
+    SET_SIM_CODE(
+        "$(V) += 1.0;\n"
+        "$(x) += $(Isyn);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("$(V) >= 1.0");
+
+    SET_RESET_CODE("$(V) = 0.0;\n");
+
+    SET_VARS({{"V", "scalar"}, {"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 1);
+
+    SET_VARS({{"g", "scalar"}});
+
+    SET_SIM_CODE("$(addToInSyn, $(g));\n");
+    SET_LEARN_POST_CODE("$(g) += 1.0;\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+//----------------------------------------------------------------------------
+// DynamicsWeightUpdateModel
+//----------------------------------------------------------------------------
+class DynamicsWeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(DynamicsWeightUpdateModel, 0, 1);
+
+    SET_VARS({{"g", "scalar", VarAccess::READ_ONLY}});
+
+    SET_SYNAPSE_DYNAMICS_CODE("$(addToInSyn, $(g));\n");
+};
+
+IMPLEMENT_MODEL(DynamicsWeightUpdateModel);
+
+void modelDefinition(ModelSpec &model)
+{
+    // Build generated code using profile collected by simulating model for 100 timesteps
+    GENN_PREFERENCES.profileGuidedOptimisationTimesteps = 100;
+
+    model.setDT(1.0);
+    model.setName("profile_guided_optimisation");
+
+    auto *pre = model.addNeuronPopulation<Neuron>("Pre", 10, {}, Neuron::VarValues(0.0, 0.0));
+    model.addNeuronPopulation<Neuron>("Post", 10, {}, Neuron::VarValues(0.0, 0.0));
+    model.addNeuronPopulation<Neuron>("PostDynamics", 10, {}, Neuron::VarValues(0.0, 0.0));
+    pre->setSpikeRecordingEnabled(true);
+
+    // Sparse synapse group with presynaptic and postsynaptic updates as well as connectivity and sparse variable initialisation
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, WeightUpdateModel::VarValues(2.0),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+
+    // Dense synapse group with synapse dynamics and dense variable initialisation
+    model.addSynapsePopulation<DynamicsWeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "SynDynamics", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "PostDynamics",
+        {}, DynamicsWeightUpdateModel::VarValues(0.5),
+        {}, {});
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,43 @@
+//--------------------------------------------------------------------------
+/*! \file profile_guided_optimisation/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "profile_guided_optimisation_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+TEST_F(SimulationTest, ProfileGuidedOptimisation)
+{
+    // All neurons spike every timestep so, from the second timestep, each postsynaptic neuron
+    // receives its one-to-one input weight which, after being used, is incremented by learning
+    allocateRecordingBuffers(10);
+    for(int i = 0; i < 10; i++) {
+        StepGeNN();
+    }
+
+    pullPostStateFromDevice();
+    pullPostDynamicsStateFromDevice();
+    pullSynStateFromDevice();
+    for(unsigned int j = 0; j < 10; j++) {
+        ASSERT_FLOAT_EQ(xPost[j], 54.0f);
+        ASSERT_FLOAT_EQ(xPostDynamics[j], 50.0f);
+        ASSERT_FLOAT_EQ(gSyn[j], 11.0f);
+    }
+
+    // Check presynaptic neurons' spikes were recorded every timestep
+    pullRecordingBuffersFromDevice();
+    for(unsigned int i = 0; i < 10; i++) {
+        ASSERT_EQ(recordSpkPre[i], 0x3FFu);
+    }
+}
@@ -0,0 +1,36 @@
+//--------------------------------------------------------------------------
+/*! \file split_modules/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "split_modules_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+TEST_F(SimulationTest, SplitModules)
+{
+    // All neurons spike every timestep so, from the second timestep, each postsynaptic neuron
+    // receives its one-to-one input weight which, after being used, is incremented by learning
+    for(int i = 0; i < 10; i++) {
+        StepGeNN();
+    }
+
+    pullPostStateFromDevice();
+    pullPostDynamicsStateFromDevice();
+    pullSynStateFromDevice();
+    for(unsigned int j = 0; j < 10; j++) {
+        ASSERT_FLOAT_EQ(xPost[j], 54.0f);
+        ASSERT_FLOAT_EQ(xPostDynamics[j], 50.0f);
+        ASSERT_FLOAT_EQ(gSyn[j], 11.0f);
+    }
+}
@@ -0,0 +1,96 @@
+//--------------------------------------------------------------------------
+/*! \file toeplitz_conv2d_channels/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// PreNeuron
+//----------------------------------------------------------------------------
+//! Neuron which spikes in the first timestep if its index is a multiple of three
+class PreNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PreNeuron, 0, 1);
+
+    SET_SIM_CODE("$(V) += 1.0;\n");
+    SET_THRESHOLD_CONDITION_CODE("$(V) >= 1.0 && ($(id) % 3) == 0");
+
+    SET_VARS({{"V", "scalar"}});
+};
+IMPLEMENT_MODEL(PreNeuron);
+
+//----------------------------------------------------------------------------
+// PostNeuron
+//----------------------------------------------------------------------------
+class PostNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PostNeuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+IMPLEMENT_MODEL(PostNeuron);
+
+void modelDefinition(ModelSpec &model)
+{
+#ifdef CL_HPP_TARGET_OPENCL_VERSION
+    if(std::getenv("OPENCL_DEVICE") != nullptr) {
+        GENN_PREFERENCES.deviceSelectMethod = DeviceSelect::MANUAL;
+        GENN_PREFERENCES.manualDeviceID = std::atoi(std::getenv("OPENCL_DEVICE"));
+    }
+    if(std::getenv("OPENCL_PLATFORM") != nullptr) {
+        GENN_PREFERENCES.manualPlatformID = std::atoi(std::getenv("OPENCL_PLATFORM"));
+    }
+#endif
+    model.setDT(1.0);
+    model.setName("toeplitz_conv2d_channels");
+
+    // Synapse parameters
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(
+        uninitialisedVar());    // 0 - Wij (nA)
+
+    model.addNeuronPopulation<PreNeuron>("Pre", 8 * 8 * 2, {}, PreNeuron::VarValues(0.0));
+    model.addNeuronPopulation<PostNeuron>("PostConv3", 8 * 8 * 3, {}, PostNeuron::VarValues(0.0));
+    model.addNeuronPopulation<PostNeuron>("PostConv5", 8 * 8 * 3, {}, PostNeuron::VarValues(0.0));
+    model.addNeuronPopulation<PostNeuron>("PostPool", 4 * 4 * 3, {}, PostNeuron::VarValues(0.0));
+
+    // **NOTE** 3x3 and 5x5 convolutions are merged so have heterogeneous kernel sizes
+    InitToeplitzConnectivitySnippet::Conv2D::ParamValues conv3Params(
+        3, 3,       // conv_kh, conv_kw
+        8, 8, 2,    // conv_ih, conv_iw, conv_ic
+        8, 8, 3);   // conv_oh, conv_ow, conv_oc
+    InitToeplitzConnectivitySnippet::Conv2D::ParamValues conv5Params(
+        5, 5,       // conv_kh, conv_kw
+        8, 8, 2,    // conv_ih, conv_iw, conv_ic
+        8, 8, 3);   // conv_oh, conv_ow, conv_oc
+    InitToeplitzConnectivitySnippet::AvgPoolConv2D::ParamValues poolParams(
+        3, 3,       // conv_kh, conv_kw
+        2, 2,       // pool_kh, pool_kw
+        2, 2,       // pool_sh, pool_sw
+        8, 8, 2,    // pool_ih, pool_iw, pool_ic
+        4, 4, 3);   // conv_oh, conv_ow, conv_oc
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynConv3", SynapseMatrixType::TOEPLITZ_KERNELG, NO_DELAY, "Pre", "PostConv3",
+        {}, staticSynapseInit,
+        {}, {},
+        initToeplitzConnectivity<InitToeplitzConnectivitySnippet::Conv2D>(conv3Params));
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynConv5", SynapseMatrixType::TOEPLITZ_KERNELG, NO_DELAY, "Pre", "PostConv5",
+        {}, staticSynapseInit,
+        {}, {},
+        initToeplitzConnectivity<InitToeplitzConnectivitySnippet::Conv2D>(conv5Params));
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynPool", SynapseMatrixType::TOEPLITZ_KERNELG, NO_DELAY, "Pre", "PostPool",
+        {}, staticSynapseInit,
+        {}, {},
+        initToeplitzConnectivity<InitToeplitzConnectivitySnippet::AvgPoolConv2D>(poolParams));
+}
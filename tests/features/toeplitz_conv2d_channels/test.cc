@@ -0,0 +1,95 @@
+//--------------------------------------------------------------------------
+/*! \file toeplitz_conv2d_channels/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "toeplitz_conv2d_channels_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+// Calculate expected output of (optionally pooled) convolution of 8x8x2 input, where every third neuron spikes, with kernel
+std::vector<scalar> getExpectedOutput(const scalar *kernel, int kernSize, int pool, int outSize)
+{
+    const int pad = ((8 / pool) + kernSize - 1 - outSize) / 2;
+    std::vector<scalar> output(outSize * outSize * 3, 0.0f);
+    for(int i = 0; i < (8 * 8 * 2); i += 3) {
+        const int preRow = ((i / 2) / 8) / pool;
+        const int preCol = ((i / 2) % 8) / pool;
+        const int preChan = i % 2;
+        for(int kernRow = 0; kernRow < kernSize; kernRow++) {
+            for(int kernCol = 0; kernCol < kernSize; kernCol++) {
+                const int postRow = preRow + kernRow - pad;
+                const int postCol = preCol + kernCol - pad;
+                if(postRow >= 0 && postCol >= 0 && postRow < outSize && postCol < outSize) {
+                    for(int outChan = 0; outChan < 3; outChan++) {
+                        const int flipKernRow = kernSize - kernRow - 1;
+                        const int flipKernCol = kernSize - kernCol - 1;
+                        output[(((postRow * outSize) + postCol) * 3) + outChan] += kernel[(((((flipKernRow * kernSize) + flipKernCol) * 2) + preChan) * 3) + outChan];
+                    }
+                }
+            }
+        }
+    }
+    return output;
+}
+}
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Fill kernels with distinct values
+        for(unsigned int i = 0; i < (3 * 3 * 2 * 3); i++) {
+            gSynConv3[i] = (scalar)((i % 7) - 3);
+            gSynPool[i] = (scalar)((i % 5) - 2);
+        }
+        for(unsigned int i = 0; i < (5 * 5 * 2 * 3); i++) {
+            gSynConv5[i] = (scalar)((i % 11) - 5);
+        }
+    }
+};
+
+TEST_F(SimTest, ToeplitzConv2DChannels)
+{
+    // Simulate one timestep for presynaptic neurons to spike and another for their input to arrive
+    StepGeNN();
+    StepGeNN();
+
+    pullxPostConv3FromDevice();
+    pullxPostConv5FromDevice();
+    pullxPostPoolFromDevice();
+
+    const auto conv3Output = getExpectedOutput(gSynConv3, 3, 1, 8);
+    const auto conv5Output = getExpectedOutput(gSynConv5, 5, 1, 8);
+    const auto poolOutput = getExpectedOutput(gSynPool, 3, 2, 4);
+    for(unsigned int i = 0; i < (8 * 8 * 3); i++) {
+        ASSERT_EQ(xPostConv3[i], conv3Output[i]);
+        ASSERT_EQ(xPostConv5[i], conv5Output[i]);
+    }
+    for(unsigned int i = 0; i < (4 * 4 * 3); i++) {
+        ASSERT_EQ(xPostPool[i], poolOutput[i]);
+    }
+}
@@ -0,0 +1,41 @@
+//--------------------------------------------------------------------------
+/*! \file trace/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x) += DT;\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    // Record time taken to update each merged group and each population within it
+    GENN_PREFERENCES.enableTrace = true;
+
+    model.setDT(0.1);
+    model.setName("trace");
+
+    // Add two identical populations which will be merged
+    model.addNeuronPopulation<Neuron>("Pop1", 10, {}, Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("Pop2", 20, {}, Neuron::VarValues(0.0));
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,74 @@
+//--------------------------------------------------------------------------
+/*! \file trace/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "trace_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+protected:
+    //--------------------------------------------------------------------------
+    // Protected methods
+    //--------------------------------------------------------------------------
+    // Write trace and read it back into a string
+    std::string readTrace()
+    {
+        writeTrace("trace.json");
+
+        std::ifstream traceFile("trace.json");
+        std::stringstream traceStream;
+        traceStream << traceFile.rdbuf();
+        return traceStream.str();
+    }
+
+    // Count occurrences of needle in haystack
+    size_t count(const std::string &haystack, const std::string &needle)
+    {
+        size_t n = 0;
+        for(size_t pos = haystack.find(needle); pos != std::string::npos; pos = haystack.find(needle, pos + needle.size())) {
+            n++;
+        }
+        return n;
+    }
+};
+
+TEST_F(SimTest, Trace)
+{
+    // Discard initialisation events
+    clearTrace();
+
+    // Simulate 10 timesteps
+    for(unsigned int i = 0; i < 10; i++) {
+        StepGeNN();
+    }
+
+    // Check an event was recorded for each timestep's neuron update and for each population within it
+    const std::string trace = readTrace();
+    EXPECT_EQ(count(trace, "{\"name\": \"neuronUpdate\", \"cat\": \"neuronUpdate\""), 10);
+    EXPECT_EQ(count(trace, "{\"name\": \"Pop1\", \"cat\": \"neuronUpdate\""), 10);
+    EXPECT_EQ(count(trace, "{\"name\": \"Pop2\", \"cat\": \"neuronUpdate\""), 10);
+    EXPECT_EQ(count(trace, "\"args\": {\"timestep\": 9}"), count(trace, "\"args\": {\"timestep\": 0}"));
+
+    // Check trace is empty after clearing
+    clearTrace();
+    EXPECT_EQ(count(readTrace(), "\"name\""), 0);
+}
@@ -0,0 +1,87 @@
+//--------------------------------------------------------------------------
+/*! \file wu_var_reduced_precision/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Pre
+//----------------------------------------------------------------------------
+//! Neuron which spikes every timestep
+class Pre : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Pre, 0, 1);
+
+    SET_SIM_CODE("$(V) += 1.0;\n");
+    SET_THRESHOLD_CONDITION_CODE("$(V) >= 1.0");
+    SET_RESET_CODE("$(V) = 0.0;\n");
+
+    SET_VARS({{"V", "scalar"}});
+};
+IMPLEMENT_MODEL(Pre);
+
+//----------------------------------------------------------------------------
+// Post
+//----------------------------------------------------------------------------
+class Post : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Post, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+IMPLEMENT_MODEL(Post);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModels
+//----------------------------------------------------------------------------
+// Weight update models which deliver their weight and then increment it,
+// each storing the weight using a different reduced-precision type
+#define DECLARE_REDUCED_PRECISION_WUM(NAME, TYPE)                           \
+class NAME : public WeightUpdateModels::Base                                \
+{                                                                           \
+public:                                                                     \
+    DECLARE_WEIGHT_UPDATE_MODEL(NAME, 0, 1, 0, 0);                          \
+    SET_VARS({{"g", TYPE}});                                                \
+    SET_SIM_CODE("$(addToInSyn, $(g));\n"                                   \
+                 "$(g) += 0.25;\n");                                        \
+};                                                                          \
+IMPLEMENT_MODEL(NAME)
+
+DECLARE_REDUCED_PRECISION_WUM(HalfWUM, "half");
+DECLARE_REDUCED_PRECISION_WUM(BFloat16WUM, "bfloat16");
+DECLARE_REDUCED_PRECISION_WUM(Int8Q4WUM, "int8_q4");
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(1.0);
+    model.setName("wu_var_reduced_precision");
+
+    model.addNeuronPopulation<Pre>("Pre", 1, {}, Pre::VarValues(0.0));
+    model.addNeuronPopulation<Post>("PostHalf", 1, {}, Post::VarValues(0.0));
+    model.addNeuronPopulation<Post>("PostBFloat16", 1, {}, Post::VarValues(0.0));
+    model.addNeuronPopulation<Post>("PostInt8Q4", 1, {}, Post::VarValues(0.0));
+
+    model.addSynapsePopulation<HalfWUM, PostsynapticModels::DeltaCurr>(
+        "SynHalf", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "PostHalf",
+        {}, HalfWUM::VarValues(0.1),
+        {}, {});
+    model.addSynapsePopulation<BFloat16WUM, PostsynapticModels::DeltaCurr>(
+        "SynBFloat16", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "PostBFloat16",
+        {}, BFloat16WUM::VarValues(0.1),
+        {}, {});
+    model.addSynapsePopulation<Int8Q4WUM, PostsynapticModels::DeltaCurr>(
+        "SynInt8Q4", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "PostInt8Q4",
+        {}, Int8Q4WUM::VarValues(0.1),
+        {}, {});
+
+    model.setPrecision(GENN_FLOAT);
+}
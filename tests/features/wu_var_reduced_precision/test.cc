@@ -0,0 +1,70 @@
+//--------------------------------------------------------------------------
+/*! \file wu_var_reduced_precision/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "wu_var_reduced_precision_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, WUVarReducedPrecision)
+{
+    // Weights should only occupy their reduced-precision storage
+    ASSERT_EQ(sizeof(gSynHalf[0]), 2);
+    ASSERT_EQ(sizeof(gSynBFloat16[0]), 2);
+    ASSERT_EQ(sizeof(gSynInt8Q4[0]), 1);
+
+    // Initial weights should have been rounded to the nearest representable value
+    ASSERT_EQ((scalar)gSynHalf[0], 0.0999755859375f);
+    ASSERT_EQ((scalar)gSynBFloat16[0], 0.10009765625f);
+    ASSERT_EQ((scalar)gSynInt8Q4[0], 0.125f);
+
+    // Reference weights, updated on the host using the same types
+    half refHalf(0.1f);
+    bfloat16 refBFloat16(0.1f);
+    int8_q4 refInt8Q4(0.1f);
+    for(unsigned int t = 0; t < 100; t++) {
+        StepGeNN();
+
+        // Presynaptic spikes emitted in the previous timestep deliver the weight and then increment it
+        if(t > 0) {
+            pullxPostHalfFromDevice();
+            pullxPostBFloat16FromDevice();
+            pullxPostInt8Q4FromDevice();
+            ASSERT_EQ(xPostHalf[0], (scalar)refHalf);
+            ASSERT_EQ(xPostBFloat16[0], (scalar)refBFloat16);
+            ASSERT_EQ(xPostInt8Q4[0], (scalar)refInt8Q4);
+
+            refHalf += 0.25f;
+            refBFloat16 += 0.25f;
+            refInt8Q4 += 0.25f;
+        }
+
+        pullSynHalfStateFromDevice();
+        pullSynBFloat16StateFromDevice();
+        pullSynInt8Q4StateFromDevice();
+        ASSERT_EQ(gSynHalf[0].getBits(), refHalf.getBits());
+        ASSERT_EQ(gSynBFloat16[0].getBits(), refBFloat16.getBits());
+        ASSERT_EQ(gSynInt8Q4[0].getValue(), refInt8Q4.getValue());
+    }
+
+    // Fixed-point weight should have saturated at its largest representable value
+    ASSERT_EQ((scalar)gSynInt8Q4[0], 127.0f / 16.0f);
+}
@@ -6,15 +6,18 @@ REPORT=0
 # Variables containing build flags corresponding to various backends
 BUILD_FLAGS_SingleThreadedCPU=-c
 BUILD_FLAGS_OpenCL=-l
+BUILD_FLAGS_MultiThreadedCPU=-t
 
 # Parse command line arguments
 OPTIND=1
-while getopts "clrd" opt; do
+while getopts "cltrd" opt; do
     case "$opt" in
     c)  BACKENDS+=" CUDA"
         ;;
     l)  BACKENDS+=" OpenCL"
         ;;
+    t)  BACKENDS+=" MultiThreadedCPU"
+        ;;
     r) REPORT=1
         ;;
     d) source /opt/rh/devtoolset-6/enable
@@ -67,6 +67,116 @@ TEST(EnsureMathFunctionFtype, supportCodeFunc) {
     ASSERT_EQ(substitutedCode, "TestNamespace_supportCodeFunc(x);");
 }
 
+// Check that function names are only substituted where they are called
+TEST(RegexFuncSubstitute, Calls) {
+    std::string code = "sinf (x) + mysinf(x) + sinf2(x) + sinf";
+    ASSERT_TRUE(regexFuncSubstitute(code, "sinf", "sin"));
+    ASSERT_EQ(code, "sin (x) + mysinf(x) + sinf2(x) + sinf");
+    ASSERT_FALSE(regexFuncSubstitute(code, "cosf", "cos"));
+}
+
+// Check that variables separated by a single character are both substituted
+TEST(RegexVarSubstitute, Adjacent) {
+    std::string code = "a*a+_a+a_+a";
+    ASSERT_TRUE(regexVarSubstitute(code, "a", "b"));
+    ASSERT_EQ(code, "b*b+_a+a_+b");
+}
+
+// Check that multiple single-precision maths functions are all replaced
+TEST(EnsureMathFunctionFtype, Multiple) {
+    const std::string code = "expf(x)*powf(y, 2.0) + logf (z) + myexpf(1.0)";
+
+    const std::string substitutedCode = ensureFtype(code, "float");
+    ASSERT_EQ(substitutedCode, "exp(x)*pow(y, 2.0f) + log (z) + myexpf(1.0f)");
+}
+
+// Check that variables are substituted, with child substitutions taking precedence over parent
+// and references in parent substitutions being resolved from the parent
+TEST(Substitutions, Vars) {
+    Substitutions parent;
+    parent.addVarSubstitution("id", "i");
+    parent.addVarSubstitution("id_pre", "ipre");
+    parent.addVarSubstitution("id_post", "ipost");
+    parent.addVarSubstitution("V", "group->V[$(id)]");
+
+    Substitutions child(&parent);
+    child.addVarSubstitution("id", "j");
+    child.addVarSubstitution("id_syn", "($(id_pre) * 10) + $(id_post)");
+
+    std::string code = "$(V) = $(id_syn) + $(id)$(id);";
+    child.apply(code);
+    ASSERT_EQ(code, "group->V[i] = (ipre * 10) + ipost + jj;");
+}
+
+// Check that arguments are substituted into function templates with whitespace between them removed
+TEST(Substitutions, Funcs) {
+    Substitutions parent;
+    parent.addFuncSubstitution("addToInSyn", 1, "linSyn += $(0)");
+    parent.addFuncSubstitution("addToInSynDelay", 2, "denDelay[$(1)] += $(0)");
+    parent.addFuncSubstitution("gennrand_uniform", 0, "standardUniformDistribution($(rng))");
+    parent.addVarSubstitution("rng", "hostRNG");
+
+    Substitutions child(&parent);
+    child.addVarSubstitution("g", "group->g[syn]");
+
+    std::string code = "$(addToInSyn, $(g) * 2.0 * fmax(a, b));\n$(addToInSynDelay, $(g), 4);\n$(gennrand_uniform);";
+    child.apply(code);
+    ASSERT_EQ(code, "linSyn += group->g[syn]*2.0*fmax(a, b);\ndenDelay[4] += group->g[syn];\nstandardUniformDistribution(hostRNG);");
+}
+
+// Check that nested function calls are substituted
+TEST(Substitutions, NestedFuncs) {
+    Substitutions subs;
+    subs.addFuncSubstitution("max", 2, "fmax($(0), $(1))");
+    subs.addFuncSubstitution("min", 2, "fmin($(0), $(1))");
+
+    std::string code = "$(min, $(max, a, (b + c)), $(min, d, e))";
+    subs.apply(code);
+    ASSERT_EQ(code, "fmin(fmax(a, (b + c)), fmin(d, e))");
+
+    std::string otherCode = "x = $(max, y, 1.0);";
+    functionSubstitute(otherCode, "max", 2, "fmax($(0), $(1))");
+    ASSERT_EQ(otherCode, "x = fmax(y, 1.0);");
+}
+
+// Check that functions without arguments take precedence over variables with the same name
+TEST(Substitutions, FuncPrecedence) {
+    Substitutions parent;
+    parent.addFuncSubstitution("t", 0, "func()");
+
+    Substitutions child(&parent);
+    child.addVarSubstitution("t", "var");
+    child.addVarSubstitution("f", "fvar");
+    child.addFuncSubstitution("f", 1, "func($(0))");
+
+    std::string code = "$(t) + $(f) + $(f, 1)";
+    child.apply(code);
+    ASSERT_EQ(code, "func() + fvar + func(1)");
+}
+
+// Check that unknown references are left intact and then reported
+TEST(Substitutions, Unreplaced) {
+    Substitutions subs;
+    subs.addVarSubstitution("x", "X");
+    subs.addFuncSubstitution("f", 1, "F($(0))");
+
+    std::string code = "$(x) + $(y) + $(g, $(x)) + $(f, $(z)) + $( x) + $";
+    subs.apply(code);
+    ASSERT_EQ(code, "X + $(y) + $(g, X) + F($(z)) + $( x) + $");
+
+    try {
+        checkUnreplacedVariables(code, "test");
+        FAIL();
+    }
+    catch(const std::runtime_error &e) {
+        ASSERT_STREQ(e.what(), "The variables y, z were undefined in code test.");
+    }
+
+    code = "$(x)";
+    ASSERT_NO_THROW(subs.applyCheckUnreplaced(code, "test"));
+    ASSERT_EQ(code, "X");
+}
+
 //--------------------------------------------------------------------------
 // SingleValueSubstitutionTest
 //--------------------------------------------------------------------------
@@ -4,6 +4,40 @@
 // GeNN includes
 #include "modelSpecInternal.h"
 
+// GeNN code generator includes
+#include "code_generator/modelSpecMerged.h"
+
+// (Single-threaded CPU) backend includes
+#include "backend.h"
+
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+class EliminateVarsCS : public CurrentSourceModels::Base
+{
+    DECLARE_MODEL(EliminateVarsCS, 0, 4);
+
+    SET_INJECTION_CODE("$(injectCurrent, $(amp) * $(scale));\n");
+
+    SET_VARS({{"amp", "scalar", VarAccess::READ_ONLY}, {"scale", "scalar", VarAccess::READ_ONLY},
+              {"unused", "scalar"}, {"copied", "scalar"}});
+};
+IMPLEMENT_MODEL(EliminateVarsCS);
+
+class Copy : public CustomUpdateModels::Base
+{
+    DECLARE_CUSTOM_UPDATE_MODEL(Copy, 0, 1, 1);
+
+    SET_UPDATE_CODE("$(x) = $(a);\n");
+
+    SET_VARS({{"x", "scalar"}});
+    SET_VAR_REFS({{"a", "scalar", VarAccessMode::READ_ONLY}});
+};
+IMPLEMENT_MODEL(Copy);
+}   // Anonymous namespace
+
 //--------------------------------------------------------------------------
 // Tests
 //--------------------------------------------------------------------------
@@ -102,4 +136,70 @@ TEST(CurrentSource, InvalidName)
     }
     catch(const std::runtime_error &) {
     }
-}
\ No newline at end of file
+}
+
+TEST(CurrentSource, EliminateVars)
+{
+    ModelSpecInternal model;
+    model.setEliminateVars(true);
+
+    // Add three neuron groups to model
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 10, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons1", 10, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons2", 10, paramVals, varVals);
+
+    // Add current sources with different constant values for 'amp' and one with 'scale' initialised randomly
+    InitVarSnippet::Uniform::ParamValues dist(0.0, 1.0);
+    EliminateVarsCS::VarValues varValsA(1.0, 2.0, 0.0, 0.0);
+    EliminateVarsCS::VarValues varValsB(3.0, 2.0, 0.0, 0.0);
+    EliminateVarsCS::VarValues varValsC(1.0, initVar<InitVarSnippet::Uniform>(dist), 0.0, 0.0);
+    auto *cs0 = model.addCurrentSource<EliminateVarsCS>("CS0", "Neurons0", {}, varValsA);
+    auto *cs1 = model.addCurrentSource<EliminateVarsCS>("CS1", "Neurons1", {}, varValsB);
+    auto *cs2 = model.addCurrentSource<EliminateVarsCS>("CS2", "Neurons2", {}, varValsC);
+    cs0->setVarRetained("unused", true);
+    cs1->setVarRetained("unused", true);
+
+    // Copy 'copied' variable of third current source in a custom update
+    Copy::VarReferences copyVarReferences(createVarRef(cs2, "copied"));
+    model.addCustomUpdate<Copy>("Copy", "CustomUpdate", {}, Copy::VarValues(0.0), copyVarReferences);
+
+    model.finalize();
+
+    // Check that unreferenced variables are eliminated unless they are retained or referenced by custom updates
+    // and that read-only variables are only folded into code if they are constant
+    ASSERT_FALSE(cs0->isVarArrayRequired("amp"));
+    ASSERT_FALSE(cs0->isVarArrayRequired("scale"));
+    ASSERT_TRUE(cs0->isVarArrayRequired("unused"));
+    ASSERT_FALSE(cs0->isVarArrayRequired("copied"));
+    ASSERT_FALSE(cs2->isVarArrayRequired("amp"));
+    ASSERT_TRUE(cs2->isVarArrayRequired("scale"));
+    ASSERT_FALSE(cs2->isVarArrayRequired("unused"));
+    ASSERT_TRUE(cs2->isVarArrayRequired("copied"));
+
+    // Check that only first two current sources can be merged
+    CurrentSourceInternal *cs0Internal = static_cast<CurrentSourceInternal*>(cs0);
+    CurrentSourceInternal *cs1Internal = static_cast<CurrentSourceInternal*>(cs1);
+    CurrentSourceInternal *cs2Internal = static_cast<CurrentSourceInternal*>(cs2);
+    ASSERT_EQ(cs0Internal->getHashDigest(), cs1Internal->getHashDigest());
+    ASSERT_NE(cs0Internal->getHashDigest(), cs2Internal->getHashDigest());
+    ASSERT_TRUE(cs0Internal->isVarConstantFolded(0));
+    ASSERT_FALSE(cs0Internal->isVarConstantFolded(2));
+
+    // Create a backend
+    CodeGenerator::SingleThreadedCPU::Preferences preferences;
+    CodeGenerator::SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+
+    // Merge model
+    CodeGenerator::ModelSpecMerged modelSpecMerged(model, backend);
+
+    // Find merged neuron update group containing first two neuron groups
+    const auto mergedNeuronUpdateGroup = std::find_if(modelSpecMerged.getMergedNeuronUpdateGroups().cbegin(), modelSpecMerged.getMergedNeuronUpdateGroups().cend(),
+                                                      [](const CodeGenerator::NeuronUpdateGroupMerged &ng) { return (ng.getGroups().size() == 2); });
+    ASSERT_NE(mergedNeuronUpdateGroup, modelSpecMerged.getMergedNeuronUpdateGroups().cend());
+
+    // Check that only the folded value of 'amp' is heterogeneous
+    ASSERT_TRUE(mergedNeuronUpdateGroup->isCurrentSourceConstantVarHeterogeneous(0, 0));
+    ASSERT_FALSE(mergedNeuronUpdateGroup->isCurrentSourceConstantVarHeterogeneous(0, 1));
+}
@@ -88,6 +88,18 @@ public:
 };
 IMPLEMENT_MODEL(Cont2);
 
+class LazyDecay : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(LazyDecay, 0, 1, 0, 0);
+
+    SET_VARS({{"g", "scalar"}});
+
+    SET_SIM_CODE("$(addToInSyn, $(g));\n");
+    SET_LAZY_SYNAPSE_DYNAMICS_CODE("$(g) *= exp(-$(elapsed) / 10.0);\n");
+};
+IMPLEMENT_MODEL(LazyDecay);
+
 class Reduce : public CustomUpdateModels::Base
 {
     DECLARE_CUSTOM_UPDATE_MODEL(Reduce, 0, 0, 2);
@@ -304,6 +316,38 @@ TEST(CustomUpdates, WUVarSynapseGroupChecks)
     model.finalize();
 }
 //--------------------------------------------------------------------------
+TEST(CustomUpdates, WUVarLazySynapseDynamicsChecks)
+{
+    ModelSpecInternal model;
+
+    // Add two neuron group to model
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Pre", 10, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Post", 25, paramVals, varVals);
+
+    // Add synapse group with lazy synapse dynamics
+    auto *sg = model.addSynapsePopulation<LazyDecay, PostsynapticModels::DeltaCurr>(
+        "Synapses", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+        "Pre", "Post",
+        {}, {1.0},
+        {}, {});
+
+    // Add custom update which references its weights
+    Sum::VarValues sumVarValues(0.0);
+    Sum::WUVarReferences sumVarReferences(createWUVarRef(sg, "g"), createWUVarRef(sg, "g"));
+    model.addCustomUpdate<Sum>("SumWeight", "CustomUpdate",
+                               {}, sumVarValues, sumVarReferences);
+
+    // Custom updates don't bring lazy synapses up to date so this should give an error
+    try {
+        model.finalize();
+        FAIL();
+    }
+    catch(const std::runtime_error &) {
+    }
+}
+//--------------------------------------------------------------------------
 TEST(CustomUpdates, BatchingVars)
 {
     ModelSpecInternal model;
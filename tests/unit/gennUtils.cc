@@ -1,3 +1,9 @@
+// Standard C++ includes
+#include <atomic>
+
+// Standard C includes
+#include <cmath>
+
 // Google test includes
 #include "gtest/gtest.h"
 
@@ -118,4 +124,61 @@ TEST(GeNNUtils, VectorHashing)
     Utils::updateHash(vector1, hash2);
 
     ASSERT_NE(hash1.get_digest(), hash2.get_digest());
-}
\ No newline at end of file
+}
+//--------------------------------------------------------------------------
+TEST(GeNNUtils, ValidateDynamicParams)
+{
+    const std::vector<std::string> paramNames{"a", "b"};
+    const std::vector<double> params{2.0, 3.0};
+    const std::vector<bool> dynamicParams{true, false};
+
+    // Derived parameter which only depends on non-dynamic parameter is fine
+    const Snippet::Base::DerivedParamVec independent{{"c", [](const std::vector<double> &pars, double dt){ return pars[1] * dt; }}};
+    Utils::validateDynamicParams(independent, paramNames, params, dynamicParams, 0.1, "test");
+
+    // Derived parameters which depend on dynamic parameter through its sign,
+    // a threshold or its fractional part but don't change if it is doubled
+    const Snippet::Base::DerivedParamVec sign{{"c", [](const std::vector<double> &pars, double){ return (pars[0] > 0.0) ? 1.0 : -1.0; }}};
+    const Snippet::Base::DerivedParamVec threshold{{"c", [](const std::vector<double> &pars, double){ return (pars[0] < 10.0) ? 1.0 : 0.0; }}};
+    const Snippet::Base::DerivedParamVec integer{{"c", [](const std::vector<double> &pars, double){ return (std::floor(pars[0]) == pars[0]) ? 1.0 : 0.0; }}};
+    for(const auto &derivedParams : {sign, threshold, integer}) {
+        try {
+            Utils::validateDynamicParams(derivedParams, paramNames, params, dynamicParams, 0.1, "test");
+            FAIL();
+        }
+        catch(const std::runtime_error &) {
+        }
+    }
+}
+//--------------------------------------------------------------------------
+TEST(GeNNUtils, ParallelFor)
+{
+    // Check each index is visited exactly once, including when calls are nested
+    std::vector<std::atomic<unsigned int>> visits(100);
+    for(auto &v : visits) {
+        v = 0;
+    }
+    Utils::parallelFor(10, 4,
+                       [&visits](size_t i)
+                       {
+                           Utils::parallelFor(10, 4, [&visits, i](size_t j){ visits[(i * 10) + j]++; });
+                       });
+    for(const auto &v : visits) {
+        ASSERT_EQ(v, 1u);
+    }
+
+    // Check exceptions thrown on other threads are rethrown
+    try {
+        Utils::parallelFor(100, 4,
+                           [](size_t i)
+                           {
+                               if(i == 50) {
+                                   throw std::runtime_error("test");
+                               }
+                           });
+        FAIL();
+    }
+    catch(const std::runtime_error &e) {
+        ASSERT_STREQ(e.what(), "test");
+    }
+}
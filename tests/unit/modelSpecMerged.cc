@@ -1,12 +1,15 @@
 // Standard C++ includes
+#include <algorithm>
 #include <array>
 #include <functional>
+#include <sstream>
 #include <vector>
 
 // Google test includes
 #include "gtest/gtest.h"
 
 // GeNN code generator includes
+#include "code_generator/codeStream.h"
 #include "code_generator/modelSpecMerged.h"
 
 // (Single-threaded CPU) backend includes
@@ -96,6 +99,17 @@ class Sum : public CustomUpdateModels::Base
 };
 IMPLEMENT_MODEL(Sum);
 
+class StaticPulseHalf : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(StaticPulseHalf, 0, 1, 0, 0);
+
+    SET_VARS({{"g", "half", VarAccess::READ_ONLY}});
+
+    SET_SIM_CODE("$(addToInSyn, $(g));\n");
+};
+IMPLEMENT_MODEL(StaticPulseHalf);
+
 template<typename T, typename M, size_t N>
 void test(const std::pair<T, bool> (&modelModifiers)[N], M applyModifierFn)
 {
@@ -313,6 +327,28 @@ TEST(ModelSpecMerged, CompareNeuronParamChanges)
          });
 }
 //--------------------------------------------------------------------------
+TEST(ModelSpecMerged, CompareNeuronDynamicParamChanges)
+{
+    // Make array of values of dynamic parameter to build model with and flags determining whether the hashes should match baseline
+    // **NOTE** dynamic parameters don't affect generated code but their initial values are still written to runner
+    const std::pair<double, bool> modelModifiers[] = {
+        {4.0,   true},
+        {4.0,   true},
+        {2.0,   false},
+        {-4.0,  false}};
+
+    test(modelModifiers, 
+         [](double d, ModelSpecInternal &model)
+         {
+             // Add population with dynamic parameter
+             NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, d);
+             NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+             auto *pop = model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons", 100, 
+                                                                             paramVals, varVals);
+             pop->setParamDynamic("d");
+         });
+}
+//--------------------------------------------------------------------------
 TEST(ModelSpecMerged, CompareNeuronVarInitChanges)
 {
     // Izhikevcih parameter sets
@@ -648,6 +684,39 @@ TEST(ModelSpecMerged, CompareWUMParamChanges)
          });
 }
 //--------------------------------------------------------------------------
+TEST(ModelSpecMerged, CompareWUMDynamicParamChanges)
+{
+    // Make array of values of dynamic parameter to build model with and flags determining whether the hashes should match baseline
+    const std::pair<double, bool> modelModifiers[] = {
+        {0.001,     true},
+        {0.001,     true},
+        {0.002,     false},
+        {-0.001,    false}};
+
+    test(modelModifiers, 
+         [](double aPlus, ModelSpecInternal &model)
+         {
+             NeuronModels::Izhikevich::VarValues neuronVarVals(0.0, 0.0);
+             NeuronModels::Izhikevich::ParamValues neuronParamVals(0.02, 0.2, -65.0, 4.0);
+             model.addNeuronPopulation<NeuronModels::Izhikevich>("Pre", 100, 
+                                                                 neuronParamVals, neuronVarVals);
+             model.addNeuronPopulation<NeuronModels::Izhikevich>("Post", 100, 
+                                                                 neuronParamVals, neuronVarVals);
+
+             // Add synapse population with dynamic weight update model parameter
+             STDPAdditive::ParamValues params(20.0, 20.0, aPlus, -0.001, 0.0, 1.0);
+             STDPAdditive::VarValues varValues(0.5);
+             STDPAdditive::PreVarValues preVarValues(0.0);
+             STDPAdditive::PostVarValues postVarValues(0.0);
+             auto *sg = model.addSynapsePopulation<STDPAdditive, PostsynapticModels::DeltaCurr>(
+                 "Synapse", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+                 "Pre", "Post",
+                 params, varValues, preVarValues, postVarValues,
+                 {}, {});
+             sg->setWUParamDynamic("Aplus");
+         });
+}
+//--------------------------------------------------------------------------
 TEST(ModelSpecMerged, CompareWUMGlobalGVarChanges)
 {
     // Weight update model variable initialisers
@@ -1039,4 +1108,45 @@ TEST(ModelSpecMerged, CompareCustomUpdateVarRefTargetChanges)
                  model.addCustomUpdate<Sum>("CU" + std::to_string(c), "Group", paramVals, vals, varRefs);
              }
          });
-}
\ No newline at end of file
+}
+//--------------------------------------------------------------------------
+TEST(ModelSpecMerged, ReducedPrecisionTypesOnlyWhenUsed)
+{
+    for(bool reducedPrecision : {false, true}) {
+        ModelSpecInternal model;
+
+        // Add two populations connected with either standard or half-precision weights
+        NeuronModels::Izhikevich::VarValues neuronVarVals(0.0, 0.0);
+        NeuronModels::Izhikevich::ParamValues neuronParamVals(0.02, 0.2, -65.0, 4.0);
+        model.addNeuronPopulation<NeuronModels::Izhikevich>("Pre", 10, neuronParamVals, neuronVarVals);
+        model.addNeuronPopulation<NeuronModels::Izhikevich>("Post", 10, neuronParamVals, neuronVarVals);
+        if(reducedPrecision) {
+            model.addSynapsePopulation<StaticPulseHalf, PostsynapticModels::DeltaCurr>(
+                "Syn", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+                {}, StaticPulseHalf::VarValues(1.0), {}, {});
+        }
+        else {
+            model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+                "Syn", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+                {}, WeightUpdateModels::StaticPulse::VarValues(1.0), {}, {});
+        }
+        model.finalize();
+
+        // Create a backend and merge model
+        CodeGenerator::SingleThreadedCPU::Preferences preferences;
+        CodeGenerator::SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+        CodeGenerator::ModelSpecMerged modelSpecMerged(model, backend);
+
+        // Generate definitions preamble
+        std::ostringstream definitionsStream;
+        CodeGenerator::CodeStream definitions(definitionsStream);
+        backend.genDefinitionsPreamble(definitions, modelSpecMerged);
+
+        // Check that reduced-precision types are only copied and typedef'd if they're used
+        const auto files = backend.getFilesToCopy(modelSpecMerged);
+        const bool reducedPrecisionCopied = std::find(files.cbegin(), files.cend(),
+                                                      filesystem::path("single_threaded_cpu") / "reducedPrecision.h") != files.cend();
+        ASSERT_EQ(reducedPrecisionCopied, reducedPrecision);
+        ASSERT_EQ(definitionsStream.str().find("typedef GeNN::Half") != std::string::npos, reducedPrecision);
+    }
+}
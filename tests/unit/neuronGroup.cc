@@ -193,6 +193,40 @@ public:
     SET_NEEDS_POST_SPIKE_TIME(true);
 };
 IMPLEMENT_MODEL(STDPAdditive);
+
+class EliminateVarsNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(EliminateVarsNeuron, 0, 7);
+
+    SET_SIM_CODE("$(V) += $(a) * $(b);\n");
+    SET_THRESHOLD_CONDITION_CODE("$(V) >= $(thresh)");
+
+    SET_VARS({{"V", "scalar"}, {"a", "scalar", VarAccess::READ_ONLY}, {"b", "scalar", VarAccess::READ_ONLY},
+              {"thresh", "scalar", VarAccess::READ_ONLY}, {"unused", "scalar"}, {"retained", "scalar"},
+              {"copied", "scalar"}});
+};
+IMPLEMENT_MODEL(EliminateVarsNeuron);
+
+class StaticPulseThresh : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(StaticPulseThresh, 0, 0, 0, 0);
+
+    SET_SIM_CODE("$(addToInSyn, $(thresh_pre));\n");
+};
+IMPLEMENT_MODEL(StaticPulseThresh);
+
+class Copy : public CustomUpdateModels::Base
+{
+    DECLARE_CUSTOM_UPDATE_MODEL(Copy, 0, 1, 1);
+
+    SET_UPDATE_CODE("$(x) = $(a);\n");
+
+    SET_VARS({{"x", "scalar"}});
+    SET_VAR_REFS({{"a", "scalar", VarAccessMode::READ_ONLY}});
+};
+IMPLEMENT_MODEL(Copy);
 }
 
 //--------------------------------------------------------------------------
@@ -603,6 +637,115 @@ TEST(NeuronGroup, CompareHeterogeneousParamVarState)
     ASSERT_FALSE(modelSpecMerged.getMergedNeuronUpdateGroups().at(0).isParamHeterogeneous(6));
 }
 
+TEST(NeuronGroup, DynamicParams)
+{
+    // Build two models which differ only in the value of a dynamic parameter
+    LIFAdditional::ParamValues paramValsA(0.25, 10.0, 0.0, 0.0, 20.0, 0.0, 5.0);
+    LIFAdditional::ParamValues paramValsB(0.25, 10.0, 0.0, 0.0, 20.0, 1.0, 5.0);
+    LIFAdditional::VarValues varVals(0.0, 0.0);
+    ModelSpecInternal modelA;
+    ModelSpecInternal modelB;
+    auto *ngA = modelA.addNeuronPopulation<LIFAdditional>("Neurons0", 10, paramValsA, varVals);
+    auto *ngB = modelB.addNeuronPopulation<LIFAdditional>("Neurons0", 10, paramValsB, varVals);
+    ngA->setParamDynamic("Ioffset");
+    ngB->setParamDynamic("Ioffset");
+    modelA.finalize();
+    modelB.finalize();
+
+    ASSERT_TRUE(ngA->isParamDynamic(5));
+    ASSERT_FALSE(ngA->isParamDynamic(0));
+
+    // Create a backend
+    CodeGenerator::SingleThreadedCPU::Preferences preferences;
+    CodeGenerator::SingleThreadedCPU::Backend backend(modelA.getPrecision(), preferences);
+
+    // Merge models
+    CodeGenerator::ModelSpecMerged modelSpecMergedA(modelA, backend);
+    CodeGenerator::ModelSpecMerged modelSpecMergedB(modelB, backend);
+
+    // Check that dynamic parameter is always heterogeneous but its value doesn't affect hash
+    const auto &mergedGroupA = modelSpecMergedA.getMergedNeuronUpdateGroups().at(0);
+    const auto &mergedGroupB = modelSpecMergedB.getMergedNeuronUpdateGroups().at(0);
+    ASSERT_TRUE(mergedGroupA.isParamHeterogeneous(5));
+    ASSERT_FALSE(mergedGroupA.isParamHeterogeneous(4));
+    ASSERT_EQ(mergedGroupA.getHashDigest(), mergedGroupB.getHashDigest());
+
+    // Check that making a parameter used to calculate derived parameters dynamic is an error
+    ModelSpecInternal modelC;
+    auto *ngC = modelC.addNeuronPopulation<LIFAdditional>("Neurons0", 10, paramValsA, varVals);
+    ngC->setParamDynamic("TauM");
+    EXPECT_THROW(modelC.finalize(), std::runtime_error);
+}
+
+TEST(NeuronGroup, EliminateVars)
+{
+    ModelSpecInternal model;
+    model.setEliminateVars(true);
+
+    // Add two neuron groups with different constant values for 'a' and an 'a' initialised randomly
+    InitVarSnippet::Uniform::ParamValues dist(0.0, 1.0);
+    EliminateVarsNeuron::VarValues varValsA(0.0, 1.0, 2.0, 10.0, 0.0, 0.0, 0.0);
+    EliminateVarsNeuron::VarValues varValsB(0.0, 3.0, 2.0, 10.0, 0.0, 0.0, 0.0);
+    EliminateVarsNeuron::VarValues varValsC(0.0, initVar<InitVarSnippet::Uniform>(dist), 2.0, 10.0, 0.0, 0.0, 0.0);
+    auto *ng0 = model.addNeuronPopulation<EliminateVarsNeuron>("Neurons0", 10, {}, varValsA);
+    auto *ng1 = model.addNeuronPopulation<EliminateVarsNeuron>("Neurons1", 10, {}, varValsB);
+    auto *ng2 = model.addNeuronPopulation<EliminateVarsNeuron>("Neurons2", 10, {}, varValsC);
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Neurons3", 10, {}, {});
+    ng0->setVarRetained("retained", true);
+    ng1->setVarRetained("retained", true);
+
+    // Read threshold of third group in synaptic code and copy 'copied' variable in a custom update
+    model.addSynapsePopulation<StaticPulseThresh, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "Neurons2", "Neurons3",
+        {}, {}, {}, {});
+    Copy::VarReferences copyVarReferences(createVarRef(ng2, "copied"));
+    model.addCustomUpdate<Copy>("Copy", "CustomUpdate", {}, Copy::VarValues(0.0), copyVarReferences);
+
+    model.finalize();
+
+    // Check that unreferenced variables are eliminated unless they are retained or referenced by custom updates
+    // and that read-only variables are only folded into code if they are constant and not accessed by synaptic code
+    ASSERT_TRUE(ng0->isVarArrayRequired("V"));
+    ASSERT_FALSE(ng0->isVarArrayRequired("a"));
+    ASSERT_FALSE(ng0->isVarArrayRequired("b"));
+    ASSERT_FALSE(ng0->isVarArrayRequired("thresh"));
+    ASSERT_FALSE(ng0->isVarArrayRequired("unused"));
+    ASSERT_TRUE(ng0->isVarArrayRequired("retained"));
+    ASSERT_FALSE(ng0->isVarArrayRequired("copied"));
+    ASSERT_TRUE(ng2->isVarArrayRequired("V"));
+    ASSERT_TRUE(ng2->isVarArrayRequired("a"));
+    ASSERT_FALSE(ng2->isVarArrayRequired("b"));
+    ASSERT_TRUE(ng2->isVarArrayRequired("thresh"));
+    ASSERT_FALSE(ng2->isVarArrayRequired("unused"));
+    ASSERT_FALSE(ng2->isVarArrayRequired("retained"));
+    ASSERT_TRUE(ng2->isVarArrayRequired("copied"));
+
+    // Check that only first two groups can be merged
+    NeuronGroupInternal *ng0Internal = static_cast<NeuronGroupInternal*>(ng0);
+    NeuronGroupInternal *ng1Internal = static_cast<NeuronGroupInternal*>(ng1);
+    NeuronGroupInternal *ng2Internal = static_cast<NeuronGroupInternal*>(ng2);
+    ASSERT_EQ(ng0Internal->getHashDigest(), ng1Internal->getHashDigest());
+    ASSERT_NE(ng0Internal->getHashDigest(), ng2Internal->getHashDigest());
+    ASSERT_TRUE(ng0Internal->isVarConstantFolded(1));
+    ASSERT_FALSE(ng0Internal->isVarConstantFolded(4));
+
+    // Create a backend
+    CodeGenerator::SingleThreadedCPU::Preferences preferences;
+    CodeGenerator::SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+
+    // Merge model
+    CodeGenerator::ModelSpecMerged modelSpecMerged(model, backend);
+
+    // Find merged neuron update group containing first two neuron groups
+    const auto mergedNeuronUpdateGroup = std::find_if(modelSpecMerged.getMergedNeuronUpdateGroups().cbegin(), modelSpecMerged.getMergedNeuronUpdateGroups().cend(),
+                                                      [](const CodeGenerator::NeuronUpdateGroupMerged &ng) { return (ng.getGroups().size() == 2); });
+    ASSERT_NE(mergedNeuronUpdateGroup, modelSpecMerged.getMergedNeuronUpdateGroups().cend());
+
+    // Check that only the folded value of 'a' is heterogeneous
+    ASSERT_TRUE(mergedNeuronUpdateGroup->isConstantVarHeterogeneous(1));
+    ASSERT_FALSE(mergedNeuronUpdateGroup->isConstantVarHeterogeneous(2));
+    ASSERT_FALSE(mergedNeuronUpdateGroup->isConstantVarHeterogeneous(3));
+}
 
 TEST(NeuronGroup, CompareSimRNG)
 {
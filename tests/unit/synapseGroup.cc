@@ -202,6 +202,17 @@ public:
 };
 IMPLEMENT_MODEL(StaticPulseDynamics);
 
+class StaticPulsePreParam : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(StaticPulsePreParam, 0, 1, 0, 0);
+
+    SET_VARS({ {"g", "scalar", VarAccess::READ_ONLY} });
+
+    SET_SIM_CODE("$(addToInSyn, $(g) * $(d_pre));\n");
+};
+IMPLEMENT_MODEL(StaticPulsePreParam);
+
 class StaticPulsePostLearn : public WeightUpdateModels::Base
 {
 public:
@@ -288,6 +299,43 @@ public:
     SET_NEEDS_AUTO_REFRACTORY(false);
 };
 IMPLEMENT_MODEL(LIFAdditional);
+
+class EliminateVarsWUM : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(EliminateVarsWUM, 0, 5, 0, 0);
+
+    SET_SIM_CODE(
+        "$(addToInSyn, $(g) * $(scale));\n"
+        "$(count) += 1.0;\n");
+
+    SET_VARS({{"g", "scalar", VarAccess::READ_ONLY}, {"scale", "scalar", VarAccess::READ_ONLY},
+              {"count", "scalar"}, {"unused", "scalar"}, {"copied", "scalar"}});
+};
+IMPLEMENT_MODEL(EliminateVarsWUM);
+
+class EliminateVarsPSM : public PostsynapticModels::Base
+{
+public:
+    DECLARE_MODEL(EliminateVarsPSM, 0, 3);
+
+    SET_APPLY_INPUT_CODE("$(Isyn) += $(inSyn) * $(a);\n");
+    SET_DECAY_CODE("$(inSyn) = 0.0;\n");
+
+    SET_VARS({{"a", "scalar", VarAccess::READ_ONLY}, {"unused", "scalar"}, {"copied", "scalar"}});
+};
+IMPLEMENT_MODEL(EliminateVarsPSM);
+
+class Copy : public CustomUpdateModels::Base
+{
+    DECLARE_CUSTOM_UPDATE_MODEL(Copy, 0, 1, 1);
+
+    SET_UPDATE_CODE("$(x) = $(a);\n");
+
+    SET_VARS({{"x", "scalar"}});
+    SET_VAR_REFS({{"a", "scalar", VarAccessMode::READ_ONLY}});
+};
+IMPLEMENT_MODEL(Copy);
 }   // Anonymous namespace
 
 //--------------------------------------------------------------------------
@@ -675,6 +723,64 @@ TEST(SynapseGroup, CompareWUDifferentProceduralSnippet)
     ASSERT_TRUE(modelSpecMerged.getMergedSynapseSparseInitGroups().empty());
 }
 
+TEST(SynapseGroup, CompareWUDifferentSrcNeuronDynamicParams)
+{
+    ModelSpecInternal model;
+
+    // Add three presynaptic neuron groups, the first two with dynamic 'd' parameters and one postsynaptic
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    auto *ng0 = model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 10, paramVals, varVals);
+    auto *ng1 = model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons1", 10, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons2", 10, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons3", 10, paramVals, varVals);
+    ng0->setParamDynamic("d");
+    ng1->setParamDynamic("d");
+
+    // Connect each presynaptic group to postsynaptic group with weight update model which reads 'd'
+    StaticPulsePreParam::VarValues varValues(0.1);
+    auto *sg0 = model.addSynapsePopulation<StaticPulsePreParam, PostsynapticModels::DeltaCurr>("Synapses0", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY,
+                                                                                               "Neurons0", "Neurons3",
+                                                                                               {}, varValues,
+                                                                                               {}, {});
+    auto *sg1 = model.addSynapsePopulation<StaticPulsePreParam, PostsynapticModels::DeltaCurr>("Synapses1", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY,
+                                                                                               "Neurons1", "Neurons3",
+                                                                                               {}, varValues,
+                                                                                               {}, {});
+    auto *sg2 = model.addSynapsePopulation<StaticPulsePreParam, PostsynapticModels::DeltaCurr>("Synapses2", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY,
+                                                                                               "Neurons2", "Neurons3",
+                                                                                               {}, varValues,
+                                                                                               {}, {});
+    // Finalize model
+    model.finalize();
+
+    // Check that only synapse groups whose source neurons have the same dynamic parameters have matching hashes
+    SynapseGroupInternal *sg0Internal = static_cast<SynapseGroupInternal*>(sg0);
+    SynapseGroupInternal *sg1Internal = static_cast<SynapseGroupInternal*>(sg1);
+    SynapseGroupInternal *sg2Internal = static_cast<SynapseGroupInternal*>(sg2);
+    ASSERT_EQ(sg0Internal->getWUHashDigest(), sg1Internal->getWUHashDigest());
+    ASSERT_NE(sg0Internal->getWUHashDigest(), sg2Internal->getWUHashDigest());
+    ASSERT_EQ(sg0Internal->getWUPreHashDigest(), sg1Internal->getWUPreHashDigest());
+    ASSERT_NE(sg0Internal->getWUPreHashDigest(), sg2Internal->getWUPreHashDigest());
+
+    // Create a backend
+    CodeGenerator::SingleThreadedCPU::Preferences preferences;
+    CodeGenerator::SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+
+    // Merge model
+    CodeGenerator::ModelSpecMerged modelSpecMerged(model, backend);
+
+    // Check synapse groups with mixed dynamic source neuron parameters aren't merged
+    ASSERT_EQ(modelSpecMerged.getMergedPresynapticUpdateGroups().size(), 2);
+
+    // Check 'd' is only heterogeneous in merged group whose source neurons have it dynamic
+    for(const auto &sg : modelSpecMerged.getMergedPresynapticUpdateGroups()) {
+        const bool dynamic = (sg.getGroups().size() == 2);
+        ASSERT_EQ(sg.isSrcNeuronParamHeterogeneous(3), dynamic);
+        ASSERT_FALSE(sg.isSrcNeuronParamHeterogeneous(0));
+    }
+}
+
 TEST(SynapseGroup, InitCompareWUDifferentVars)
 {
     ModelSpecInternal model;
@@ -1111,6 +1217,13 @@ TEST(SynapseGroup, SharedWeightSlaveInvalidMethods)
     }
     catch (const std::runtime_error &) {
     }
+
+    try {
+        slave->setWUVarRetained("g", true);
+        FAIL();
+    }
+    catch (const std::runtime_error &) {
+    }
     //setSparseConnectivityExtraGlobalParamLocation
     //setMaxSourceConnections
 }
@@ -1248,3 +1361,103 @@ TEST(SynapseGroup, InvalidPSOutputVar)
     catch (const std::runtime_error &) {
     }
 }
+//--------------------------------------------------------------------------
+TEST(SynapseGroup, EliminateVars)
+{
+    ModelSpecInternal model;
+    model.setEliminateVars(true);
+
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Pre", 10, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Post", 10, paramVals, varVals);
+
+    // Add three synapse groups with different constant values for 'scale' and a 'scale' initialised randomly
+    InitVarSnippet::Uniform::ParamValues dist(0.0, 1.0);
+    EliminateVarsWUM::VarValues wumVarValsA(1.0, 0.5, 0.0, 0.0, 0.0);
+    EliminateVarsWUM::VarValues wumVarValsB(1.0, 2.0, 0.0, 0.0, 0.0);
+    EliminateVarsWUM::VarValues wumVarValsC(1.0, initVar<InitVarSnippet::Uniform>(dist), 0.0, 0.0, 0.0);
+    EliminateVarsPSM::VarValues psmVarValsA(1.0, 0.0, 0.0);
+    EliminateVarsPSM::VarValues psmVarValsB(3.0, 0.0, 0.0);
+    EliminateVarsPSM::VarValues psmVarValsC(initVar<InitVarSnippet::Uniform>(dist), 0.0, 0.0);
+    auto *sg0 = model.addSynapsePopulation<EliminateVarsWUM, EliminateVarsPSM>(
+        "Syn0", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, wumVarValsA, {}, psmVarValsA);
+    auto *sg1 = model.addSynapsePopulation<EliminateVarsWUM, EliminateVarsPSM>(
+        "Syn1", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, wumVarValsB, {}, psmVarValsB);
+    auto *sg2 = model.addSynapsePopulation<EliminateVarsWUM, EliminateVarsPSM>(
+        "Syn2", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, wumVarValsC, {}, psmVarValsC);
+    auto *master = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn3", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, {1.0}, {}, {});
+    auto *slave = model.addSlaveSynapsePopulation<PostsynapticModels::DeltaCurr>(
+        "Syn3Slave", "Syn3", NO_DELAY, "Pre", "Post", {}, {});
+    sg0->setWUVarRetained("unused", true);
+    sg1->setWUVarRetained("unused", true);
+    sg0->setPSVarRetained("unused", true);
+    sg1->setPSVarRetained("unused", true);
+
+    // Copy 'copied' variables of third group in custom updates
+    Copy::WUVarReferences copyWUVarReferences(createWUVarRef(sg2, "copied"));
+    Copy::VarReferences copyPSMVarReferences(createPSMVarRef(sg2, "copied"));
+    model.addCustomUpdate<Copy>("CopyWU", "CustomUpdate", {}, Copy::VarValues(0.0), copyWUVarReferences);
+    model.addCustomUpdate<Copy>("CopyPSM", "CustomUpdate", {}, Copy::VarValues(0.0), copyPSMVarReferences);
+
+    model.finalize();
+
+    // Check that unreferenced variables are eliminated unless they are retained or referenced by custom updates
+    // and that read-only variables are only folded into code if they are constant
+    ASSERT_FALSE(sg0->isWUVarArrayRequired("g"));
+    ASSERT_FALSE(sg0->isWUVarArrayRequired("scale"));
+    ASSERT_TRUE(sg0->isWUVarArrayRequired("count"));
+    ASSERT_TRUE(sg0->isWUVarArrayRequired("unused"));
+    ASSERT_FALSE(sg0->isWUVarArrayRequired("copied"));
+    ASSERT_FALSE(sg0->isPSVarArrayRequired("a"));
+    ASSERT_TRUE(sg0->isPSVarArrayRequired("unused"));
+    ASSERT_FALSE(sg0->isPSVarArrayRequired("copied"));
+    ASSERT_FALSE(sg2->isWUVarArrayRequired("g"));
+    ASSERT_TRUE(sg2->isWUVarArrayRequired("scale"));
+    ASSERT_TRUE(sg2->isWUVarArrayRequired("count"));
+    ASSERT_FALSE(sg2->isWUVarArrayRequired("unused"));
+    ASSERT_TRUE(sg2->isWUVarArrayRequired("copied"));
+    ASSERT_TRUE(sg2->isPSVarArrayRequired("a"));
+    ASSERT_FALSE(sg2->isPSVarArrayRequired("unused"));
+    ASSERT_TRUE(sg2->isPSVarArrayRequired("copied"));
+
+    // Check that weight sharing slave uses its master's variables
+    ASSERT_FALSE(master->isWUVarArrayRequired("g"));
+    ASSERT_FALSE(slave->isWUVarArrayRequired("g"));
+    ASSERT_TRUE(static_cast<SynapseGroupInternal*>(slave)->isWUVarConstantFolded(0));
+
+    // Check that only first two groups can be merged
+    SynapseGroupInternal *sg0Internal = static_cast<SynapseGroupInternal*>(sg0);
+    SynapseGroupInternal *sg1Internal = static_cast<SynapseGroupInternal*>(sg1);
+    SynapseGroupInternal *sg2Internal = static_cast<SynapseGroupInternal*>(sg2);
+    ASSERT_EQ(sg0Internal->getWUHashDigest(), sg1Internal->getWUHashDigest());
+    ASSERT_NE(sg0Internal->getWUHashDigest(), sg2Internal->getWUHashDigest());
+    ASSERT_EQ(sg0Internal->getPSHashDigest(), sg1Internal->getPSHashDigest());
+    ASSERT_NE(sg0Internal->getPSHashDigest(), sg2Internal->getPSHashDigest());
+    ASSERT_TRUE(sg0Internal->isWUVarConstantFolded(1));
+    ASSERT_FALSE(sg0Internal->isWUVarConstantFolded(3));
+    ASSERT_TRUE(sg0Internal->isPSVarConstantFolded(0));
+    ASSERT_FALSE(sg2Internal->isPSVarConstantFolded(0));
+
+    // Create a backend
+    CodeGenerator::SingleThreadedCPU::Preferences preferences;
+    CodeGenerator::SingleThreadedCPU::Backend backend(model.getPrecision(), preferences);
+
+    // Merge model
+    CodeGenerator::ModelSpecMerged modelSpecMerged(model, backend);
+
+    // Find merged presynaptic update group containing first two synapse groups
+    // **NOTE** weight sharing master and slave also get merged
+    const auto mergedPresynapticUpdateGroup = std::find_if(modelSpecMerged.getMergedPresynapticUpdateGroups().cbegin(), modelSpecMerged.getMergedPresynapticUpdateGroups().cend(),
+                                                           [](const CodeGenerator::PresynapticUpdateGroupMerged &sg) { return (sg.getArchetype().getWUModel() == EliminateVarsWUM::getInstance()) && (sg.getGroups().size() == 2); });
+    ASSERT_NE(mergedPresynapticUpdateGroup, modelSpecMerged.getMergedPresynapticUpdateGroups().cend());
+
+    // Check that only the folded value of 'scale' is heterogeneous
+    ASSERT_FALSE(mergedPresynapticUpdateGroup->isWUConstantVarHeterogeneous(0));
+    ASSERT_TRUE(mergedPresynapticUpdateGroup->isWUConstantVarHeterogeneous(1));
+}
@@ -0,0 +1,100 @@
+// Standard C++ includes
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Multi-threaded CPU backend runtime includes
+#include "threadPool.h"
+
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+void validateParallelFor(GeNN::ThreadPool &pool, size_t count)
+{
+    std::vector<std::atomic<unsigned int>> visits(count);
+    for(auto &v : visits) {
+        v = 0;
+    }
+    pool.parallelFor(count,
+                     [&visits](size_t begin, size_t end, unsigned int)
+                     {
+                         for(size_t i = begin; i < end; i++) {
+                             visits[i]++;
+                         }
+                     });
+    for(const auto &v : visits) {
+        ASSERT_EQ(v, 1);
+    }
+}
+}   // Anonymous namespace
+
+//--------------------------------------------------------------------------
+// Tests
+//--------------------------------------------------------------------------
+TEST(ThreadPool, ParallelFor)
+{
+    GeNN::ThreadPool pool;
+    pool.start(4);
+    ASSERT_EQ(pool.getNumThreads(), 4);
+
+    for(size_t count : {0, 1, 15, 64, 1000}) {
+        validateParallelFor(pool, count);
+    }
+}
+//--------------------------------------------------------------------------
+TEST(ThreadPool, ParallelForWeighted)
+{
+    GeNN::ThreadPool pool;
+    pool.start(4);
+
+    std::vector<std::atomic<unsigned int>> visits(1000);
+    for(auto &v : visits) {
+        v = 0;
+    }
+    pool.parallelForWeighted(visits.size(),
+                             [](size_t i){ return i % 17; },
+                             [&visits](size_t begin, size_t end, unsigned int)
+                             {
+                                 for(size_t i = begin; i < end; i++) {
+                                     visits[i]++;
+                                 }
+                             });
+    for(const auto &v : visits) {
+        ASSERT_EQ(v, 1);
+    }
+}
+//--------------------------------------------------------------------------
+TEST(ThreadPool, Restart)
+{
+    // Run one chunk of work on each of 4 threads
+    GeNN::ThreadPool pool;
+    pool.start(4);
+    std::atomic<unsigned int> numCalls(0);
+    pool.parallelFor(64, [&numCalls](size_t, size_t, unsigned int){ numCalls++; });
+    ASSERT_EQ(numCalls, 4);
+
+    // Restart pool and give new workers time to wake
+    // **NOTE** they must not run the task published before the previous stop
+    pool.start(4);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(numCalls, 4);
+
+    // Restart pool several times with different numbers of threads, running work in between
+    for(unsigned int numThreads : {4, 4, 2, 8, 1, 3}) {
+        pool.start(numThreads);
+        ASSERT_EQ(pool.getNumThreads(), numThreads);
+        validateParallelFor(pool, 1000);
+        validateParallelFor(pool, 100);
+    }
+
+    // Stop explicitly and check pool can still be restarted
+    pool.stop();
+    pool.start(4);
+    validateParallelFor(pool, 1000);
+}
@@ -35,6 +35,7 @@ public:
     :   m_Library(nullptr), m_AllocateMem(nullptr), m_AllocateRecordingBuffers(nullptr),
         m_FreeMem(nullptr), m_Initialize(nullptr), m_InitializeSparse(nullptr), 
         m_StepTime(nullptr), m_PullRecordingBuffersFromDevice(nullptr),
+        m_WriteTrace(nullptr), m_ClearTrace(nullptr),
         m_NCCLGenerateUniqueID(nullptr), m_NCCLGetUniqueID(nullptr), 
         m_NCCLInitCommunicator(nullptr), m_NCCLUniqueIDBytes(nullptr)
     {
@@ -92,6 +93,8 @@ public:
 
             m_StepTime = (VoidFunction)getSymbol("stepTime");
             m_PullRecordingBuffersFromDevice = (VoidFunction)getSymbol("pullRecordingBuffersFromDevice", true);
+            m_WriteTrace = (WriteTraceFunction)getSymbol("writeTrace", true);
+            m_ClearTrace = (VoidFunction)getSymbol("clearTrace", true);
             
             m_T = (scalar*)getSymbol("t");
             m_Timestep = (unsigned long long*)getSymbol("iT");
@@ -495,6 +498,22 @@ public:
         m_PullRecordingBuffersFromDevice();
     }
 
+    void writeTrace(const std::string &filename)
+    {
+        if(m_WriteTrace == nullptr) {
+            throw std::runtime_error("Cannot write trace - model may not have been built with tracing enabled");
+        }
+        m_WriteTrace(filename.c_str());
+    }
+
+    void clearTrace()
+    {
+        if(m_ClearTrace == nullptr) {
+            throw std::runtime_error("Cannot clear trace - model may not have been built with tracing enabled");
+        }
+        m_ClearTrace();
+    }
+
     scalar getTime() const
     {
         return *m_T;
@@ -520,9 +539,12 @@ public:
     double getPresynapticUpdateTime() const{ return *(double*)getSymbol("presynapticUpdateTime"); }
     double getPostsynapticUpdateTime() const{ return *(double*)getSymbol("postsynapticUpdateTime"); }
     double getSynapseDynamicsTime() const{ return *(double*)getSymbol("synapseDynamicsTime"); }
+    double getPresynapticUpdateImbalance() const{ return *(double*)getSymbol("presynapticUpdateImbalance"); }
+    double getSynapseDynamicsImbalance() const{ return *(double*)getSymbol("synapseDynamicsImbalance"); }
     double getInitSparseTime() const{ return *(double*)getSymbol("initSparseTime"); }
     double getCustomUpdateTime(const std::string &name)const{ return *(double*)getSymbol("customUpdate" + name + "Time"); }
     double getCustomUpdateTransposeTime(const std::string &name)const{ return *(double*)getSymbol("customUpdate" + name + "TransposeTime"); }
+    double getMergedGroupInitTime(const std::string &mergedGroupName, unsigned int index) const{ return *(double*)getSymbol("merged" + mergedGroupName + "Group" + std::to_string(index) + "Time"); }
     
     void *getSymbol(const std::string &symbolName, bool allowMissing = false, void *defaultSymbol = nullptr) const
     {
@@ -559,6 +581,7 @@ private:
     typedef void (*PullFunction)(void);
     typedef void (*EGPFunction)(unsigned int);
     typedef size_t (*GetFreeMemFunction)(void);
+    typedef void (*WriteTraceFunction)(const char*);
     typedef void (*NCCLInitCommunicatorFunction)(int, int);
 
     typedef std::pair<PushFunction, PullFunction> PushPullFunc;
@@ -633,6 +656,9 @@ private:
 
     PullFunction m_PullRecordingBuffersFromDevice;
 
+    WriteTraceFunction m_WriteTrace;
+    VoidFunction m_ClearTrace;
+
     VoidFunction m_NCCLGenerateUniqueID;
     UCharPtrFunction m_NCCLGetUniqueID;
     NCCLInitCommunicatorFunction m_NCCLInitCommunicator;